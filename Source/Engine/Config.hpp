@@ -2,6 +2,7 @@
 
 #include "Engine/Window.hpp"
 #include "Engine/Filesystem/Filepath.hpp"
+#include "Engine/Scene/MeshData.hpp"
 #include "Engine/Scene/Systems/CameraSystem.hpp"
 #include "Engine/EngineHelpers.hpp"
 
@@ -31,6 +32,9 @@ namespace Config
 
     constexpr float kLightProbeRadius = 0.1f;
 
+    // Largest projected simplification error in pixels, zero always draws full detail primitives
+    constexpr float kLodPixelError = 1.0f;
+
     constexpr bool kVSyncEnabled = false;
 
     constexpr bool kUseDefaultAssets = true;
@@ -47,6 +51,10 @@ namespace Config
 
     constexpr bool kForceForward = false;
 
+    constexpr bool kQuantizedVertices = false;
+
+    constexpr GeometryResidency kGeometryResidency = GeometryResidency::eCompact;
+
     namespace DefaultCamera
     {
         constexpr CameraLocation kLocation{
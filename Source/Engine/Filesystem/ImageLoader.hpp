@@ -26,5 +26,7 @@ namespace ImageLoader
 
     ImageSource LoadImage(const Filepath& filepath, uint32_t requiredChannelCount = 0);
 
+    ImageSource LoadImage(const ByteView& encodedData, uint32_t requiredChannelCount = 0);
+
     void FreeImage(void* imageData);
 }
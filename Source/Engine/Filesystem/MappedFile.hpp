@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Utils/DataHelpers.hpp"
+
+class Filepath;
+
+class MappedFile
+{
+public:
+    explicit MappedFile(const Filepath& path);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+
+    ~MappedFile();
+
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    const ByteView& GetData() const { return data; }
+
+    bool IsValid() const { return data.data != nullptr; }
+
+private:
+    ByteView data;
+
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+
+    void Unmap();
+};
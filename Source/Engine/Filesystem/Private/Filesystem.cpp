@@ -42,3 +42,12 @@ std::string Filesystem::ReadFile(const Filepath& filepath)
 
     return buffer.str();
 }
+
+bool Filesystem::WriteFile(const Filepath& filepath, const ByteView& data)
+{
+    std::ofstream file(filepath.GetAbsolute(), std::ios::binary | std::ios::trunc);
+
+    file.write(reinterpret_cast<const char*>(data.data), static_cast<std::streamsize>(data.size));
+
+    return file.good();
+}
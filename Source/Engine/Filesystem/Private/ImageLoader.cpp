@@ -28,17 +28,12 @@ namespace ImageLoader
         }
     }
 
-    static ImageSource LoadLdrImage(const Filepath& filepath, uint32_t requiredChannelCount)
+    static ImageSource RetrieveLdrImage(uint8_t* data, int32_t x, int32_t y,
+            int32_t actualChannelCount, uint32_t requiredChannelCount)
     {
         ImageSource imageSource;
 
-        int32_t x = 0;
-        int32_t y = 0;
-
-        int32_t actualChannelCount;
-
-        imageSource.data.data = stbi_load(filepath.GetAbsolute().c_str(),
-                &x, &y, &actualChannelCount, static_cast<int32_t>(requiredChannelCount));
+        imageSource.data.data = data;
 
         Assert(imageSource.data.data);
 
@@ -57,19 +52,14 @@ namespace ImageLoader
         return imageSource;
     }
 
-    static ImageSource LoadHdrImage(const Filepath& filepath, uint32_t requiredChannelCount)
+    static ImageSource RetrieveHdrImage(float* data, int32_t x, int32_t y,
+            int32_t actualChannelCount, uint32_t requiredChannelCount)
     {
         ImageSource imageSource;
 
-        int32_t x = 0;
-        int32_t y = 0;
-
-        int32_t actualChannelCount;
-
         DataAccess<float> hdrData;
 
-        hdrData.data = stbi_loadf(filepath.GetAbsolute().c_str(),
-                &x, &y, &actualChannelCount, static_cast<int32_t>(requiredChannelCount));
+        hdrData.data = data;
 
         Assert(hdrData.data);
 
@@ -90,6 +80,58 @@ namespace ImageLoader
         return imageSource;
     }
 
+    static ImageSource LoadLdrImage(const Filepath& filepath, uint32_t requiredChannelCount)
+    {
+        int32_t x = 0;
+        int32_t y = 0;
+
+        int32_t actualChannelCount;
+
+        uint8_t* data = stbi_load(filepath.GetAbsolute().c_str(),
+                &x, &y, &actualChannelCount, static_cast<int32_t>(requiredChannelCount));
+
+        return RetrieveLdrImage(data, x, y, actualChannelCount, requiredChannelCount);
+    }
+
+    static ImageSource LoadLdrImage(const ByteView& encodedData, uint32_t requiredChannelCount)
+    {
+        int32_t x = 0;
+        int32_t y = 0;
+
+        int32_t actualChannelCount;
+
+        uint8_t* data = stbi_load_from_memory(encodedData.data, static_cast<int32_t>(encodedData.size),
+                &x, &y, &actualChannelCount, static_cast<int32_t>(requiredChannelCount));
+
+        return RetrieveLdrImage(data, x, y, actualChannelCount, requiredChannelCount);
+    }
+
+    static ImageSource LoadHdrImage(const Filepath& filepath, uint32_t requiredChannelCount)
+    {
+        int32_t x = 0;
+        int32_t y = 0;
+
+        int32_t actualChannelCount;
+
+        float* data = stbi_loadf(filepath.GetAbsolute().c_str(),
+                &x, &y, &actualChannelCount, static_cast<int32_t>(requiredChannelCount));
+
+        return RetrieveHdrImage(data, x, y, actualChannelCount, requiredChannelCount);
+    }
+
+    static ImageSource LoadHdrImage(const ByteView& encodedData, uint32_t requiredChannelCount)
+    {
+        int32_t x = 0;
+        int32_t y = 0;
+
+        int32_t actualChannelCount;
+
+        float* data = stbi_loadf_from_memory(encodedData.data, static_cast<int32_t>(encodedData.size),
+                &x, &y, &actualChannelCount, static_cast<int32_t>(requiredChannelCount));
+
+        return RetrieveHdrImage(data, x, y, actualChannelCount, requiredChannelCount);
+    }
+
     bool IsHdrImageFile(const Filepath& filepath)
     {
         return stbi_is_hdr(filepath.GetAbsolute().c_str());
@@ -105,6 +147,18 @@ namespace ImageLoader
         return LoadLdrImage(filepath, requiredChannelCount);
     }
 
+    ImageSource LoadImage(const ByteView& encodedData, uint32_t requiredChannelCount)
+    {
+        const int32_t size = static_cast<int32_t>(encodedData.size);
+
+        if (stbi_is_hdr_from_memory(encodedData.data, size))
+        {
+            return LoadHdrImage(encodedData, requiredChannelCount);
+        }
+
+        return LoadLdrImage(encodedData, requiredChannelCount);
+    }
+
     void FreeImage(void* imageData)
     {
         stbi_image_free(imageData);
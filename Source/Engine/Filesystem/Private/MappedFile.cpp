@@ -0,0 +1,156 @@
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+#include "Engine/Filesystem/MappedFile.hpp"
+
+#include "Engine/Filesystem/Filepath.hpp"
+
+#include "Utils/Assert.hpp"
+
+namespace Details
+{
+#ifdef __linux__
+    static ByteView MapFile(const Filepath& path, void*&, void*&)
+    {
+        const int32_t fileDescriptor = open(path.GetAbsolute().c_str(), O_RDONLY);
+
+        if (fileDescriptor < 0)
+        {
+            return ByteView();
+        }
+
+        struct stat fileStat{};
+
+        if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0)
+        {
+            close(fileDescriptor);
+            return ByteView();
+        }
+
+        const size_t size = static_cast<size_t>(fileStat.st_size);
+
+        void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+        close(fileDescriptor);
+
+        if (address == MAP_FAILED)
+        {
+            return ByteView();
+        }
+
+        madvise(address, size, MADV_SEQUENTIAL);
+
+        return ByteView(static_cast<const uint8_t*>(address), size);
+    }
+
+    static void UnmapFile(const ByteView& data, void*, void*)
+    {
+        munmap(const_cast<uint8_t*>(data.data), data.size);
+    }
+#else
+    static ByteView MapFile(const Filepath& path, void*& fileHandle, void*& mappingHandle)
+    {
+        const HANDLE file = CreateFileA(path.GetAbsolute().c_str(), GENERIC_READ, FILE_SHARE_READ,
+                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return ByteView();
+        }
+
+        LARGE_INTEGER fileSize{};
+
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(file);
+            return ByteView();
+        }
+
+        const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (!mapping)
+        {
+            CloseHandle(file);
+            return ByteView();
+        }
+
+        const void* address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+        if (!address)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return ByteView();
+        }
+
+        fileHandle = file;
+        mappingHandle = mapping;
+
+        return ByteView(static_cast<const uint8_t*>(address), static_cast<size_t>(fileSize.QuadPart));
+    }
+
+    static void UnmapFile(const ByteView& data, void* fileHandle, void* mappingHandle)
+    {
+        UnmapViewOfFile(data.data);
+
+        CloseHandle(static_cast<HANDLE>(mappingHandle));
+        CloseHandle(static_cast<HANDLE>(fileHandle));
+    }
+#endif
+}
+
+MappedFile::MappedFile(const Filepath& path)
+{
+    data = Details::MapFile(path, fileHandle, mappingHandle);
+
+    if (!data.data)
+    {
+        LogE << "Failed to map file: " << path.GetAbsolute() << "\n";
+    }
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+    std::swap(data, other.data);
+    std::swap(fileHandle, other.fileHandle);
+    std::swap(mappingHandle, other.mappingHandle);
+}
+
+MappedFile::~MappedFile()
+{
+    Unmap();
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Unmap();
+
+        std::swap(data, other.data);
+        std::swap(fileHandle, other.fileHandle);
+        std::swap(mappingHandle, other.mappingHandle);
+    }
+
+    return *this;
+}
+
+void MappedFile::Unmap()
+{
+    if (data.data)
+    {
+        Details::UnmapFile(data, fileHandle, mappingHandle);
+    }
+
+    data = ByteView();
+
+    fileHandle = nullptr;
+    mappingHandle = nullptr;
+}
@@ -4,6 +4,7 @@
 #include "Engine/Filesystem/Filesystem.hpp"
 #include "Engine/Scene/Systems/TestSystem.hpp"
 #include "Engine/Scene/Systems/CameraSystem.hpp"
+#include "Engine/Scene/Systems/TransformSystem.hpp"
 #include "Engine/Render/FrameLoop.hpp"
 #include "Engine/Render/RenderContext.hpp"
 #include "Engine/Render/SceneRenderer.hpp"
@@ -23,7 +24,7 @@ namespace Details
         {
             const DialogDescription dialogDescription{
                 "Select Scene File", Filepath("~/"),
-                { "glTF Files", "*.gltf" }
+                { "Scene Files", "*.gltf *.glb *.steel" }
             };
 
             const std::optional<Filepath> scenePath = Filesystem::ShowOpenDialog(dialogDescription);
@@ -61,6 +62,7 @@ void Engine::Create()
 
     AddSystem<TestSystem>();
     AddSystem<CameraSystem>();
+    AddSystem<TransformSystem>();
 
     OpenScene();
 }
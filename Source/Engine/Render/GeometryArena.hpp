@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Utils/DataHelpers.hpp"
+#include "Utils/FreeListAllocator.hpp"
+
+struct VertexInput;
+
+// Location of one primitive inside the arena, all vertex streams share the vertex offset
+struct GeometryAllocation
+{
+    static constexpr uint32_t kInvalidPage = std::numeric_limits<uint32_t>::max();
+
+    uint32_t page = kInvalidPage;
+    uint32_t firstWord = 0;
+    uint32_t wordCount = 0;
+    uint32_t firstVertex = 0;
+    uint32_t vertexCount = 0;
+
+    bool IsValid() const { return page != kInvalidPage; }
+};
+
+// Buffers bound to a command buffer, draws from the same page skip rebinding
+struct GeometryBinding
+{
+    uint32_t page = GeometryAllocation::kInvalidPage;
+    vk::IndexType indexType = vk::IndexType::eNoneKHR;
+};
+
+// Sub-allocates the geometry of all primitives from a few large index and vertex buffers
+// Indices are stored in 32-bit words, so 16-bit index data has to be padded to a whole word
+class GeometryArena
+{
+public:
+    explicit GeometryArena(const std::vector<VertexInput>& vertexInputs);
+
+    ~GeometryArena();
+
+    GeometryAllocation Allocate(uint32_t wordCount, uint32_t vertexCount);
+
+    // Must be deferred until the GPU doesn't use the allocation anymore
+    void Free(const GeometryAllocation& allocation);
+
+    void UpdateIndices(vk::CommandBuffer commandBuffer,
+            const GeometryAllocation& allocation, const ByteView& data) const;
+
+    void UpdateVertices(vk::CommandBuffer commandBuffer,
+            const GeometryAllocation& allocation, uint32_t stream, const ByteView& data) const;
+
+    vk::DescriptorBufferInfo GetIndexBufferInfo(const GeometryAllocation& allocation) const;
+
+    vk::DescriptorBufferInfo GetVertexBufferInfo(const GeometryAllocation& allocation, uint32_t stream) const;
+
+    void Bind(vk::CommandBuffer commandBuffer, uint32_t page,
+            vk::IndexType indexType, GeometryBinding& binding) const;
+
+private:
+    struct Page
+    {
+        vk::Buffer indexBuffer;
+        std::vector<vk::Buffer> vertexBuffers;
+
+        FreeListAllocator indexAllocator;
+        FreeListAllocator vertexAllocator;
+    };
+
+    std::vector<uint32_t> vertexStrides;
+
+    uint32_t wordAlignment = 1;
+    uint32_t vertexAlignment = 1;
+
+    // Released pages keep their slot, so the page index of live allocations stays valid
+    std::vector<std::optional<Page>> pages;
+
+    bool TryAllocate(uint32_t pageIndex, uint32_t wordCount, uint32_t vertexCount,
+            GeometryAllocation& allocation);
+
+    uint32_t CreatePage(uint32_t wordCount, uint32_t vertexCount);
+
+    void DestroyPage(uint32_t pageIndex);
+};
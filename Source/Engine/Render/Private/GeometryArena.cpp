@@ -0,0 +1,259 @@
+#include <numeric>
+
+#include "Engine/Render/GeometryArena.hpp"
+
+#include "Engine/Render/Vulkan/VulkanContext.hpp"
+#include "Engine/Render/Vulkan/Pipelines/GraphicsPipeline.hpp"
+#include "Engine/Render/Vulkan/Resources/ImageHelpers.hpp"
+#include "Engine/Render/Vulkan/Resources/ResourceContext.hpp"
+
+#include "Utils/Assert.hpp"
+
+namespace Details
+{
+    // Primitives that don't fit get a dedicated page of their own size
+    static constexpr uint32_t kPageWordCount = 1 << 21;
+    static constexpr uint32_t kPageVertexCount = 1 << 19;
+
+    static constexpr vk::BufferUsageFlags kIndexUsage
+            = vk::BufferUsageFlagBits::eIndexBuffer
+            | vk::BufferUsageFlagBits::eStorageBuffer
+            | vk::BufferUsageFlagBits::eTransferDst;
+
+    static constexpr vk::BufferUsageFlags kVertexUsage
+            = vk::BufferUsageFlagBits::eVertexBuffer
+            | vk::BufferUsageFlagBits::eStorageBuffer
+            | vk::BufferUsageFlagBits::eTransferDst;
+
+    static uint32_t GetStride(const VertexInput& vertexInput)
+    {
+        uint32_t stride = 0;
+
+        for (const vk::Format format : vertexInput.format)
+        {
+            stride += ImageHelpers::GetTexelSize(format);
+        }
+
+        return std::max(stride, vertexInput.stride);
+    }
+
+    static vk::Buffer CreateBuffer(vk::DeviceSize size, vk::BufferUsageFlags usage)
+    {
+        return ResourceContext::CreateBuffer({
+            .size = size,
+            .usage = usage,
+            .stagingBuffer = true
+        });
+    }
+}
+
+GeometryArena::GeometryArena(const std::vector<VertexInput>& vertexInputs)
+{
+    const uint32_t offsetAlignment
+            = static_cast<uint32_t>(VulkanContext::device->GetLimits().minStorageBufferOffsetAlignment);
+
+    // Allocations are aligned so that every stream can be bound as a storage buffer range
+    wordAlignment = std::max(offsetAlignment / static_cast<uint32_t>(sizeof(uint32_t)), 1u);
+
+    for (const VertexInput& vertexInput : vertexInputs)
+    {
+        const uint32_t stride = Details::GetStride(vertexInput);
+
+        vertexAlignment = std::lcm(vertexAlignment, offsetAlignment / std::gcd(offsetAlignment, stride));
+
+        vertexStrides.push_back(stride);
+    }
+}
+
+GeometryArena::~GeometryArena()
+{
+    for (uint32_t i = 0; i < static_cast<uint32_t>(pages.size()); ++i)
+    {
+        if (pages[i])
+        {
+            Assert(pages[i]->indexAllocator.IsEmpty());
+
+            DestroyPage(i);
+        }
+    }
+}
+
+GeometryAllocation GeometryArena::Allocate(uint32_t wordCount, uint32_t vertexCount)
+{
+    Assert(wordCount > 0 && vertexCount > 0);
+
+    GeometryAllocation allocation;
+
+    for (uint32_t i = 0; i < static_cast<uint32_t>(pages.size()); ++i)
+    {
+        if (pages[i] && TryAllocate(i, wordCount, vertexCount, allocation))
+        {
+            return allocation;
+        }
+    }
+
+    const uint32_t pageIndex = CreatePage(wordCount, vertexCount);
+
+    const bool allocated = TryAllocate(pageIndex, wordCount, vertexCount, allocation);
+    Assert(allocated);
+
+    return allocation;
+}
+
+void GeometryArena::Free(const GeometryAllocation& allocation)
+{
+    Assert(allocation.IsValid() && pages[allocation.page]);
+
+    Page& page = *pages[allocation.page];
+
+    page.indexAllocator.Free(allocation.firstWord, allocation.wordCount);
+    page.vertexAllocator.Free(allocation.firstVertex, allocation.vertexCount);
+
+    if (page.indexAllocator.IsEmpty())
+    {
+        Assert(page.vertexAllocator.IsEmpty());
+
+        DestroyPage(allocation.page);
+    }
+}
+
+void GeometryArena::UpdateIndices(vk::CommandBuffer commandBuffer,
+        const GeometryAllocation& allocation, const ByteView& data) const
+{
+    Assert(data.size <= allocation.wordCount * sizeof(uint32_t));
+
+    const BufferUpdate update{
+        .data = data,
+        .offset = allocation.firstWord * sizeof(uint32_t)
+    };
+
+    ResourceContext::UpdateBuffer(commandBuffer, pages[allocation.page]->indexBuffer, update);
+}
+
+void GeometryArena::UpdateVertices(vk::CommandBuffer commandBuffer,
+        const GeometryAllocation& allocation, uint32_t stream, const ByteView& data) const
+{
+    Assert(data.size <= allocation.vertexCount * vertexStrides[stream]);
+
+    const BufferUpdate update{
+        .data = data,
+        .offset = static_cast<vk::DeviceSize>(allocation.firstVertex) * vertexStrides[stream]
+    };
+
+    ResourceContext::UpdateBuffer(commandBuffer, pages[allocation.page]->vertexBuffers[stream], update);
+}
+
+vk::DescriptorBufferInfo GeometryArena::GetIndexBufferInfo(const GeometryAllocation& allocation) const
+{
+    return vk::DescriptorBufferInfo(pages[allocation.page]->indexBuffer,
+            allocation.firstWord * sizeof(uint32_t), allocation.wordCount * sizeof(uint32_t));
+}
+
+vk::DescriptorBufferInfo GeometryArena::GetVertexBufferInfo(
+        const GeometryAllocation& allocation, uint32_t stream) const
+{
+    const vk::DeviceSize stride = vertexStrides[stream];
+
+    return vk::DescriptorBufferInfo(pages[allocation.page]->vertexBuffers[stream],
+            allocation.firstVertex * stride, allocation.vertexCount * stride);
+}
+
+void GeometryArena::Bind(vk::CommandBuffer commandBuffer, uint32_t page,
+        vk::IndexType indexType, GeometryBinding& binding) const
+{
+    Assert(pages[page]);
+
+    if (binding.page != page)
+    {
+        const std::vector<vk::DeviceSize> offsets(vertexStrides.size(), 0);
+
+        commandBuffer.bindVertexBuffers(0, pages[page]->vertexBuffers, offsets);
+    }
+
+    if (binding.page != page || binding.indexType != indexType)
+    {
+        commandBuffer.bindIndexBuffer(pages[page]->indexBuffer, 0, indexType);
+    }
+
+    binding.page = page;
+    binding.indexType = indexType;
+}
+
+bool GeometryArena::TryAllocate(uint32_t pageIndex, uint32_t wordCount, uint32_t vertexCount,
+        GeometryAllocation& allocation)
+{
+    Page& page = *pages[pageIndex];
+
+    const uint32_t firstWord = page.indexAllocator.Allocate(wordCount, wordAlignment);
+
+    if (firstWord == FreeListAllocator::kInvalidOffset)
+    {
+        return false;
+    }
+
+    const uint32_t firstVertex = page.vertexAllocator.Allocate(vertexCount, vertexAlignment);
+
+    if (firstVertex == FreeListAllocator::kInvalidOffset)
+    {
+        page.indexAllocator.Free(firstWord, wordCount);
+
+        return false;
+    }
+
+    allocation = GeometryAllocation{ pageIndex, firstWord, wordCount, firstVertex, vertexCount };
+
+    return true;
+}
+
+uint32_t GeometryArena::CreatePage(uint32_t wordCount, uint32_t vertexCount)
+{
+    EASY_FUNCTION()
+
+    const uint32_t pageWordCount = std::max(wordCount, Details::kPageWordCount);
+    const uint32_t pageVertexCount = std::max(vertexCount, Details::kPageVertexCount);
+
+    Page page{
+        .indexBuffer = Details::CreateBuffer(pageWordCount * sizeof(uint32_t), Details::kIndexUsage),
+        .vertexBuffers = {},
+        .indexAllocator = FreeListAllocator(pageWordCount),
+        .vertexAllocator = FreeListAllocator(pageVertexCount)
+    };
+
+    for (const uint32_t stride : vertexStrides)
+    {
+        page.vertexBuffers.push_back(Details::CreateBuffer(
+                static_cast<vk::DeviceSize>(pageVertexCount) * stride, Details::kVertexUsage));
+    }
+
+    const auto it = std::ranges::find_if(pages, [](const std::optional<Page>& slot)
+        {
+            return !slot.has_value();
+        });
+
+    const uint32_t pageIndex = static_cast<uint32_t>(std::distance(pages.begin(), it));
+
+    if (it == pages.end())
+    {
+        pages.emplace_back(std::move(page));
+    }
+    else
+    {
+        it->emplace(std::move(page));
+    }
+
+    return pageIndex;
+}
+
+void GeometryArena::DestroyPage(uint32_t pageIndex)
+{
+    Page& page = *pages[pageIndex];
+
+    ResourceContext::DestroyResource(page.indexBuffer);
+
+    for (const vk::Buffer buffer : page.vertexBuffers)
+    {
+        ResourceContext::DestroyResource(buffer);
+    }
+
+    pages[pageIndex].reset();
+}
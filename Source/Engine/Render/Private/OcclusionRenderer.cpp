@@ -1,5 +1,6 @@
 #include "Engine/Render/OcclusionRenderer.hpp"
 
+#include "Engine/Render/RenderHelpers.hpp"
 #include "Engine/Render/Vulkan/RenderPass.hpp"
 #include "Engine/Render/Vulkan/VulkanContext.hpp"
 #include "Engine/Render/Vulkan/Pipelines/GraphicsPipeline.hpp"
@@ -115,11 +116,6 @@ namespace Details
                     defines),
         };
 
-        const VertexInput vertexInput{
-            { vk::Format::eR32G32B32Sfloat },
-            0, vk::VertexInputRate::eVertex
-        };
-
         const GraphicsPipeline::Description description{
             vk::PrimitiveTopology::eTriangleList,
             vk::PolygonMode::eFill,
@@ -128,7 +124,7 @@ namespace Details
             vk::SampleCountFlagBits::e1,
             vk::CompareOp::eLess,
             shaderModules,
-            { vertexInput },
+            Primitive::kInstancedVertexInputs,
             {}
         };
 
@@ -277,18 +273,24 @@ void OcclusionRenderer::Render(vk::CommandBuffer commandBuffer) const
 
     const auto& geometryComponent = scene->ctx().get<GeometryStorageComponent>();
 
+    GeometryBinding geometryBinding;
+
+    RenderHelpers::BindInstanceBuffer(commandBuffer, *scene);
+
     for (auto&& [entity, tc, rc] : sceneRenderView.each())
     {
+        const Range instances = RenderHelpers::GetInstanceRange(*scene, entity);
+
         for (const auto& ro : rc.renderObjects)
         {
-            pipeline->PushConstant(commandBuffer, "transform", tc.GetWorldTransform().GetMatrix());
-
             const Primitive& primitive = geometryComponent.primitives[ro.primitive];
 
-            commandBuffer.bindIndexBuffer(primitive.GetIndexBuffer(), 0, vk::IndexType::eUint32);
-            commandBuffer.bindVertexBuffers(0, { primitive.GetPositionBuffer() }, { 0 });
+            pipeline->PushConstant(commandBuffer, "transform", tc.GetWorldTransform().GetMatrix());
+
+            pipeline->PushConstant(commandBuffer, "positionTransform", primitive.GetPositionTransform());
 
-            commandBuffer.drawIndexed(primitive.GetIndexCount(), 1, 0, 0, 0);
+            // Occlusion is tested against the full detail geometry
+            primitive.Draw(commandBuffer, geometryBinding, 0, instances.size, instances.offset);
         }
     }
 
@@ -42,6 +42,11 @@ namespace Details
             std::make_pair("RENDER_TO_HDR", 0),
             std::make_pair("RENDER_TO_CUBE", 0),
             std::make_pair("SAMPLE_COUNT", kSampleCount),
+            std::make_pair("QUANTIZED_VERTICES", Config::kQuantizedVertices),
+        };
+
+        const ShaderDefines hitDefines{
+            std::make_pair("QUANTIZED_VERTICES", Config::kQuantizedVertices),
         };
 
         const std::vector<ShaderModule> shaderModules{
@@ -54,10 +59,12 @@ namespace Details
                     vk::ShaderStageFlagBits::eMissKHR),
             VulkanContext::shaderManager->CreateShaderModule(
                     Filepath("~/Shaders/PathTracing/ClosestHit.rchit"),
-                    vk::ShaderStageFlagBits::eClosestHitKHR),
+                    vk::ShaderStageFlagBits::eClosestHitKHR,
+                    hitDefines),
             VulkanContext::shaderManager->CreateShaderModule(
                     Filepath("~/Shaders/PathTracing/AnyHit.rahit"),
-                    vk::ShaderStageFlagBits::eAnyHitKHR)
+                    vk::ShaderStageFlagBits::eAnyHitKHR,
+                    hitDefines)
         };
 
         std::map<ShaderGroupType, std::vector<ShaderGroup>> shaderGroupsMap;
@@ -83,44 +90,53 @@ namespace Details
         return pipeline;
     }
 
-    static void CreateDescriptors(DescriptorProvider& descriptorProvider,
-            const Scene& scene, const RenderTarget& accumulationTarget)
+    static void PushGeometryDescriptorData(DescriptorProvider& descriptorProvider,
+            const GeometryStorageComponent& geometryComponent)
     {
-        const auto& renderComponent = scene.ctx().get<RenderContextComponent>();
-        const auto& rayTracingComponent = scene.ctx().get<RayTracingContextComponent>();
-        const auto& textureComponent = scene.ctx().get<TextureStorageComponent>();
-        const auto& geometryComponent = scene.ctx().get<GeometryStorageComponent>();
-        const auto& environmentComponent = scene.ctx().get<EnvironmentComponent>();
-
-        std::vector<vk::Buffer> indexBuffers;
-        std::vector<vk::Buffer> normalsBuffers;
-        std::vector<vk::Buffer> tangentsBuffers;
-        std::vector<vk::Buffer> texCoordBuffers;
+        BufferInfo indexBuffers;
+        BufferInfo normalBuffers;
+        BufferInfo tangentBuffers;
+        BufferInfo texCoordBuffers;
 
         indexBuffers.reserve(geometryComponent.primitives.size());
-        normalsBuffers.reserve(geometryComponent.primitives.size());
-        tangentsBuffers.reserve(geometryComponent.primitives.size());
+        normalBuffers.reserve(geometryComponent.primitives.size());
+        tangentBuffers.reserve(geometryComponent.primitives.size());
         texCoordBuffers.reserve(geometryComponent.primitives.size());
 
         for (const auto& primitive : geometryComponent.primitives)
         {
-            indexBuffers.push_back(primitive.GetIndexBuffer());
-            normalsBuffers.push_back(primitive.GetNormalBuffer());
-            tangentsBuffers.push_back(primitive.GetTangentBuffer());
-            texCoordBuffers.push_back(primitive.GetTexCoordBuffer());
+            indexBuffers.push_back(primitive.GetIndexBufferInfo());
+            normalBuffers.push_back(primitive.GetNormalBufferInfo());
+            tangentBuffers.push_back(primitive.GetTangentBufferInfo());
+            texCoordBuffers.push_back(primitive.GetTexCoordBufferInfo());
         }
 
+        constexpr vk::DescriptorType type = vk::DescriptorType::eStorageBuffer;
+
+        descriptorProvider.PushGlobalData("indexBuffers", DescriptorData{ type, indexBuffers });
+        descriptorProvider.PushGlobalData("normalBuffers", DescriptorData{ type, normalBuffers });
+        descriptorProvider.PushGlobalData("tangentBuffers", DescriptorData{ type, tangentBuffers });
+        descriptorProvider.PushGlobalData("texCoordBuffers", DescriptorData{ type, texCoordBuffers });
+    }
+
+    static void CreateDescriptors(DescriptorProvider& descriptorProvider,
+            const Scene& scene, const RenderTarget& accumulationTarget)
+    {
+        const auto& renderComponent = scene.ctx().get<RenderContextComponent>();
+        const auto& rayTracingComponent = scene.ctx().get<RayTracingContextComponent>();
+        const auto& textureComponent = scene.ctx().get<TextureStorageComponent>();
+        const auto& geometryComponent = scene.ctx().get<GeometryStorageComponent>();
+        const auto& environmentComponent = scene.ctx().get<EnvironmentComponent>();
+
         descriptorProvider.PushGlobalData("lights", renderComponent.lightBuffer);
         descriptorProvider.PushGlobalData("materials", renderComponent.materialBuffer);
         descriptorProvider.PushGlobalData("materialTextures", &textureComponent.textures);
         descriptorProvider.PushGlobalData("environmentMap", &environmentComponent.cubemapTexture);
         descriptorProvider.PushGlobalData("tlas", &rayTracingComponent.tlas);
-        descriptorProvider.PushGlobalData("indexBuffers", &indexBuffers);
-        descriptorProvider.PushGlobalData("normalBuffers", &normalsBuffers);
-        descriptorProvider.PushGlobalData("tangentBuffers", &tangentsBuffers);
-        descriptorProvider.PushGlobalData("texCoordBuffers", &texCoordBuffers);
         descriptorProvider.PushGlobalData("accumulationTarget", accumulationTarget.view);
 
+        PushGeometryDescriptorData(descriptorProvider, geometryComponent);
+
         for (uint32_t i = 0; i < VulkanContext::swapchain->GetImageCount(); ++i)
         {
             descriptorProvider.PushSliceData("frame", renderComponent.frameBuffers[i]);
@@ -189,28 +205,7 @@ void PathTracingRenderer::Update() const
 
     if (geometryComponent.updated)
     {
-        std::vector<vk::Buffer> indexBuffers;
-        std::vector<vk::Buffer> normalsBuffers;
-        std::vector<vk::Buffer> tangentsBuffers;
-        std::vector<vk::Buffer> texCoordBuffers;
-
-        indexBuffers.reserve(geometryComponent.primitives.size());
-        normalsBuffers.reserve(geometryComponent.primitives.size());
-        tangentsBuffers.reserve(geometryComponent.primitives.size());
-        texCoordBuffers.reserve(geometryComponent.primitives.size());
-
-        for (const auto& primitive : geometryComponent.primitives)
-        {
-            indexBuffers.push_back(primitive.GetIndexBuffer());
-            normalsBuffers.push_back(primitive.GetNormalBuffer());
-            tangentsBuffers.push_back(primitive.GetTangentBuffer());
-            texCoordBuffers.push_back(primitive.GetTexCoordBuffer());
-        }
-
-        descriptorProvider->PushGlobalData("indexBuffers", &indexBuffers);
-        descriptorProvider->PushGlobalData("normalBuffers", &normalsBuffers);
-        descriptorProvider->PushGlobalData("tangentBuffers", &tangentsBuffers);
-        descriptorProvider->PushGlobalData("texCoordBuffers", &texCoordBuffers);
+        Details::PushGeometryDescriptorData(*descriptorProvider, geometryComponent);
     }
 
     if (rayTracingComponent.updated)
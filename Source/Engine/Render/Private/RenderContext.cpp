@@ -1,11 +1,14 @@
 #include "Engine/Render/RenderContext.hpp"
 
 #include "Engine/Render/FrameLoop.hpp"
+#include "Engine/Render/GeometryArena.hpp"
 #include "Engine/Render/Vulkan/VulkanContext.hpp"
 #include "Engine/Scene/ImageBasedLighting.hpp"
 #include "Engine/Scene/GlobalIllumination.hpp"
+#include "Engine/Scene/Primitive.hpp"
 
 std::unique_ptr<FrameLoop> RenderContext::frameLoop;
+std::unique_ptr<GeometryArena> RenderContext::geometryArena;
 std::unique_ptr<ImageBasedLighting> RenderContext::imageBasedLighting;
 std::unique_ptr<GlobalIllumination> RenderContext::globalIllumination;
 
@@ -14,6 +17,7 @@ void RenderContext::Create()
     EASY_FUNCTION()
 
     frameLoop = std::make_unique<FrameLoop>();
+    geometryArena = std::make_unique<GeometryArena>(Primitive::kVertexInputs);
     imageBasedLighting = std::make_unique<ImageBasedLighting>();
     globalIllumination = std::make_unique<GlobalIllumination>();
 }
@@ -23,4 +27,7 @@ void RenderContext::Destroy()
     imageBasedLighting.reset();
     globalIllumination.reset();
     frameLoop.reset();
+
+    // Deferred frees of primitive geometry are flushed by the frame loop
+    geometryArena.reset();
 }
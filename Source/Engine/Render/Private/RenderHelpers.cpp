@@ -6,11 +6,50 @@
 #include "Engine/Render/Vulkan/Pipelines/GraphicsPipeline.hpp"
 #include "Engine/Render/Vulkan/Pipelines/MaterialPipelineCache.hpp"
 #include "Engine/Render/Vulkan/Resources/DescriptorProvider.hpp"
+#include "Engine/Scene/Components/CameraComponent.hpp"
+#include "Engine/Scene/Components/Components.hpp"
 #include "Engine/Scene/Components/EnvironmentComponent.hpp"
 #include "Engine/Scene/GlobalIllumination.hpp"
 #include "Engine/Scene/ImageBasedLighting.hpp"
+#include "Engine/Scene/Primitive.hpp"
 #include "Engine/Scene/Scene.hpp"
 
+namespace Details
+{
+    static float GetMaxScale(const glm::mat4& transform)
+    {
+        return std::max({
+            glm::length(glm::vec3(transform[0])),
+            glm::length(glm::vec3(transform[1])),
+            glm::length(glm::vec3(transform[2]))
+        });
+    }
+
+    static uint32_t SelectLod(const std::vector<Lod>& lods, const AABBox& bbox,
+            float scale, const CameraComponent& cameraComponent)
+    {
+        if (lods.size() <= 1 || Config::kLodPixelError <= 0.0f)
+        {
+            return 0;
+        }
+
+        const float radius = glm::length(bbox.GetSize()) * 0.5f;
+        const float distance = glm::length(bbox.GetCenter() - cameraComponent.location.position) - radius;
+
+        if (distance <= cameraComponent.projection.zNear)
+        {
+            return 0;
+        }
+
+        const float height = static_cast<float>(VulkanContext::swapchain->GetExtent().height);
+
+        // Pixels covered by a world space unit at the nearest point of the bounding sphere
+        const float pixelScale = std::abs(cameraComponent.projMatrix[1][1]) * 0.5f * height / distance;
+
+        return LodHelpers::SelectLod(lods, Config::kLodPixelError / (pixelScale * scale));
+    }
+}
+
 vk::Rect2D RenderHelpers::GetSwapchainRenderArea()
 {
     return vk::Rect2D(vk::Offset2D(), VulkanContext::swapchain->GetExtent());
@@ -56,21 +95,23 @@ void RenderHelpers::PushRayTracingDescriptorData(const Scene& scene, DescriptorP
     const auto& geometryComponent = scene.ctx().get<GeometryStorageComponent>();
     const auto& rayTracingComponent = scene.ctx().get<RayTracingContextComponent>();
 
-    std::vector<vk::Buffer> indexBuffers;
-    std::vector<vk::Buffer> texCoordBuffers;
+    BufferInfo indexBuffers;
+    BufferInfo texCoordBuffers;
 
     indexBuffers.reserve(geometryComponent.primitives.size());
     texCoordBuffers.reserve(geometryComponent.primitives.size());
 
     for (const auto& primitive : geometryComponent.primitives)
     {
-        indexBuffers.push_back(primitive.GetIndexBuffer());
-        texCoordBuffers.push_back(primitive.GetTexCoordBuffer());
+        indexBuffers.push_back(primitive.GetIndexBufferInfo());
+        texCoordBuffers.push_back(primitive.GetTexCoordBufferInfo());
     }
 
+    constexpr vk::DescriptorType type = vk::DescriptorType::eStorageBuffer;
+
     descriptorProvider.PushGlobalData("tlas", &rayTracingComponent.tlas);
-    descriptorProvider.PushGlobalData("indexBuffers", &indexBuffers);
-    descriptorProvider.PushGlobalData("texCoordBuffers", &texCoordBuffers);
+    descriptorProvider.PushGlobalData("indexBuffers", DescriptorData{ type, indexBuffers });
+    descriptorProvider.PushGlobalData("texCoordBuffers", DescriptorData{ type, texCoordBuffers });
 }
 
 std::set<MaterialFlags> RenderHelpers::CacheMaterialPipelines(const Scene& scene,
@@ -92,3 +133,44 @@ std::set<MaterialFlags> RenderHelpers::CacheMaterialPipelines(const Scene& scene
 
     return uniquePipelines;
 }
+
+void RenderHelpers::BindInstanceBuffer(vk::CommandBuffer commandBuffer, const Scene& scene)
+{
+    const auto& renderComponent = scene.ctx().get<RenderContextComponent>();
+
+    const uint32_t binding = static_cast<uint32_t>(Primitive::kVertexInputs.size());
+
+    commandBuffer.bindVertexBuffers(binding, { renderComponent.instanceBuffer }, { 0 });
+}
+
+Range RenderHelpers::GetInstanceRange(const Scene& scene, entt::entity entity)
+{
+    if (const auto* ic = scene.try_get<InstanceComponent>(entity))
+    {
+        return Range{ ic->firstInstance, static_cast<uint32_t>(ic->transforms.size()) };
+    }
+
+    return Range{ 0, 1 };
+}
+
+uint32_t RenderHelpers::SelectLod(const Primitive& primitive,
+        const glm::mat4& transform, const CameraComponent& cameraComponent)
+{
+    return Details::SelectLod(primitive.GetLods(), primitive.GetBBox().GetTransformed(transform),
+            Details::GetMaxScale(transform), cameraComponent);
+}
+
+uint32_t RenderHelpers::SelectLod(const Primitive& primitive, const glm::mat4& transform,
+        const InstanceComponent& instanceComponent, const CameraComponent& cameraComponent)
+{
+    const AABBox& bbox = primitive.GetBBox();
+
+    // Every instance lies within the origins bbox extended by the scaled sphere around the primitive origin
+    const float radius = glm::length(glm::max(glm::abs(bbox.GetMin()), glm::abs(bbox.GetMax())));
+
+    AABBox instancesBBox = instanceComponent.originBBox;
+    instancesBBox.Extend(radius * instanceComponent.maxScale);
+
+    return Details::SelectLod(primitive.GetLods(), instancesBBox.GetTransformed(transform),
+            Details::GetMaxScale(transform) * instanceComponent.maxScale, cameraComponent);
+}
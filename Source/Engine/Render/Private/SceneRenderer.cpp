@@ -15,6 +15,26 @@
 
 namespace Details
 {
+    // Rows of an affine transform, the layout of Primitive::kInstanceInput
+    using InstanceRows = std::array<glm::vec4, 3>;
+
+    static InstanceRows GetInstanceRows(const glm::mat4& transform)
+    {
+        const glm::mat4 transposedTransform = glm::transpose(transform);
+
+        return InstanceRows{ transposedTransform[0], transposedTransform[1], transposedTransform[2] };
+    }
+
+    static vk::Buffer CreateInstanceBuffer(uint32_t instanceCount)
+    {
+        return ResourceContext::CreateBuffer({
+            .type = BufferType::eVertex,
+            .size = sizeof(InstanceRows) * instanceCount,
+            .usage = vk::BufferUsageFlagBits::eTransferDst,
+            .stagingBuffer = true
+        });
+    }
+
     static void EmplaceDefaultCamera(Scene& scene)
     {
         const entt::entity entity = scene.create();
@@ -59,6 +79,15 @@ namespace Details
             .stagingBuffer = true
         });
 
+        const InstanceRows identityRows = GetInstanceRows(Matrix4::kIdentity);
+
+        renderComponent.instanceBuffer = ResourceContext::CreateBuffer({
+            .type = BufferType::eVertex,
+            .initialData = GetByteView(identityRows)
+        });
+
+        renderComponent.instanceCount = 1;
+
         renderComponent.frameBuffers.resize(VulkanContext::swapchain->GetImageCount());
 
         for (auto& frameBuffer : renderComponent.frameBuffers)
@@ -176,15 +205,107 @@ namespace Details
                 renderComponent.frameBuffers[imageIndex], bufferUpdate);
     }
 
+    // Instance transforms of all entities are packed into one buffer after the identity in slot 0
+    // It's rebuilt only when the instance count changes or any InstanceComponent is marked as updated
+    static void UpdateInstanceBuffer(vk::CommandBuffer commandBuffer, Scene& scene)
+    {
+        EASY_FUNCTION()
+
+        auto& renderComponent = scene.ctx().get<RenderContextComponent>();
+
+        const auto instanceView = scene.view<InstanceComponent>();
+
+        uint32_t instanceCount = 1;
+        bool updated = false;
+
+        for (auto&& [entity, ic] : instanceView.each())
+        {
+            instanceCount += static_cast<uint32_t>(ic.transforms.size());
+
+            updated = updated || ic.updated;
+        }
+
+        if (!updated && instanceCount == renderComponent.instanceCount)
+        {
+            return;
+        }
+
+        if (instanceCount != renderComponent.instanceCount)
+        {
+            ResourceContext::DestroyResourceSafe(renderComponent.instanceBuffer);
+
+            renderComponent.instanceBuffer = CreateInstanceBuffer(instanceCount);
+            renderComponent.instanceCount = instanceCount;
+        }
+
+        const BufferUpdater updater = [&](const ByteAccess& data)
+            {
+                InstanceRows* dst = reinterpret_cast<InstanceRows*>(data.data);
+
+                *dst++ = GetInstanceRows(Matrix4::kIdentity);
+
+                uint32_t firstInstance = 1;
+
+                for (auto&& [entity, ic] : instanceView.each())
+                {
+                    ic.updated = false;
+                    ic.firstInstance = firstInstance;
+                    ic.originBBox = AABBox();
+                    ic.maxScale = 0.0f;
+
+                    for (const glm::mat4& transform : ic.transforms)
+                    {
+                        ic.originBBox.Add(glm::vec3(transform[3]));
+
+                        ic.maxScale = std::max({ ic.maxScale,
+                            glm::length(glm::vec3(transform[0])),
+                            glm::length(glm::vec3(transform[1])),
+                            glm::length(glm::vec3(transform[2]))
+                        });
+
+                        *dst++ = GetInstanceRows(transform);
+                    }
+
+                    firstInstance += static_cast<uint32_t>(ic.transforms.size());
+                }
+            };
+
+        const BufferUpdate bufferUpdate{
+            .waitedScope = SyncScope::kVerticesRead,
+            .blockedScope = SyncScope::kVerticesRead,
+            .updater = updater
+        };
+
+        ResourceContext::UpdateBuffer(commandBuffer, renderComponent.instanceBuffer, bufferUpdate);
+    }
+
     static void UpdateTlas(vk::CommandBuffer commandBuffer, Scene& scene)
     {
         TlasInstances tlasInstances;
 
         for (auto&& [entity, tc, rc] : scene.view<TransformComponent, RenderComponent>().each())
         {
-            for (const auto& ro : rc.renderObjects)
+            const glm::mat4& worldTransform = tc.GetWorldTransform().GetMatrix();
+
+            // Instanced entities are expanded here, only ray tracing needs an instance per copy
+            if (const auto* ic = scene.try_get<InstanceComponent>(entity))
+            {
+                for (const glm::mat4& transform : ic->transforms)
+                {
+                    const glm::mat4 instanceTransform = worldTransform * transform;
+
+                    for (const auto& ro : rc.renderObjects)
+                    {
+                        tlasInstances.push_back(SceneHelpers::GetTlasInstance(scene, instanceTransform, ro));
+                    }
+                }
+            }
+            else
             {
-                tlasInstances.push_back(SceneHelpers::GetTlasInstance(scene, tc, ro));
+                for (const auto& ro : rc.renderObjects)
+                {
+                    tlasInstances.push_back(SceneHelpers::GetTlasInstance(scene, worldTransform, ro));
+                }
             }
         }
 
@@ -253,6 +374,7 @@ SceneRenderer::~SceneRenderer()
     }
 
     ResourceContext::DestroyResource(renderComponent.materialBuffer);
+    ResourceContext::DestroyResource(renderComponent.instanceBuffer);
 
     for (const auto frameBuffer : renderComponent.frameBuffers)
     {
@@ -328,6 +450,8 @@ void SceneRenderer::Render(vk::CommandBuffer commandBuffer, uint32_t imageIndex)
             Details::UpdateMaterialBuffer(commandBuffer, *scene);
         }
 
+        Details::UpdateInstanceBuffer(commandBuffer, *scene);
+
         if (scene->ctx().contains<RayTracingContextComponent>())
         {
             Details::UpdateTlas(commandBuffer, *scene);
@@ -1,6 +1,7 @@
 #pragma once
 
 class FrameLoop;
+class GeometryArena;
 class ImageBasedLighting;
 class GlobalIllumination;
 
@@ -12,6 +13,8 @@ public:
 
     static std::unique_ptr<FrameLoop> frameLoop;
 
+    static std::unique_ptr<GeometryArena> geometryArena;
+
     static std::unique_ptr<ImageBasedLighting> imageBasedLighting;
     static std::unique_ptr<GlobalIllumination> globalIllumination;
 };
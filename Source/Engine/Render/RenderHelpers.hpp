@@ -7,6 +7,9 @@ class RenderPass;
 class GraphicsPipeline;
 class DescriptorProvider;
 class MaterialPipelineCache;
+class Primitive;
+struct CameraComponent;
+struct InstanceComponent;
 
 using MaterialPipelinePred = std::function<bool(MaterialFlags)>;
 
@@ -22,4 +25,17 @@ namespace RenderHelpers
 
     std::set<MaterialFlags> CacheMaterialPipelines(const Scene& scene,
             MaterialPipelineCache& cache, const MaterialPipelinePred& pred);
+
+    // Binds the instance buffer of the scene to the instance stream of Primitive::kInstancedVertexInputs
+    void BindInstanceBuffer(vk::CommandBuffer commandBuffer, const Scene& scene);
+
+    // Entities without InstanceComponent are drawn once with the identity instance transform
+    Range GetInstanceRange(const Scene& scene, entt::entity entity);
+
+    // Coarsest level of detail whose error projects to at most Config::kLodPixelError pixels
+    uint32_t SelectLod(const Primitive& primitive, const glm::mat4& transform, const CameraComponent& cameraComponent);
+
+    // All instances share one draw, so the level of detail is selected for the instance nearest to the camera
+    uint32_t SelectLod(const Primitive& primitive, const glm::mat4& transform,
+            const InstanceComponent& instanceComponent, const CameraComponent& cameraComponent);
 }
@@ -1,11 +1,13 @@
 #include "Engine/Render/Stages/ForwardStage.hpp"
 
 #include "Engine/Engine.hpp"
+#include "Engine/Render/RenderHelpers.hpp"
 #include "Engine/Render/Stages/GBufferStage.hpp"
 #include "Engine/Render/Vulkan/RenderPass.hpp"
 #include "Engine/Render/Vulkan/VulkanContext.hpp"
 #include "Engine/Render/Vulkan/Pipelines/GraphicsPipeline.hpp"
 #include "Engine/Render/Vulkan/Resources/ResourceContext.hpp"
+#include "Engine/Scene/Components/CameraComponent.hpp"
 #include "Engine/Scene/Components/Components.hpp"
 #include "Engine/Scene/Components/EnvironmentComponent.hpp"
 
@@ -355,6 +357,11 @@ void ForwardStage::DrawScene(vk::CommandBuffer commandBuffer, uint32_t imageInde
 
     const auto& materialComponent = scene->ctx().get<MaterialStorageComponent>();
     const auto& geometryComponent = scene->ctx().get<GeometryStorageComponent>();
+    const auto& cameraComponent = scene->ctx().get<CameraComponent>();
+
+    GeometryBinding geometryBinding;
+
+    RenderHelpers::BindInstanceBuffer(commandBuffer, *scene);
 
     for (const auto& materialFlags : uniqueMaterialPipelines)
     {
@@ -368,17 +375,29 @@ void ForwardStage::DrawScene(vk::CommandBuffer commandBuffer, uint32_t imageInde
 
         for (auto&& [entity, tc, rc] : sceneRenderView.each())
         {
+            const InstanceComponent* ic = scene->try_get<InstanceComponent>(entity);
+
+            const Range instances = RenderHelpers::GetInstanceRange(*scene, entity);
+
             for (const auto& ro : rc.renderObjects)
             {
                 if (materialComponent.materials[ro.material].flags == materialFlags)
                 {
-                    pipeline.PushConstant(commandBuffer, "transform", tc.GetWorldTransform().GetMatrix());
+                    const Primitive& primitive = geometryComponent.primitives[ro.primitive];
+
+                    const glm::mat4 worldTransform = tc.GetWorldTransform().GetMatrix();
+
+                    pipeline.PushConstant(commandBuffer, "transform", worldTransform);
+
+                    pipeline.PushConstant(commandBuffer, "positionTransform", primitive.GetPositionTransform());
 
                     pipeline.PushConstant(commandBuffer, "materialIndex", ro.material);
 
-                    const Primitive& primitive = geometryComponent.primitives[ro.primitive];
+                    const uint32_t lod = ic
+                            ? RenderHelpers::SelectLod(primitive, worldTransform, *ic, cameraComponent)
+                            : RenderHelpers::SelectLod(primitive, worldTransform, cameraComponent);
 
-                    primitive.Draw(commandBuffer);
+                    primitive.Draw(commandBuffer, geometryBinding, lod, instances.size, instances.offset);
                 }
             }
         }
@@ -1,12 +1,14 @@
 #include "Engine/Render/Stages/GBufferStage.hpp"
 
 #include "Engine/Engine.hpp"
+#include "Engine/Render/RenderHelpers.hpp"
 #include "Engine/Render/Vulkan/Pipelines/GraphicsPipeline.hpp"
 #include "Engine/Render/Vulkan/RenderPass.hpp"
 #include "Engine/Render/Vulkan/VulkanHelpers.hpp"
 #include "Engine/Render/Vulkan/Pipelines/MaterialPipelineCache.hpp"
 #include "Engine/Render/Vulkan/Resources/ImageHelpers.hpp"
 #include "Engine/Render/Vulkan/Resources/ResourceContext.hpp"
+#include "Engine/Scene/Components/CameraComponent.hpp"
 #include "Engine/Scene/Components/Components.hpp"
 #include "Engine/Scene/Primitive.hpp"
 #include "Engine/Scene/Scene.hpp"
@@ -317,6 +319,11 @@ void GBufferStage::DrawScene(vk::CommandBuffer commandBuffer, uint32_t imageInde
 
     const auto& materialComponent = scene->ctx().get<MaterialStorageComponent>();
     const auto& geometryComponent = scene->ctx().get<GeometryStorageComponent>();
+    const auto& cameraComponent = scene->ctx().get<CameraComponent>();
+
+    GeometryBinding geometryBinding;
+
+    RenderHelpers::BindInstanceBuffer(commandBuffer, *scene);
 
     for (const auto& materialFlags : uniquePipelines)
     {
@@ -330,17 +337,29 @@ void GBufferStage::DrawScene(vk::CommandBuffer commandBuffer, uint32_t imageInde
 
         for (auto&& [entity, tc, rc] : scene->view<TransformComponent, RenderComponent>().each())
         {
+            const InstanceComponent* ic = scene->try_get<InstanceComponent>(entity);
+
+            const Range instances = RenderHelpers::GetInstanceRange(*scene, entity);
+
             for (const auto& ro : rc.renderObjects)
             {
                 if (materialComponent.materials[ro.material].flags == materialFlags)
                 {
-                    pipeline.PushConstant(commandBuffer, "transform", tc.GetWorldTransform().GetMatrix());
+                    const Primitive& primitive = geometryComponent.primitives[ro.primitive];
+
+                    const glm::mat4 worldTransform = tc.GetWorldTransform().GetMatrix();
+
+                    pipeline.PushConstant(commandBuffer, "transform", worldTransform);
+
+                    pipeline.PushConstant(commandBuffer, "positionTransform", primitive.GetPositionTransform());
 
                     pipeline.PushConstant(commandBuffer, "materialIndex", ro.material);
 
-                    const Primitive& primitive = geometryComponent.primitives[ro.primitive];
+                    const uint32_t lod = ic
+                            ? RenderHelpers::SelectLod(primitive, worldTransform, *ic, cameraComponent)
+                            : RenderHelpers::SelectLod(primitive, worldTransform, cameraComponent);
 
-                    primitive.Draw(commandBuffer);
+                    primitive.Draw(commandBuffer, geometryBinding, lod, instances.size, instances.offset);
                 }
             }
         }
@@ -17,6 +17,7 @@ namespace Details
         const ShaderDefines shaderDefines{
             { "RAY_TRACING_ENABLED", Config::kRayTracingEnabled },
             { "LIGHT_VOLUME_ENABLED", Config::kGlobalIlluminationEnabled },
+            { "QUANTIZED_VERTICES", Config::kQuantizedVertices },
         };
 
         const ShaderModule shaderModule = VulkanContext::shaderManager->CreateComputeShaderModule(
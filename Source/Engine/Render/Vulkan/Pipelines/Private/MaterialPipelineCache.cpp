@@ -30,6 +30,8 @@ namespace Details
     {
         ShaderDefines shaderDefines = MaterialHelpers::GetShaderDefines(flags);
 
+        shaderDefines.emplace("QUANTIZED_VERTICES", Config::kQuantizedVertices);
+
         if (stage == MaterialPipelineStage::eForward)
         {
             shaderDefines.emplace("RAY_TRACING_ENABLED", Config::kRayTracingEnabled);
@@ -90,7 +92,7 @@ namespace Details
             vk::SampleCountFlagBits::e1,
             vk::CompareOp::eLess,
             shaderModules,
-            Primitive::kVertexInputs,
+            Primitive::kInstancedVertexInputs,
             blendModes
         };
 
@@ -32,6 +32,7 @@ struct BufferUpdate
     SyncScope waitedScope = SyncScope::kWaitForNone;
     SyncScope blockedScope = SyncScope::kBlockNone;
     BufferUpdater updater = nullptr;
+    vk::DeviceSize offset = 0;
 };
 
 namespace BufferHelpers
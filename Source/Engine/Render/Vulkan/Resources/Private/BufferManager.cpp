@@ -77,24 +77,34 @@ void BufferManager::UpdateBuffer(vk::CommandBuffer commandBuffer,
     const auto& [description, stagingBuffer] = buffers.at(buffer);
 
     Assert(description.usage & vk::BufferUsageFlagBits::eTransferDst);
+    Assert(!update.updater || update.offset == 0);
+    Assert(update.offset + update.data.size <= description.size);
 
     const MemoryBlock memoryBlock = VulkanContext::memoryManager->GetBufferMemoryBlock(stagingBuffer);
 
+    const ByteAccess stagingMemory = VulkanContext::memoryManager->MapMemory(memoryBlock);
+
     if (update.updater)
     {
-        update.updater(VulkanContext::memoryManager->MapMemory(memoryBlock));
+        update.updater(stagingMemory);
     }
     else
     {
-        update.data.CopyTo(VulkanContext::memoryManager->MapMemory(memoryBlock));
+        update.data.CopyTo(ByteAccess(stagingMemory.data + update.offset, stagingMemory.size - update.offset));
     }
 
     VulkanContext::memoryManager->UnmapMemory(memoryBlock);
 
+    // Data updates copy only the range they cover, so sub-allocations of one buffer don't overwrite each other
+    const vk::DeviceSize size = update.updater ? description.size : update.data.size;
+
     BufferHelpers::InsertPipelineBarrier(commandBuffer, buffer,
             PipelineBarrier{ update.waitedScope, SyncScope::kTransferWrite });
 
-    commandBuffer.copyBuffer(stagingBuffer, buffer, { vk::BufferCopy(0, 0, description.size) });
+    if (size > 0)
+    {
+        commandBuffer.copyBuffer(stagingBuffer, buffer, { vk::BufferCopy(update.offset, update.offset, size) });
+    }
 
     BufferHelpers::InsertPipelineBarrier(commandBuffer, buffer,
             PipelineBarrier{ SyncScope::kTransferWrite, update.blockedScope });
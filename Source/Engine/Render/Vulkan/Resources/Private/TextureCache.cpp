@@ -254,6 +254,33 @@ Texture TextureCache::GetTexture(const Filepath& path)
 {
     EASY_FUNCTION()
 
+    if (const std::optional<Texture> texture = FindTexture(path))
+    {
+        return *texture;
+    }
+
+    return AddTexture(path, ImageLoader::LoadImage(path, 4));
+}
+
+Texture TextureCache::GetTexture(const Filepath& path, const ByteView& encodedData)
+{
+    EASY_FUNCTION()
+
+    if (const std::optional<Texture> texture = FindTexture(path))
+    {
+        return *texture;
+    }
+
+    return AddTexture(path, ImageLoader::LoadImage(encodedData, 4));
+}
+
+Texture TextureCache::GetTexture(DefaultTexture key)
+{
+    return Texture{ defaultTextures.at(key), GetSampler() };
+}
+
+std::optional<Texture> TextureCache::FindTexture(const Filepath& path)
+{
     const auto it = textureCache.find(path);
 
     if (it != textureCache.end())
@@ -263,24 +290,26 @@ Texture TextureCache::GetTexture(const Filepath& path)
         return Texture{ it->second.image, GetSampler() };
     }
 
-    const ImageSource imageSource = ImageLoader::LoadImage(path, 4);
+    return std::nullopt;
+}
+
+Texture TextureCache::AddTexture(const Filepath& path, const ImageSource& source)
+{
+    EASY_FUNCTION()
+
+    Assert(!textureCache.contains(path));
 
-    const Texture texture = CreateTexture(imageSource);
+    const Texture texture = CreateTexture(source);
 
     VulkanHelpers::SetObjectName(VulkanContext::device->Get(), texture.image.image, path.GetBaseName());
 
-    ImageLoader::FreeImage(imageSource.data.data);
+    ImageLoader::FreeImage(source.data.data);
 
     textureCache.emplace(path, TextureEntry{ texture.image, 1 });
 
     return texture;
 }
 
-Texture TextureCache::GetTexture(DefaultTexture key)
-{
-    return Texture{ defaultTextures.at(key), GetSampler() };
-}
-
 Texture TextureCache::CreateTexture(const ImageSourceView& source)
 {
     EASY_FUNCTION()
@@ -2,6 +2,7 @@
 
 #include "Engine/Render/Vulkan/Resources/TextureHelpers.hpp"
 
+struct ImageSource;
 struct ImageSourceView;
 
 class TextureCache
@@ -12,8 +13,16 @@ public:
 
     static Texture GetTexture(const Filepath& path);
 
+    static Texture GetTexture(const Filepath& path, const ByteView& encodedData);
+
     static Texture GetTexture(DefaultTexture key);
 
+    // Returns the cached texture and increments its reference count
+    static std::optional<Texture> FindTexture(const Filepath& path);
+
+    // Uploads the decoded image, caches it under the path and frees the image data
+    static Texture AddTexture(const Filepath& path, const ImageSource& source);
+
     static Texture CreateTexture(const ImageSourceView& source);
 
     static Texture CreateCubeTexture(const BaseImage& panorama);
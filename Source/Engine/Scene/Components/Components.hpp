@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Engine/Scene/Components/HierarchyComponent.hpp"
 #include "Engine/Scene/Material.hpp"
 #include "Engine/Scene/Primitive.hpp"
 #include "Engine/Scene/Transform.hpp"
@@ -9,34 +10,16 @@
 
 struct Texture;
 
-class HierarchyComponent
-{
-public:
-    HierarchyComponent(Scene& scene_, entt::entity self_, entt::entity parent_);
-
-    entt::entity GetParent() const { return parent; }
-
-    const std::vector<entt::entity>& GetChildren() const { return children; }
-
-    void SetParent(entt::entity parent_);
-
-private:
-    Scene& scene;
-
-    const entt::entity self;
-
-    entt::entity parent = entt::null;
-
-    std::vector<entt::entity> children;
-};
-
 class TransformComponent
 {
 public:
     TransformComponent(Scene& scene_, entt::entity self_, const Transform& localTransform_);
 
-    const Transform& GetLocalTransform() const { return localTransform; }
+    // Local transforms are stored in the TransformHierarchy of the scene
+    Transform GetLocalTransform() const;
 
+    // World transforms are updated once per frame by TransformSystem, new entities get theirs on creation
+    // Between a local change or reparenting and the next update it returns the value of the last update
     const Transform& GetWorldTransform() const;
 
     void SetLocalTransform(const Transform& transform);
@@ -48,15 +31,13 @@ public:
     void SetLocalScale(const glm::vec3& scale);
 
 private:
+    friend class TransformHierarchy;
+
     Scene& scene;
 
     const entt::entity self;
 
-    Transform localTransform;
-
     mutable Transform worldTransform;
-
-    mutable bool modified = true;
 };
 
 struct ScenePrefabComponent
@@ -87,6 +68,22 @@ struct RenderComponent
     std::vector<RenderObject> renderObjects;
 };
 
+// Copies of the render objects placed relative to the entity, all of them are drawn by one instanced draw
+struct InstanceComponent
+{
+    std::vector<glm::mat4> transforms;
+
+    // Must be set whenever the transforms change and for every copy of the component,
+    // the renderer repacks the instance buffer and clears it
+    bool updated = true;
+
+    // Assigned by the renderer when it uploads the transforms, slot 0 of the instance buffer is the identity
+    // Bounds of the instance origins and the largest instance scale let it select one level of detail for all
+    uint32_t firstInstance = 0;
+    AABBox originBBox;
+    float maxScale = 1.0f;
+};
+
 enum class LightType
 {
     ePoint,
@@ -121,7 +118,9 @@ struct RenderContextComponent
 {
     vk::Buffer lightBuffer;
     vk::Buffer materialBuffer;
+    vk::Buffer instanceBuffer;
     std::vector<vk::Buffer> frameBuffers;
+    uint32_t instanceCount = 0;
 };
 
 struct RayTracingContextComponent
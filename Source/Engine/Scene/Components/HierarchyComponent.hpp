@@ -0,0 +1,42 @@
+#pragma once
+
+class Scene;
+
+// Intrusive first child / next sibling links, children keep the order in which they were added
+// Scene::SortHierarchy lays the storage out depth-first, so descendants are a contiguous range after the entity
+class HierarchyComponent
+{
+public:
+    HierarchyComponent(Scene& scene_, entt::entity self_, entt::entity parent_);
+
+    entt::entity GetParent() const { return parent; }
+
+    entt::entity GetFirstChild() const { return firstChild; }
+
+    entt::entity GetNextSibling() const { return nextSibling; }
+
+    void SetParent(entt::entity parent_);
+
+private:
+    friend class Scene;
+
+    // Pointer keeps the component assignable, entt swaps components when sorting the storage
+    Scene* scene;
+
+    entt::entity self;
+
+    entt::entity parent = entt::null;
+
+    entt::entity firstChild = entt::null;
+    entt::entity lastChild = entt::null;
+
+    entt::entity prevSibling = entt::null;
+    entt::entity nextSibling = entt::null;
+
+    // Size of the descendant range, only valid while the storage is sorted
+    uint32_t descendantCount = 0;
+
+    void Link();
+
+    void Unlink();
+};
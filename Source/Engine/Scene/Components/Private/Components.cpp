@@ -1,111 +1,45 @@
 #include "Engine/Scene/Components/Components.hpp"
 
 #include "Engine/Scene/Scene.hpp"
+#include "Engine/Scene/TransformHierarchy.hpp"
 
-HierarchyComponent::HierarchyComponent(Scene& scene_, entt::entity self_, entt::entity parent_)
+TransformComponent::TransformComponent(Scene& scene_, entt::entity self_, const Transform& localTransform_)
     : scene(scene_)
     , self(self_)
 {
     Assert(self != entt::null);
 
-    SetParent(parent_);
-}
-
-void HierarchyComponent::SetParent(entt::entity parent_)
-{
-    if (parent == parent_)
-    {
-        return;
-    }
-
-    if (parent != entt::null)
-    {
-        auto& parentHc = scene.get<HierarchyComponent>(parent);
-
-        std::erase(parentHc.children, self);
-    }
+    const entt::entity parent = scene.get<HierarchyComponent>(self).GetParent();
 
-    parent = parent_;
-
-    if (parent != entt::null)
-    {
-        auto& parentHc = scene.get<HierarchyComponent>(parent);
-
-        parentHc.children.push_back(self);
-    }
+    worldTransform = Transform(scene.GetTransformHierarchy().Add(self, parent, localTransform_));
 }
 
-TransformComponent::TransformComponent(Scene& scene_, entt::entity self_, const Transform& localTransform_)
-    : scene(scene_)
-    , self(self_)
-    , localTransform(localTransform_)
+Transform TransformComponent::GetLocalTransform() const
 {
-    Assert(self != entt::null);
+    return scene.GetTransformHierarchy().GetLocalTransform(self);
 }
 
 const Transform& TransformComponent::GetWorldTransform() const
 {
-    if (modified)
-    {
-        worldTransform = localTransform;
-
-        const entt::entity parent = scene.get<HierarchyComponent>(self).GetParent();
-
-        if (parent != entt::null)
-        {
-            worldTransform *= scene.get<TransformComponent>(parent).GetWorldTransform();
-        }
-
-        modified = false;
-    }
-
     return worldTransform;
 }
 
 void TransformComponent::SetLocalTransform(const Transform& transform)
 {
-    localTransform = transform;
-
-    modified = true;
-
-    scene.EnumerateDescendants(self, [&](entt::entity child)
-        {
-            scene.get<TransformComponent>(child).modified = true;
-        });
+    scene.GetTransformHierarchy().SetLocalTransform(self, transform);
 }
 
 void TransformComponent::SetLocalTranslation(const glm::vec3& translation)
 {
-    localTransform.SetTranslation(translation);
-
-    modified = true;
-
-    scene.EnumerateDescendants(self, [&](entt::entity child)
-        {
-            scene.get<TransformComponent>(child).modified = true;
-        });
+    scene.GetTransformHierarchy().SetLocalTranslation(self, translation);
 }
 
 void TransformComponent::SetLocalRotation(const glm::quat& rotation)
 {
-    localTransform.SetRotation(rotation);
-
-    modified = true;
-
-    scene.EnumerateDescendants(self, [&](entt::entity child)
-        {
-            scene.get<TransformComponent>(child).modified = true;
-        });
+    scene.GetTransformHierarchy().SetLocalRotation(self, rotation);
 }
 
 void TransformComponent::SetLocalScale(const glm::vec3& scale)
 {
-    localTransform.SetScale(scale);
-
-    modified = true;
-
-    scene.EnumerateDescendants(self, [&](entt::entity child)
-        {
-            scene.get<TransformComponent>(child).modified = true;
-        });
+    scene.GetTransformHierarchy().SetLocalScale(self, scale);
 }
@@ -0,0 +1,87 @@
+#include "Engine/Scene/Components/HierarchyComponent.hpp"
+
+#include "Engine/Scene/Scene.hpp"
+#include "Engine/Scene/TransformHierarchy.hpp"
+
+HierarchyComponent::HierarchyComponent(Scene& scene_, entt::entity self_, entt::entity parent_)
+    : scene(&scene_)
+    , self(self_)
+{
+    Assert(self != entt::null);
+
+    scene->InvalidateHierarchy();
+
+    SetParent(parent_);
+}
+
+void HierarchyComponent::SetParent(entt::entity parent_)
+{
+    if (parent == parent_)
+    {
+        return;
+    }
+
+    Unlink();
+
+    parent = parent_;
+
+    Link();
+
+    scene->GetTransformHierarchy().Reparent(self, parent);
+
+    scene->InvalidateHierarchy();
+}
+
+void HierarchyComponent::Link()
+{
+    if (parent == entt::null)
+    {
+        return;
+    }
+
+    auto& parentHc = scene->get<HierarchyComponent>(parent);
+
+    if (parentHc.lastChild != entt::null)
+    {
+        scene->get<HierarchyComponent>(parentHc.lastChild).nextSibling = self;
+    }
+    else
+    {
+        parentHc.firstChild = self;
+    }
+
+    prevSibling = parentHc.lastChild;
+
+    parentHc.lastChild = self;
+}
+
+void HierarchyComponent::Unlink()
+{
+    if (parent == entt::null)
+    {
+        return;
+    }
+
+    auto& parentHc = scene->get<HierarchyComponent>(parent);
+
+    if (prevSibling != entt::null)
+    {
+        scene->get<HierarchyComponent>(prevSibling).nextSibling = nextSibling;
+    }
+    else
+    {
+        parentHc.firstChild = nextSibling;
+    }
+
+    if (nextSibling != entt::null)
+    {
+        scene->get<HierarchyComponent>(nextSibling).prevSibling = prevSibling;
+    }
+    else
+    {
+        parentHc.lastChild = prevSibling;
+    }
+
+    prevSibling = entt::null;
+    nextSibling = entt::null;
+}
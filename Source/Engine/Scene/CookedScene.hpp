@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Engine/Render/Vulkan/Resources/TextureHelpers.hpp"
+#include "Engine/Scene/Components/CameraComponent.hpp"
+#include "Engine/Scene/Components/Components.hpp"
+#include "Engine/Scene/Lod.hpp"
+#include "Engine/Scene/Meshlet.hpp"
+
+#include "Utils/DataHelpers.hpp"
+
+// Engine-native scene blob produced by SteelCook from glTF
+// Each section is a tightly packed array of trivially copyable records, so the loader reads them in place
+namespace CookedScene
+{
+    constexpr uint32_t kMagic = 0x4C455453; // "STEL"
+    constexpr uint32_t kVersion = 4;
+
+    constexpr uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
+
+    constexpr uint64_t kSectionAlignment = 16;
+
+    constexpr std::string_view kExtension = ".steel";
+
+    enum class Section : uint32_t
+    {
+        eStrings,
+        eImageData,
+        eTextures,
+        eMaterials,
+        ePrimitives,
+        eIndices,
+        ePositions,
+        eNormals,
+        eTangents,
+        eTexCoords,
+        eMeshlets,
+        eLods,
+        eRenderObjects,
+        eCameras,
+        eLights,
+        eNodes,
+        eInstances,
+        eCount
+    };
+
+    struct Range
+    {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+    };
+
+    struct Header
+    {
+        uint32_t magic = kMagic;
+        uint32_t version = kVersion;
+        std::array<Range, static_cast<size_t>(Section::eCount)> sections;
+    };
+
+    struct Texture
+    {
+        // External images are referenced by a path relative to the blob, embedded ones by eImageData range
+        Range path;
+        Range imageData;
+        SamplerDescription sampler;
+        uint32_t hasSampler = 0;
+    };
+
+    struct Material
+    {
+        gpu::Material data;
+        uint32_t flags = 0;
+    };
+
+    struct Primitive
+    {
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+        uint32_t firstVertex = 0;
+        uint32_t vertexCount = 0;
+        uint32_t firstMeshlet = 0;
+        uint32_t meshletCount = 0;
+        uint32_t firstLod = 0;
+        uint32_t lodCount = 0;
+        AABBox bbox;
+    };
+
+    struct Camera
+    {
+        CameraLocation location;
+        CameraProjection projection;
+    };
+
+    struct Node
+    {
+        // Nodes are stored in depth-first order, so a parent always precedes its children
+        uint32_t parent = kInvalidIndex;
+        glm::mat4 transform = Matrix4::kIdentity;
+        Range name;
+        uint32_t firstRenderObject = 0;
+        uint32_t renderObjectCount = 0;
+        uint32_t firstInstance = 0;
+        uint32_t instanceCount = 0;
+        uint32_t camera = kInvalidIndex;
+        uint32_t light = kInvalidIndex;
+        Range environment;
+        Range scenePrefab;
+        Range sceneInstance;
+        Range sceneSpawn;
+    };
+
+    bool IsValid(const ByteView& data);
+
+    template <class T>
+    DataView<T> GetSection(const ByteView& data, Section section);
+
+    std::string GetString(const ByteView& data, const Range& range);
+}
+
+template <class T>
+DataView<T> CookedScene::GetSection(const ByteView& data, Section section)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    const Header& header = *reinterpret_cast<const Header*>(data.data);
+
+    const Range& range = header.sections[static_cast<size_t>(section)];
+
+    Assert(range.offset % alignof(T) == 0 && range.size % sizeof(T) == 0);
+
+    return DataView<T>(reinterpret_cast<const T*>(data.data + range.offset), range.size / sizeof(T));
+}
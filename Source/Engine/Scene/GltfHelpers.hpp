@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Utils/DataHelpers.hpp"
+
+class Filepath;
+class ThreadPool;
+struct GltfBuffers;
+class Transform;
+struct Material;
+struct MeshData;
+struct SamplerDescription;
+struct CameraLocation;
+struct CameraProjection;
+struct LightComponent;
+
+namespace tinygltf
+{
+    class Model;
+    class Node;
+    struct Sampler;
+    struct Material;
+    struct Primitive;
+    struct Camera;
+}
+
+namespace GltfHelpers
+{
+    using NodeFunc = std::function<void(int32_t nodeIndex, int32_t parentIndex)>;
+
+    // The scene file stays mapped in buffers, which the model reads its buffer data from
+    std::unique_ptr<tinygltf::Model> LoadModel(const Filepath& path, GltfBuffers& buffers);
+
+    // Views of the data held in Buffer::data, for models that weren't loaded from files
+    GltfBuffers GetOwnedBuffers(const tinygltf::Model& model);
+
+    void ReleaseBuffers(tinygltf::Model& model, GltfBuffers& buffers);
+
+    // Visits the nodes of all scenes depth-first in document order, parents always precede their children
+    void EnumerateNodes(const tinygltf::Model& model, const NodeFunc& func);
+
+    // Index of the first primitive of every mesh in the flattened primitive list
+    std::vector<uint32_t> GetPrimitiveOffsets(const tinygltf::Model& model);
+
+    SamplerDescription GetSamplerDescription(const tinygltf::Sampler& sampler);
+
+    ByteView GetBufferViewData(const tinygltf::Model& model, const GltfBuffers& buffers, int32_t bufferViewIndex);
+
+    Material RetrieveMaterial(const tinygltf::Material& gltfMaterial);
+
+    // Large primitives spread normal and tangent generation over threadPool when provided
+    MeshData RetrieveMeshData(const tinygltf::Model& model, const GltfBuffers& buffers,
+            const tinygltf::Primitive& gltfPrimitive, ThreadPool* threadPool = nullptr);
+
+    Transform RetrieveTransform(const tinygltf::Node& node);
+
+    // Per-instance transforms of EXT_mesh_gpu_instancing relative to the node, empty without the extension
+    std::vector<glm::mat4> RetrieveInstanceTransforms(const tinygltf::Model& model, const GltfBuffers& buffers,
+            const tinygltf::Node& node);
+
+    CameraLocation RetrieveCameraLocation(const tinygltf::Node& node);
+
+    CameraProjection RetrieveCameraProjection(const tinygltf::Camera& camera);
+
+    LightComponent RetrieveLight(const tinygltf::Model& model, const tinygltf::Node& node);
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Engine/Filesystem/MappedFile.hpp"
+
+#include "Utils/DataHelpers.hpp"
+
+class Filepath;
+
+namespace tinygltf
+{
+    class Model;
+}
+
+// Data of every model buffer, read in place instead of being copied into tinygltf::Buffer::data
+// Views point into the parsed file, into the external buffer files mapped here, or into Buffer::data of data uris
+struct GltfBuffers
+{
+    std::vector<ByteView> views;
+    std::vector<MappedFile> files;
+};
+
+// Fills tinygltf structures with the subset of glTF that the scene loader and cooker consume
+// The JSON is parsed in place by JsonDocument, only strings and data uris are copied into the model
+// Images are never decoded, animations, skins and sparse accessors are skipped
+namespace GltfParser
+{
+    // data is the whole .gltf or .glb file and has to outlive buffers, uris are resolved relative to directory
+    // Returns false and logs the reason if the file is malformed or a buffer can't be loaded
+    bool ParseModel(const ByteView& data, bool binary, const Filepath& directory,
+            tinygltf::Model& model, GltfBuffers& buffers);
+}
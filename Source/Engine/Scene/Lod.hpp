@@ -0,0 +1,33 @@
+#pragma once
+
+// Index range of a simplified primitive that reuses the vertices of the full detail one
+struct Lod
+{
+    uint32_t firstIndex = 0;
+    uint32_t indexCount = 0;
+
+    // Object space distance to the full detail surface
+    float error = 0.0f;
+};
+
+namespace LodHelpers
+{
+    constexpr uint32_t kMaxLodCount = 8;
+
+    // Each level aims at half of the previous triangle count
+    constexpr float kTriangleReduction = 0.5f;
+
+    // Levels that remove fewer triangles than this are not worth the extra indices
+    constexpr float kMinTriangleReduction = 0.15f;
+
+    constexpr uint32_t kMinTriangleCount = 32;
+
+    // Relative to the longest bbox edge
+    constexpr float kMaxError = 0.1f;
+
+    // Appends simplified levels after the full detail indices, the first level covers the input indices
+    std::vector<Lod> BuildLods(std::vector<uint32_t>& indices, const std::vector<glm::vec3>& positions);
+
+    // Returns the coarsest level that stays within maxError
+    uint32_t SelectLod(const std::vector<Lod>& lods, float maxError);
+}
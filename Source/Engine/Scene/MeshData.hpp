@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Engine/Scene/Lod.hpp"
+#include "Engine/Scene/Meshlet.hpp"
+
+#include "Utils/AABBox.hpp"
+#include "Utils/DataHelpers.hpp"
+
+class ThreadPool;
+
+// CPU copies of the mesh data kept once it's uploaded to the GPU
+enum class GeometryResidency
+{
+    eFull,
+    eCompact, // Full detail indices and positions for CPU queries and BLAS builds
+    eNone
+};
+
+// Mesh data in memory owned elsewhere, e.g. a mapped cooked scene
+struct MeshView
+{
+    DataView<uint32_t> indices;
+    DataView<glm::vec3> positions;
+    DataView<glm::vec3> normals;
+    DataView<glm::vec3> tangents;
+    DataView<glm::vec2> texCoords;
+
+    AABBox bbox;
+
+    DataView<Meshlet> meshlets;
+    DataView<Lod> lods;
+};
+
+// CPU geometry of a primitive and the data derived from it, processed without a device
+struct MeshData
+{
+    std::vector<uint32_t> indices;
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;
+    std::vector<glm::vec3> tangents;
+    std::vector<glm::vec2> texCoords;
+
+    AABBox bbox;
+
+    std::vector<Meshlet> meshlets;
+
+    // Levels of detail share the vertices, the first one is the full detail mesh
+    std::vector<Lod> lods;
+
+    uint32_t GetIndexCount() const { return static_cast<uint32_t>(indices.size()); }
+
+    uint32_t GetVertexCount() const { return static_cast<uint32_t>(positions.size()); }
+
+    MeshView GetView() const
+    {
+        return MeshView{
+            .indices = DataView<uint32_t>(indices),
+            .positions = DataView<glm::vec3>(positions),
+            .normals = DataView<glm::vec3>(normals),
+            .tangents = DataView<glm::vec3>(tangents),
+            .texCoords = DataView<glm::vec2>(texCoords),
+            .bbox = bbox,
+            .meshlets = DataView<Meshlet>(meshlets),
+            .lods = DataView<Lod>(lods)
+        };
+    }
+};
+
+namespace MeshDataHelpers
+{
+    // Fills in missing normals, tangents and texture coordinates, then builds bbox, meshlets and LODs
+    MeshData CreateMeshData(std::vector<uint32_t> indices,
+            std::vector<glm::vec3> positions,
+            std::vector<glm::vec3> normals = {},
+            std::vector<glm::vec3> tangents = {},
+            std::vector<glm::vec2> texCoords = {},
+            ThreadPool* threadPool = nullptr);
+
+    // Large meshes are processed in parallel when threadPool is provided, the result doesn't depend on it
+    std::vector<glm::vec3> ComputeNormals(
+            const std::vector<uint32_t>& indices,
+            const std::vector<glm::vec3>& positions,
+            ThreadPool* threadPool = nullptr);
+
+    // Averages the texture space tangents of the triangles around every vertex and orthogonalizes the result
+    // against the vertex normal (Gram-Schmidt), there is no MikkTSpace handedness or vertex splitting
+    std::vector<glm::vec3> ComputeTangents(
+            const std::vector<uint32_t>& indices,
+            const std::vector<glm::vec3>& positions,
+            const std::vector<glm::vec3>& normals,
+            const std::vector<glm::vec2>& texCoords,
+            ThreadPool* threadPool = nullptr);
+
+    AABBox ComputeBBox(const std::vector<glm::vec3>& positions);
+
+    // Keeps the first of every set of meshes with byte identical geometry
+    // Returns the new index of every input mesh
+    std::vector<uint32_t> RemoveDuplicates(std::vector<MeshData>& meshes);
+}
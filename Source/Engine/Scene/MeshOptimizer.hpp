@@ -0,0 +1,83 @@
+#pragma once
+
+// Import-time triangle and vertex reordering for indexed triangle lists
+namespace MeshOptimizer
+{
+    constexpr uint32_t kVertexCacheSize = 16;
+
+    constexpr float kOverdrawThreshold = 1.05f;
+
+    constexpr uint32_t kUnusedVertex = std::numeric_limits<uint32_t>::max();
+
+    // Position tolerance is relative to the longest bbox edge, directions and texture coordinates are absolute
+    constexpr float kWeldPositionEpsilon = 1e-5f;
+    constexpr float kWeldDirectionEpsilon = 1e-3f;
+    constexpr float kWeldTexCoordEpsilon = 1e-5f;
+
+    struct VertexCacheStatistics
+    {
+        float acmr = 0.0f; // transformed vertices per triangle
+        float atvr = 0.0f; // transformed vertices per referenced vertex
+    };
+
+    VertexCacheStatistics AnalyzeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount);
+
+    // Tipsify, Sander et al. 2007
+    std::vector<uint32_t> OptimizeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount);
+
+    // Splits cache optimized triangles into clusters and sorts them front to back relative to the mesh centroid,
+    // the cache miss ratio of every cluster stays within threshold of the input
+    std::vector<uint32_t> OptimizeOverdraw(const std::vector<uint32_t>& indices,
+            const std::vector<glm::vec3>& positions, float threshold = kOverdrawThreshold);
+
+    // Renumbers vertices in first use order and rewrites indices, returns the old to new vertex remap
+    // Unreferenced vertices are dropped and mapped to kUnusedVertex
+    std::vector<uint32_t> OptimizeVertexFetch(std::vector<uint32_t>& indices, uint32_t vertexCount);
+
+    // Merges vertices whose attributes are equal after snapping to the weld tolerance grid, empty streams are ignored
+    // Rewrites indices without the triangles that collapse and returns the old to new vertex remap
+    std::vector<uint32_t> WeldVertices(std::vector<uint32_t>& indices, const std::vector<glm::vec3>& positions,
+            const std::vector<glm::vec3>& normals, const std::vector<glm::vec3>& tangents,
+            const std::vector<glm::vec2>& texCoords);
+
+    // Quadric error edge collapse, Garland and Heckbert 1997, vertices are only collapsed onto their neighbors
+    // so the result references the input vertices, border and attribute seam vertices stay in place
+    // Stops at targetIndexCount or when the next collapse exceeds targetError, an object space distance,
+    // resultError receives the largest error of the performed collapses
+    std::vector<uint32_t> SimplifyMesh(const std::vector<uint32_t>& indices, const std::vector<glm::vec3>& positions,
+            size_t targetIndexCount, float targetError, float* resultError = nullptr);
+
+    template <class T>
+    std::vector<T> RemapVertices(const std::vector<T>& vertices, const std::vector<uint32_t>& remap);
+}
+
+template <class T>
+std::vector<T> MeshOptimizer::RemapVertices(const std::vector<T>& vertices, const std::vector<uint32_t>& remap)
+{
+    if (vertices.empty())
+    {
+        return {};
+    }
+
+    size_t vertexCount = 0;
+
+    for (const uint32_t index : remap)
+    {
+        if (index != kUnusedVertex)
+        {
+            vertexCount = std::max(vertexCount, static_cast<size_t>(index) + 1);
+        }
+    }
+
+    std::vector<T> result(vertexCount);
+
+    for (size_t i = 0; i < remap.size(); ++i)
+    {
+        if (remap[i] != kUnusedVertex)
+        {
+            result[remap[i]] = vertices[i];
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Utils/AABBox.hpp"
+#include "Utils/Helpers.hpp"
+
+// Contiguous range of primitive triangles with bounds for cluster culling
+// Meshlets are data only for now, they're built on import and cooked, but nothing culls or draws them yet
+struct Meshlet
+{
+    uint32_t firstTriangle = 0;
+    uint32_t triangleCount = 0;
+    uint32_t vertexCount = 0;
+
+    AABBox bbox;
+
+    glm::vec3 sphereCenter = Vector3::kZero;
+    float sphereRadius = 0.0f;
+
+    // The meshlet is backfacing when dot(normalize(coneApex - eye), coneAxis) >= coneCutoff, 1 disables the test
+    glm::vec3 coneApex = Vector3::kZero;
+    glm::vec3 coneAxis = Vector3::kZero;
+    float coneCutoff = 1.0f;
+};
+
+namespace MeshletHelpers
+{
+    constexpr uint32_t kMaxVertexCount = 64;
+    constexpr uint32_t kMaxTriangleCount = 124;
+
+    // Reorders triangles so that each meshlet is a contiguous index range, every triangle lands in one meshlet
+    std::vector<Meshlet> BuildMeshlets(std::vector<uint32_t>& indices, const std::vector<glm::vec3>& positions);
+
+    bool IsBackfacing(const Meshlet& meshlet, const glm::vec3& eye);
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Utils/DataHelpers.hpp"
+
+// Decoder of the meshoptimizer bitstreams used by EXT_meshopt_compression buffer views
+// Every function validates the input and returns false instead of reading or writing out of bounds
+namespace MeshoptDecoder
+{
+    enum class Mode
+    {
+        eAttributes,
+        eTriangles,
+        eIndices
+    };
+
+    enum class Filter
+    {
+        eNone,
+        eOctahedral,
+        eQuaternion,
+        eExponential
+    };
+
+    // Vertex codec, stride is a multiple of 4 up to 256 bytes
+    bool DecodeVertexBuffer(const ByteAccess& dst, size_t count, size_t stride, const ByteView& src);
+
+    // Same decoding without the SSE2 paths, the result is identical, meant for comparing against them
+    bool DecodeVertexBufferScalar(const ByteAccess& dst, size_t count, size_t stride, const ByteView& src);
+
+    // Index codec for triangle lists, indexSize is 2 or 4
+    bool DecodeIndexBuffer(const ByteAccess& dst, size_t count, size_t indexSize, const ByteView& src);
+
+    // Index codec for arbitrary index sequences, indexSize is 2 or 4
+    bool DecodeIndexSequence(const ByteAccess& dst, size_t count, size_t indexSize, const ByteView& src);
+
+    // Reverses the filter in place on decoded attributes
+    bool ApplyFilter(const ByteAccess& data, size_t count, size_t stride, Filter filter);
+
+    // Decodes a whole buffer view into count * stride bytes of dst
+    bool Decode(const ByteAccess& dst, size_t count, size_t stride, Mode mode, Filter filter, const ByteView& src);
+}
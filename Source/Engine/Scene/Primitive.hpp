@@ -1,21 +1,27 @@
 #pragma once
 
-#include "Utils/AABBox.hpp"
+#include "Engine/Render/GeometryArena.hpp"
+#include "Engine/Scene/MeshData.hpp"
 
 struct VertexInput;
 
+// GPU residency of a mesh, buffers and BLAS are created by an explicit MakeResident step
 class Primitive
 {
 public:
-    static constexpr vk::IndexType kIndexType = vk::IndexType::eUint32;
-
     static const std::vector<VertexInput> kVertexInputs;
 
-    Primitive(std::vector<uint32_t> indices_,
-            std::vector<glm::vec3> positions_,
-            std::vector<glm::vec3> normals_ = {},
-            std::vector<glm::vec3> tangents_ = {},
-            std::vector<glm::vec2> texCoords_ = {});
+    // Rows of the affine instance transform, bound right after the vertex streams
+    static const VertexInput kInstanceInput;
+
+    // Vertex streams followed by the instance stream, the input layout of the scene pipelines
+    static const std::vector<VertexInput> kInstancedVertexInputs;
+
+    explicit Primitive(MeshData meshData_);
+
+    // Uploads straight from the views, which have to stay valid until PrimitiveHelpers::MakeResident returns
+    // Only the CPU copies kept by the residency are made from them
+    explicit Primitive(const MeshView& meshView);
 
     Primitive(const Primitive& other) noexcept;
     Primitive(Primitive&& other) noexcept;
@@ -24,50 +30,74 @@ public:
 
     Primitive& operator=(Primitive other) noexcept;
 
-    uint32_t GetIndexCount() const;
+    uint32_t GetIndexCount() const { return indexCount; }
+
+    uint32_t GetVertexCount() const { return vertexCount; }
 
-    uint32_t GetVertexCount() const;
+    // GPU indices are 16-bit whenever every vertex is addressable by them, CPU indices are always 32-bit
+    vk::IndexType GetIndexType() const;
 
-    const std::vector<uint32_t>& GetIndices() const { return indices; }
-    const std::vector<glm::vec3>& GetPositions() const { return positions; }
-    const std::vector<glm::vec3>& GetNormals() const { return normals; }
-    const std::vector<glm::vec3>& GetTangents() const { return tangents; }
-    const std::vector<glm::vec2>& GetTexCoords() const { return texCoords; }
+    GeometryResidency GetResidency() const { return residency; }
 
-    const AABBox& GetBBox() const { return bbox; }
+    bool IsResident() const { return geometry.IsValid(); }
 
-    vk::Buffer GetIndexBuffer() const { return indexBuffer; }
-    vk::Buffer GetPositionBuffer() const { return positionBuffer; }
-    vk::Buffer GetNormalBuffer() const { return normalBuffer; }
-    vk::Buffer GetTangentBuffer() const { return tangentBuffer; }
-    vk::Buffer GetTexCoordBuffer() const { return texCoordBuffer; }
+    // CPU copy of the geometry, compact residency keeps only the full detail indices and positions of it
+    // Primitives created from views have no copies of the streams until MakeResident returns
+    const MeshData& GetMeshData() const { return meshData; }
+
+    const AABBox& GetBBox() const { return meshData.bbox; }
+
+    const std::vector<Lod>& GetLods() const { return meshData.lods; }
+
+    // Maps uploaded positions to object space as position * w + xyz, identity unless vertices are quantized
+    glm::vec4 GetPositionTransform() const;
+
+    // Ranges of the geometry arena buffers, shaders pull the attributes through them
+    vk::DescriptorBufferInfo GetIndexBufferInfo() const;
+    vk::DescriptorBufferInfo GetNormalBufferInfo() const;
+    vk::DescriptorBufferInfo GetTangentBufferInfo() const;
+    vk::DescriptorBufferInfo GetTexCoordBufferInfo() const;
 
     vk::AccelerationStructureKHR GetBlas() const { return blas; }
 
-    void Draw(vk::CommandBuffer commandBuffer) const;
+    // Uploads the geometry to the arena, the BLAS is generated separately once the upload is executed
+    void CreateBuffers(vk::CommandBuffer commandBuffer);
+
+    void GenerateBlas();
+
+    // Drops CPU copies that the residency doesn't keep, buffers and BLAS have to be created before
+    // Primitives created from views copy what the residency keeps and stop referencing them
+    void ReleaseGeometry(GeometryResidency targetResidency);
+
+    // Draws sharing the binding only rebind buffers when the primitive lives in another arena page
+    // Instances are read from the instance stream, which has to be bound by the caller
+    void Draw(vk::CommandBuffer commandBuffer, GeometryBinding& binding, uint32_t lod = 0,
+            uint32_t instanceCount = 1, uint32_t firstInstance = 0) const;
 
 private:
-    std::vector<uint32_t> indices;
-    std::vector<glm::vec3> positions;
-    std::vector<glm::vec3> normals;
-    std::vector<glm::vec3> tangents;
-    std::vector<glm::vec2> texCoords;
+    MeshData meshData;
 
-    AABBox bbox;
+    std::optional<MeshView> externalGeometry;
 
-    vk::Buffer indexBuffer;
-    vk::Buffer positionBuffer;
-    vk::Buffer normalBuffer;
-    vk::Buffer tangentBuffer;
-    vk::Buffer texCoordBuffer;
+    uint32_t indexCount = 0;
+    uint32_t vertexCount = 0;
 
-    vk::AccelerationStructureKHR blas;
+    GeometryResidency residency = GeometryResidency::eFull;
 
-    void CreateBuffers();
+    GeometryAllocation geometry;
 
-    void GenerateBlas();
+    vk::AccelerationStructureKHR blas;
 
     void DestroyBuffers() const;
 
     void DestroyBlas() const;
+
+    MeshView GetGeometryView() const;
 };
+
+namespace PrimitiveHelpers
+{
+    // Uploads all primitives in one batch, then generates BLASes and releases CPU copies
+    // that the configured residency doesn't keep
+    void MakeResident(std::vector<Primitive>& primitives);
+}
@@ -0,0 +1,35 @@
+#include "Engine/Scene/CookedScene.hpp"
+
+bool CookedScene::IsValid(const ByteView& data)
+{
+    if (data.size < sizeof(Header))
+    {
+        return false;
+    }
+
+    const Header& header = *reinterpret_cast<const Header*>(data.data);
+
+    if (header.magic != kMagic || header.version != kVersion)
+    {
+        return false;
+    }
+
+    for (const Range& range : header.sections)
+    {
+        if (range.offset % kSectionAlignment != 0 || range.offset + range.size > data.size)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::string CookedScene::GetString(const ByteView& data, const Range& range)
+{
+    const DataView<char> strings = GetSection<char>(data, Section::eStrings);
+
+    Assert(range.offset + range.size <= strings.size);
+
+    return std::string(strings.data + range.offset, range.size);
+}
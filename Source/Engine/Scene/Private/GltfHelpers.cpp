@@ -0,0 +1,804 @@
+PRAGMA_DISABLE_WARNINGS
+#define TINYGLTF_IMPLEMENTATION
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#define TINYGLTF_USE_CPP14
+#include <tiny_gltf.h>
+PRAGMA_ENABLE_WARNINGS
+
+#include "Engine/Scene/GltfHelpers.hpp"
+
+#include "Engine/Filesystem/MappedFile.hpp"
+#include "Engine/Scene/Components/Components.hpp"
+#include "Engine/Scene/Components/CameraComponent.hpp"
+#include "Engine/Scene/GltfParser.hpp"
+#include "Engine/Scene/MeshData.hpp"
+#include "Engine/Scene/MeshOptimizer.hpp"
+#include "Engine/Scene/MeshoptDecoder.hpp"
+
+#include "Utils/Assert.hpp"
+#include "Utils/Helpers.hpp"
+#include "Utils/TimeHelpers.hpp"
+
+namespace Details
+{
+    static constexpr const char* kMeshoptExtension = "EXT_meshopt_compression";
+    static constexpr const char* kInstancingExtension = "EXT_mesh_gpu_instancing";
+
+    static constexpr size_t kDecodedViewAlignment = 16;
+
+    static vk::Filter GetSamplerFilter(int32_t filter)
+    {
+        switch (filter)
+        {
+        case TINYGLTF_TEXTURE_FILTER_NEAREST:
+        case TINYGLTF_TEXTURE_FILTER_NEAREST_MIPMAP_NEAREST:
+        case TINYGLTF_TEXTURE_FILTER_NEAREST_MIPMAP_LINEAR:
+            return vk::Filter::eNearest;
+        case TINYGLTF_TEXTURE_FILTER_LINEAR:
+        case TINYGLTF_TEXTURE_FILTER_LINEAR_MIPMAP_NEAREST:
+        case TINYGLTF_TEXTURE_FILTER_LINEAR_MIPMAP_LINEAR:
+            return vk::Filter::eLinear;
+        default:
+            return vk::Filter::eLinear;
+        }
+    }
+
+    static vk::SamplerMipmapMode GetSamplerMipmapMode(int32_t filter)
+    {
+        switch (filter)
+        {
+        case TINYGLTF_TEXTURE_FILTER_NEAREST:
+        case TINYGLTF_TEXTURE_FILTER_NEAREST_MIPMAP_NEAREST:
+        case TINYGLTF_TEXTURE_FILTER_LINEAR:
+        case TINYGLTF_TEXTURE_FILTER_LINEAR_MIPMAP_NEAREST:
+            return vk::SamplerMipmapMode::eNearest;
+        case TINYGLTF_TEXTURE_FILTER_NEAREST_MIPMAP_LINEAR:
+        case TINYGLTF_TEXTURE_FILTER_LINEAR_MIPMAP_LINEAR:
+            return vk::SamplerMipmapMode::eLinear;
+        default:
+            return vk::SamplerMipmapMode::eLinear;
+        }
+    }
+
+    static vk::SamplerAddressMode GetSamplerAddressMode(int32_t wrap)
+    {
+        switch (wrap)
+        {
+        case TINYGLTF_TEXTURE_WRAP_REPEAT:
+            return vk::SamplerAddressMode::eRepeat;
+        case TINYGLTF_TEXTURE_WRAP_CLAMP_TO_EDGE:
+            return vk::SamplerAddressMode::eClampToEdge;
+        case TINYGLTF_TEXTURE_WRAP_MIRRORED_REPEAT:
+            return vk::SamplerAddressMode::eMirroredRepeat;
+        default:
+            return vk::SamplerAddressMode::eRepeat;
+        }
+    }
+
+    static vk::IndexType GetIndexType(int32_t componentType)
+    {
+        switch (componentType)
+        {
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+            return vk::IndexType::eUint16;
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+            return vk::IndexType::eUint32;
+        default:
+            Assert(false);
+            return {};
+        }
+    }
+
+    template <glm::length_t L>
+    static glm::vec<L, float, glm::defaultp> GetVec(const std::vector<double>& values)
+    {
+        const glm::length_t valueCount = static_cast<glm::length_t>(values.size());
+
+        glm::vec<L, float, glm::defaultp> result(0.0f);
+
+        for (glm::length_t i = 0; i < valueCount && i < L; ++i)
+        {
+            result[i] = static_cast<float>(values[i]);
+        }
+
+        return result;
+    }
+
+    static glm::quat GetQuaternion(const std::vector<double>& values)
+    {
+        Assert(values.size() == 4);
+
+        glm::quat quat;
+        quat.x = static_cast<float>(values[0]);
+        quat.y = static_cast<float>(values[1]);
+        quat.z = static_cast<float>(values[2]);
+        quat.w = static_cast<float>(values[3]);
+
+        return quat;
+    }
+
+    static size_t GetAccessorValueSize(const tinygltf::Accessor& accessor)
+    {
+        const int32_t count = tinygltf::GetNumComponentsInType(accessor.type);
+        Assert(count >= 0);
+
+        const int32_t size = tinygltf::GetComponentSizeInBytes(accessor.componentType);
+        Assert(size >= 0);
+
+        return static_cast<size_t>(count) * static_cast<size_t>(size);
+    }
+
+    // Reads TSrc from the head of every accessor element and stores it as TDst, which de-interleaves
+    // strided buffer views and drops unused trailing components (e.g. the w of vec4 tangents)
+    template <class TSrc, class TDst = TSrc>
+    static std::vector<TDst> GatherAccessorData(const tinygltf::Model& model, const GltfBuffers& buffers,
+            const tinygltf::Accessor& accessor)
+    {
+        EASY_FUNCTION()
+
+        static_assert(std::is_trivially_copyable_v<TSrc> && std::is_trivially_copyable_v<TDst>);
+
+        const tinygltf::BufferView& bufferView = model.bufferViews[accessor.bufferView];
+        const ByteView& buffer = buffers.views[bufferView.buffer];
+
+        const size_t valueSize = GetAccessorValueSize(accessor);
+        const size_t stride = bufferView.byteStride != 0 ? bufferView.byteStride : valueSize;
+
+        Assert(sizeof(TSrc) <= valueSize && valueSize <= stride);
+
+        const size_t offset = bufferView.byteOffset + accessor.byteOffset;
+        const size_t count = accessor.count;
+
+        Assert(count == 0 || offset + (count - 1) * stride + valueSize <= buffer.size);
+
+        const uint8_t* src = buffer.data + offset;
+
+        std::vector<TDst> data(count);
+
+        if constexpr (std::is_same_v<TSrc, TDst>)
+        {
+            CopyStrided(src, stride, sizeof(TSrc), count, reinterpret_cast<uint8_t*>(data.data()));
+
+            return data;
+        }
+
+        // Converting gathers widen one element at a time
+        for (size_t i = 0; i < count; ++i)
+        {
+            TSrc value;
+            std::memcpy(&value, src + i * stride, sizeof(TSrc));
+
+            data[i] = static_cast<TDst>(value);
+        }
+
+        return data;
+    }
+
+    // Integer attributes of KHR_mesh_quantization are converted to float right in the gathered data
+    // Unnormalized values are kept as is, the node transform of quantized meshes carries their scale and offset
+    template <class T, class TComponent>
+    static std::vector<T> GatherQuantizedAccessorData(const tinygltf::Model& model, const GltfBuffers& buffers,
+            const tinygltf::Accessor& accessor)
+    {
+        using TSrc = glm::vec<T::length(), TComponent, glm::defaultp>;
+
+        std::vector<T> data = GatherAccessorData<TSrc, T>(model, buffers, accessor);
+
+        if (accessor.normalized)
+        {
+            // Branch-free pass over the flat float components, the compiler vectorizes it
+            // Signed values map to [-1, 1] with the most negative one clamped, unsigned ones to [0, 1]
+            constexpr float scale = 1.0f / static_cast<float>(std::numeric_limits<TComponent>::max());
+
+            float* components = reinterpret_cast<float*>(data.data());
+            const size_t componentCount = data.size() * T::length();
+
+            for (size_t i = 0; i < componentCount; ++i)
+            {
+                components[i] = std::max(components[i] * scale, -1.0f);
+            }
+        }
+
+        return data;
+    }
+
+    template <class T>
+    static std::vector<T> RetrieveAccessorData(const tinygltf::Model& model, const GltfBuffers& buffers,
+            const tinygltf::Accessor& accessor)
+    {
+        switch (accessor.componentType)
+        {
+        case TINYGLTF_COMPONENT_TYPE_FLOAT:
+            return GatherAccessorData<T>(model, buffers, accessor);
+        case TINYGLTF_COMPONENT_TYPE_BYTE:
+            return GatherQuantizedAccessorData<T, int8_t>(model, buffers, accessor);
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+            return GatherQuantizedAccessorData<T, uint8_t>(model, buffers, accessor);
+        case TINYGLTF_COMPONENT_TYPE_SHORT:
+            return GatherQuantizedAccessorData<T, int16_t>(model, buffers, accessor);
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+            return GatherQuantizedAccessorData<T, uint16_t>(model, buffers, accessor);
+        default:
+            Assert(false);
+            return {};
+        }
+    }
+
+    template <class T>
+    static std::vector<T> RetrieveAttribute(const tinygltf::Model& model, const GltfBuffers& buffers,
+            const tinygltf::Primitive& gltfPrimitive, const std::string& attributeName)
+    {
+        if (gltfPrimitive.attributes.contains(attributeName))
+        {
+            const tinygltf::Accessor& accessor = model.accessors[gltfPrimitive.attributes.at(attributeName)];
+
+            return RetrieveAccessorData<T>(model, buffers, accessor);
+        }
+
+        return {};
+    }
+
+    template <class T>
+    static std::vector<T> RetrieveInstanceAttribute(const tinygltf::Model& model, const GltfBuffers& buffers,
+            const tinygltf::Value& attributes, const std::string& attributeName)
+    {
+        if (attributes.Has(attributeName))
+        {
+            const int32_t accessorIndex = attributes.Get(attributeName).Get<int32_t>();
+
+            Assert(accessorIndex >= 0 && accessorIndex < static_cast<int32_t>(model.accessors.size()));
+
+            return RetrieveAccessorData<T>(model, buffers, model.accessors[accessorIndex]);
+        }
+
+        return {};
+    }
+
+    static size_t GetExtensionSize(const tinygltf::Value& extension, const char* key, size_t defaultValue = 0)
+    {
+        const tinygltf::Value& value = extension.Get(key);
+
+        if (!value.IsNumber())
+        {
+            return defaultValue;
+        }
+
+        const double number = value.GetNumberAsDouble();
+        Assert(number >= 0.0);
+
+        return static_cast<size_t>(number);
+    }
+
+    static MeshoptDecoder::Mode GetMeshoptMode(const std::string& mode)
+    {
+        if (mode == "TRIANGLES")
+        {
+            return MeshoptDecoder::Mode::eTriangles;
+        }
+        if (mode == "INDICES")
+        {
+            return MeshoptDecoder::Mode::eIndices;
+        }
+
+        Assert(mode == "ATTRIBUTES");
+        return MeshoptDecoder::Mode::eAttributes;
+    }
+
+    static MeshoptDecoder::Filter GetMeshoptFilter(const std::string& filter)
+    {
+        if (filter == "OCTAHEDRAL")
+        {
+            return MeshoptDecoder::Filter::eOctahedral;
+        }
+        if (filter == "QUATERNION")
+        {
+            return MeshoptDecoder::Filter::eQuaternion;
+        }
+        if (filter == "EXPONENTIAL")
+        {
+            return MeshoptDecoder::Filter::eExponential;
+        }
+
+        Assert(filter.empty() || filter == "NONE");
+        return MeshoptDecoder::Filter::eNone;
+    }
+
+    // Decodes all compressed buffer views into one new buffer and redirects the views to it
+    static void DecodeCompressedBufferViews(tinygltf::Model& model, GltfBuffers& buffers)
+    {
+        EASY_FUNCTION()
+
+        struct CompressedView
+        {
+            tinygltf::BufferView* bufferView = nullptr;
+            ByteView data;
+            size_t count = 0;
+            size_t stride = 0;
+            MeshoptDecoder::Mode mode = MeshoptDecoder::Mode::eAttributes;
+            MeshoptDecoder::Filter filter = MeshoptDecoder::Filter::eNone;
+            size_t offset = 0;
+        };
+
+        std::vector<CompressedView> compressedViews;
+
+        size_t compressedSize = 0;
+        size_t decodedSize = 0;
+
+        for (tinygltf::BufferView& bufferView : model.bufferViews)
+        {
+            const auto it = bufferView.extensions.find(kMeshoptExtension);
+
+            if (it == bufferView.extensions.end())
+            {
+                continue;
+            }
+
+            const tinygltf::Value& extension = it->second;
+
+            const int32_t bufferIndex = extension.Get("buffer").GetNumberAsInt();
+            Assert(bufferIndex >= 0 && bufferIndex < static_cast<int32_t>(buffers.views.size()));
+
+            const ByteView& buffer = buffers.views[bufferIndex];
+
+            const size_t byteOffset = GetExtensionSize(extension, "byteOffset");
+            const size_t byteLength = GetExtensionSize(extension, "byteLength");
+
+            Assert(byteOffset <= buffer.size && byteLength <= buffer.size - byteOffset);
+
+            CompressedView view{
+                .bufferView = &bufferView,
+                .data = ByteView(buffer.data + byteOffset, byteLength),
+                .count = GetExtensionSize(extension, "count"),
+                .stride = GetExtensionSize(extension, "byteStride"),
+                .mode = GetMeshoptMode(extension.Get("mode").Get<std::string>()),
+                .filter = GetMeshoptFilter(extension.Get("filter").Get<std::string>()),
+                .offset = decodedSize
+            };
+
+            Assert(view.stride > 0 && view.count <= std::numeric_limits<uint32_t>::max());
+            Assert(bufferView.byteLength <= view.count * view.stride);
+
+            compressedSize += byteLength;
+            decodedSize += (view.count * view.stride + kDecodedViewAlignment - 1)
+                    / kDecodedViewAlignment * kDecodedViewAlignment;
+
+            compressedViews.push_back(view);
+        }
+
+        if (compressedViews.empty())
+        {
+            return;
+        }
+
+        const float startSeconds = Timer::GetGlobalSeconds();
+
+        tinygltf::Buffer decodedBuffer;
+        decodedBuffer.name = kMeshoptExtension;
+        decodedBuffer.data.resize(decodedSize);
+
+        const int32_t decodedBufferIndex = static_cast<int32_t>(model.buffers.size());
+
+        for (const CompressedView& view : compressedViews)
+        {
+            const ByteAccess dst(decodedBuffer.data.data() + view.offset, view.count * view.stride);
+
+            const bool decoded = MeshoptDecoder::Decode(dst, view.count, view.stride, view.mode, view.filter, view.data);
+
+            if (!decoded)
+            {
+                LogE << "Failed to decode " << kMeshoptExtension << " buffer view: " << view.bufferView->name << "\n";
+            }
+
+            Assert(decoded);
+
+            view.bufferView->buffer = decodedBufferIndex;
+            view.bufferView->byteOffset = view.offset;
+        }
+
+        buffers.views.emplace_back(decodedBuffer.data.data(), decodedBuffer.data.size());
+
+        model.buffers.push_back(std::move(decodedBuffer));
+
+        const float decodeSeconds = Timer::GetGlobalSeconds() - startSeconds;
+
+        LogI << Format("Buffer views decoded: %zu, %.1f MB -> %.1f MB in %.3f s (%.0f MB/s)\n",
+                compressedViews.size(), static_cast<float>(compressedSize) / 1e6f,
+                static_cast<float>(decodedSize) / 1e6f, decodeSeconds,
+                static_cast<float>(decodedSize) / 1e6f / std::max(decodeSeconds, 1e-6f));
+    }
+
+    static void OptimizeGeometry(std::vector<uint32_t>& indices, std::vector<glm::vec3>& positions,
+            std::vector<glm::vec3>& normals, std::vector<glm::vec3>& tangents, std::vector<glm::vec2>& texCoords)
+    {
+        EASY_FUNCTION()
+
+        const uint32_t inputVertexCount = static_cast<uint32_t>(positions.size());
+
+        const MeshOptimizer::VertexCacheStatistics inputStatistics
+                = MeshOptimizer::AnalyzeVertexCache(indices, inputVertexCount);
+
+        // Missing normals and tangents are generated after welding, so float noise doesn't split their smoothing
+        const std::vector<uint32_t> weldRemap
+                = MeshOptimizer::WeldVertices(indices, positions, normals, tangents, texCoords);
+
+        positions = MeshOptimizer::RemapVertices(positions, weldRemap);
+        normals = MeshOptimizer::RemapVertices(normals, weldRemap);
+        tangents = MeshOptimizer::RemapVertices(tangents, weldRemap);
+        texCoords = MeshOptimizer::RemapVertices(texCoords, weldRemap);
+
+        const uint32_t vertexCount = static_cast<uint32_t>(positions.size());
+
+        indices = MeshOptimizer::OptimizeVertexCache(indices, vertexCount);
+        indices = MeshOptimizer::OptimizeOverdraw(indices, positions);
+
+        const std::vector<uint32_t> remap = MeshOptimizer::OptimizeVertexFetch(indices, vertexCount);
+
+        positions = MeshOptimizer::RemapVertices(positions, remap);
+        normals = MeshOptimizer::RemapVertices(normals, remap);
+        tangents = MeshOptimizer::RemapVertices(tangents, remap);
+        texCoords = MeshOptimizer::RemapVertices(texCoords, remap);
+
+        const MeshOptimizer::VertexCacheStatistics outputStatistics
+                = MeshOptimizer::AnalyzeVertexCache(indices, static_cast<uint32_t>(positions.size()));
+
+        LogD << Format("Primitive optimized: vertices %u -> %zu, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f\n",
+                inputVertexCount, positions.size(), inputStatistics.acmr, outputStatistics.acmr,
+                inputStatistics.atvr, outputStatistics.atvr);
+    }
+}
+
+std::unique_ptr<tinygltf::Model> GltfHelpers::LoadModel(const Filepath& path, GltfBuffers& buffers)
+{
+    EASY_FUNCTION()
+
+    const float startSeconds = Timer::GetGlobalSeconds();
+
+    auto model = std::make_unique<tinygltf::Model>();
+
+    const bool binary = path.GetExtension() == ".glb";
+
+    // The JSON is parsed straight from the mapping and buffers are read in place, so nothing is copied
+    // Fallback buffers of EXT_meshopt_compression are left empty by the parser
+    MappedFile file(path);
+
+    const bool result = file.IsValid()
+            && GltfParser::ParseModel(file.GetData(), binary, Filepath(path.GetDirectory()), *model, buffers);
+
+    Assert(result);
+
+    buffers.files.push_back(std::move(file));
+
+    const float parseSeconds = Timer::GetGlobalSeconds() - startSeconds;
+
+    LogI << "Scene parsed: " << path.GetFilename() << " in " << Format("%.3f", parseSeconds) << " s\n";
+
+    Details::DecodeCompressedBufferViews(*model, buffers);
+
+    return model;
+}
+
+GltfBuffers GltfHelpers::GetOwnedBuffers(const tinygltf::Model& model)
+{
+    GltfBuffers buffers;
+    buffers.views.reserve(model.buffers.size());
+
+    for (const auto& buffer : model.buffers)
+    {
+        buffers.views.emplace_back(buffer.data);
+    }
+
+    return buffers;
+}
+
+void GltfHelpers::ReleaseBuffers(tinygltf::Model& model, GltfBuffers& buffers)
+{
+    EASY_FUNCTION()
+
+    for (auto& buffer : model.buffers)
+    {
+        buffer.data.clear();
+        buffer.data.shrink_to_fit();
+    }
+
+    buffers.views.clear();
+    buffers.files.clear();
+}
+
+void GltfHelpers::EnumerateNodes(const tinygltf::Model& model, const NodeFunc& func)
+{
+    std::vector<std::pair<int32_t, int32_t>> stack;
+
+    for (auto scene = model.scenes.rbegin(); scene != model.scenes.rend(); ++scene)
+    {
+        for (auto nodeIndex = scene->nodes.rbegin(); nodeIndex != scene->nodes.rend(); ++nodeIndex)
+        {
+            stack.emplace_back(*nodeIndex, -1);
+        }
+    }
+
+    while (!stack.empty())
+    {
+        const auto [nodeIndex, parentIndex] = stack.back();
+        stack.pop_back();
+
+        func(nodeIndex, parentIndex);
+
+        const tinygltf::Node& node = model.nodes[nodeIndex];
+
+        for (auto childIndex = node.children.rbegin(); childIndex != node.children.rend(); ++childIndex)
+        {
+            stack.emplace_back(*childIndex, nodeIndex);
+        }
+    }
+}
+
+std::vector<uint32_t> GltfHelpers::GetPrimitiveOffsets(const tinygltf::Model& model)
+{
+    std::vector<uint32_t> primitiveOffsets(model.meshes.size(), 0);
+
+    uint32_t primitiveCount = 0;
+
+    for (size_t i = 0; i < model.meshes.size(); ++i)
+    {
+        primitiveOffsets[i] = primitiveCount;
+
+        primitiveCount += static_cast<uint32_t>(model.meshes[i].primitives.size());
+    }
+
+    return primitiveOffsets;
+}
+
+SamplerDescription GltfHelpers::GetSamplerDescription(const tinygltf::Sampler& sampler)
+{
+    return SamplerDescription{
+        .magFilter = Details::GetSamplerFilter(sampler.magFilter),
+        .minFilter = Details::GetSamplerFilter(sampler.minFilter),
+        .mipmapMode = Details::GetSamplerMipmapMode(sampler.magFilter),
+        .addressMode = Details::GetSamplerAddressMode(sampler.wrapS)
+    };
+}
+
+ByteView GltfHelpers::GetBufferViewData(const tinygltf::Model& model, const GltfBuffers& buffers,
+        int32_t bufferViewIndex)
+{
+    const tinygltf::BufferView& bufferView = model.bufferViews[bufferViewIndex];
+    const ByteView& buffer = buffers.views[bufferView.buffer];
+
+    return ByteView(buffer.data + bufferView.byteOffset, bufferView.byteLength);
+}
+
+Material GltfHelpers::RetrieveMaterial(const tinygltf::Material& gltfMaterial)
+{
+    Assert(gltfMaterial.pbrMetallicRoughness.baseColorTexture.texCoord == 0);
+    Assert(gltfMaterial.pbrMetallicRoughness.metallicRoughnessTexture.texCoord == 0);
+    Assert(gltfMaterial.normalTexture.texCoord == 0);
+    Assert(gltfMaterial.occlusionTexture.texCoord == 0);
+    Assert(gltfMaterial.emissiveTexture.texCoord == 0);
+
+    Material material{};
+
+    material.data.baseColorTexture = gltfMaterial.pbrMetallicRoughness.baseColorTexture.index;
+    material.data.roughnessMetallicTexture = gltfMaterial.pbrMetallicRoughness.metallicRoughnessTexture.index;
+    material.data.normalTexture = gltfMaterial.normalTexture.index;
+    material.data.occlusionTexture = gltfMaterial.occlusionTexture.index;
+    material.data.emissionTexture = gltfMaterial.emissiveTexture.index;
+
+    material.data.baseColorFactor = Details::GetVec<4>(gltfMaterial.pbrMetallicRoughness.baseColorFactor);
+    material.data.emissionFactor = Details::GetVec<4>(gltfMaterial.emissiveFactor);
+
+    material.data.roughnessFactor = static_cast<float>(gltfMaterial.pbrMetallicRoughness.roughnessFactor);
+    material.data.metallicFactor = static_cast<float>(gltfMaterial.pbrMetallicRoughness.metallicFactor);
+    material.data.normalScale = static_cast<float>(gltfMaterial.normalTexture.scale);
+    material.data.occlusionStrength = static_cast<float>(gltfMaterial.occlusionTexture.strength);
+    material.data.alphaCutoff = static_cast<float>(gltfMaterial.alphaCutoff);
+
+    if (gltfMaterial.alphaMode == "MASK")
+    {
+        material.flags |= MaterialFlagBits::eAlphaTest;
+    }
+    if (gltfMaterial.alphaMode == "BLEND")
+    {
+        material.flags |= MaterialFlagBits::eAlphaBlend;
+    }
+    if (gltfMaterial.doubleSided)
+    {
+        material.flags |= MaterialFlagBits::eDoubleSided;
+    }
+    if (gltfMaterial.normalTexture.index >= 0)
+    {
+        material.flags |= MaterialFlagBits::eNormalMapping;
+    }
+
+    return material;
+}
+
+MeshData GltfHelpers::RetrieveMeshData(const tinygltf::Model& model, const GltfBuffers& buffers,
+        const tinygltf::Primitive& gltfPrimitive, ThreadPool* threadPool)
+{
+    Assert(gltfPrimitive.indices >= 0);
+    const tinygltf::Accessor& indicesAccessor = model.accessors[gltfPrimitive.indices];
+
+    std::vector<uint32_t> indices;
+
+    if (Details::GetIndexType(indicesAccessor.componentType) == vk::IndexType::eUint32)
+    {
+        indices = Details::GatherAccessorData<uint32_t>(model, buffers, indicesAccessor);
+    }
+    else
+    {
+        indices = Details::GatherAccessorData<uint16_t, uint32_t>(model, buffers, indicesAccessor);
+    }
+
+    std::vector<glm::vec3> positions
+            = Details::RetrieveAttribute<glm::vec3>(model, buffers, gltfPrimitive, "POSITION");
+    std::vector<glm::vec3> normals
+            = Details::RetrieveAttribute<glm::vec3>(model, buffers, gltfPrimitive, "NORMAL");
+    std::vector<glm::vec3> tangents
+            = Details::RetrieveAttribute<glm::vec3>(model, buffers, gltfPrimitive, "TANGENT");
+    std::vector<glm::vec2> texCoords
+            = Details::RetrieveAttribute<glm::vec2>(model, buffers, gltfPrimitive, "TEXCOORD_0");
+
+    Details::OptimizeGeometry(indices, positions, normals, tangents, texCoords);
+
+    return MeshDataHelpers::CreateMeshData(std::move(indices), std::move(positions),
+            std::move(normals), std::move(tangents), std::move(texCoords), threadPool);
+}
+
+Transform GltfHelpers::RetrieveTransform(const tinygltf::Node& node)
+{
+    Transform transform;
+
+    if (!node.matrix.empty())
+    {
+        const glm::mat4 matrix = glm::make_mat4(node.matrix.data());
+
+        transform = Transform(matrix);
+    }
+
+    if (!node.scale.empty())
+    {
+        transform.SetScale(Details::GetVec<3>(node.scale));
+    }
+
+    if (!node.rotation.empty())
+    {
+        transform.SetRotation(Details::GetQuaternion(node.rotation));
+    }
+
+    if (!node.translation.empty())
+    {
+        transform.SetTranslation(Details::GetVec<3>(node.translation));
+    }
+
+    return transform;
+}
+
+std::vector<glm::mat4> GltfHelpers::RetrieveInstanceTransforms(const tinygltf::Model& model,
+        const GltfBuffers& buffers, const tinygltf::Node& node)
+{
+    const auto it = node.extensions.find(Details::kInstancingExtension);
+
+    if (it == node.extensions.end() || !it->second.Has("attributes"))
+    {
+        return {};
+    }
+
+    EASY_FUNCTION()
+
+    const tinygltf::Value& attributes = it->second.Get("attributes");
+
+    const std::vector<glm::vec3> translations
+            = Details::RetrieveInstanceAttribute<glm::vec3>(model, buffers, attributes, "TRANSLATION");
+    const std::vector<glm::vec4> rotations
+            = Details::RetrieveInstanceAttribute<glm::vec4>(model, buffers, attributes, "ROTATION");
+    const std::vector<glm::vec3> scales
+            = Details::RetrieveInstanceAttribute<glm::vec3>(model, buffers, attributes, "SCALE");
+
+    const size_t count = std::max({ translations.size(), rotations.size(), scales.size() });
+
+    Assert(translations.empty() || translations.size() == count);
+    Assert(rotations.empty() || rotations.size() == count);
+    Assert(scales.empty() || scales.size() == count);
+
+    std::vector<glm::mat4> transforms(count, Matrix4::kIdentity);
+
+    // Composed in place as T * R * S, quantized rotations are renormalized
+    for (size_t i = 0; i < count; ++i)
+    {
+        glm::mat4& transform = transforms[i];
+
+        if (!rotations.empty())
+        {
+            const glm::vec4& r = rotations[i];
+
+            transform = glm::toMat4(glm::normalize(glm::quat(r.w, r.x, r.y, r.z)));
+        }
+
+        if (!scales.empty())
+        {
+            transform[0] *= scales[i].x;
+            transform[1] *= scales[i].y;
+            transform[2] *= scales[i].z;
+        }
+
+        if (!translations.empty())
+        {
+            transform[3] = glm::vec4(translations[i], 1.0f);
+        }
+    }
+
+    return transforms;
+}
+
+CameraLocation GltfHelpers::RetrieveCameraLocation(const tinygltf::Node& node)
+{
+    glm::quat rotation = glm::quat();
+    if (!node.rotation.empty())
+    {
+        rotation = Details::GetQuaternion(node.rotation);
+    }
+
+    const glm::vec3 position = Details::GetVec<3>(node.translation);
+    const glm::vec3 direction = rotation * Direction::kForward;
+    const glm::vec3 up = Direction::kUp;
+
+    return CameraLocation{ position, direction, up };
+}
+
+CameraProjection GltfHelpers::RetrieveCameraProjection(const tinygltf::Camera& camera)
+{
+    if (camera.type == "perspective")
+    {
+        const tinygltf::PerspectiveCamera& perspectiveCamera = camera.perspective;
+
+        return CameraProjection{
+            static_cast<float>(perspectiveCamera.yfov),
+            static_cast<float>(perspectiveCamera.aspectRatio), 1.0f,
+            static_cast<float>(perspectiveCamera.znear),
+            static_cast<float>(perspectiveCamera.zfar),
+        };
+    }
+
+    if (camera.type == "orthographic")
+    {
+        const tinygltf::OrthographicCamera& orthographicCamera = camera.orthographic;
+
+        return CameraProjection{
+            0.0f,
+            static_cast<float>(orthographicCamera.xmag),
+            static_cast<float>(orthographicCamera.ymag),
+            static_cast<float>(orthographicCamera.znear),
+            static_cast<float>(orthographicCamera.zfar),
+        };
+    }
+
+    return Config::DefaultCamera::kProjection;
+}
+
+LightComponent GltfHelpers::RetrieveLight(const tinygltf::Model& model, const tinygltf::Node& node)
+{
+    const int32_t lightIndex = node.extensions.at("KHR_lights_punctual").Get("light").Get<int32_t>();
+
+    Assert(lightIndex >= 0);
+
+    const tinygltf::Light& light = model.lights[lightIndex];
+
+    LightComponent lightComponent;
+
+    if (light.type == "directional")
+    {
+        lightComponent.type = LightType::eDirectional;
+    }
+    else if (light.type == "point")
+    {
+        lightComponent.type = LightType::ePoint;
+    }
+    else
+    {
+        Assert(false);
+    }
+
+    lightComponent.color = Details::GetVec<3>(light.color) * static_cast<float>(light.intensity);
+
+    return lightComponent;
+}
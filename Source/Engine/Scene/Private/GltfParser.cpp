@@ -0,0 +1,788 @@
+PRAGMA_DISABLE_WARNINGS
+#include <tiny_gltf.h>
+PRAGMA_ENABLE_WARNINGS
+
+#include <charconv>
+
+#include "Engine/Scene/GltfParser.hpp"
+
+#include "Engine/Filesystem/Filepath.hpp"
+#include "Engine/Filesystem/MappedFile.hpp"
+
+#include "Utils/Assert.hpp"
+#include "Utils/Json.hpp"
+
+namespace Details
+{
+    static constexpr uint32_t kGlbMagic = 0x46546C67;
+    static constexpr uint32_t kGlbVersion = 2;
+    static constexpr uint32_t kGlbHeaderSize = 12;
+    static constexpr uint32_t kGlbChunkHeaderSize = 8;
+    static constexpr uint32_t kGlbJsonChunkType = 0x4E4F534A;
+    static constexpr uint32_t kGlbBinChunkType = 0x004E4942;
+
+    static constexpr std::string_view kDataUriPrefix = "data:";
+    static constexpr std::string_view kBase64Marker = ";base64,";
+
+    static constexpr const char* kLightsExtension = "KHR_lights_punctual";
+    static constexpr const char* kMeshoptExtension = "EXT_meshopt_compression";
+
+    struct GlbChunks
+    {
+        ByteView json;
+        ByteView bin;
+    };
+
+    static uint32_t ReadUint32(const ByteView& data, size_t offset)
+    {
+        uint32_t value;
+        std::memcpy(&value, data.data + offset, sizeof(uint32_t));
+
+        return value;
+    }
+
+    static bool ReadGlbChunks(const ByteView& data, GlbChunks& chunks)
+    {
+        if (data.size < kGlbHeaderSize || ReadUint32(data, 0) != kGlbMagic || ReadUint32(data, 4) != kGlbVersion)
+        {
+            return false;
+        }
+
+        const size_t length = std::min(static_cast<size_t>(ReadUint32(data, 8)), data.size);
+
+        if (length < kGlbHeaderSize)
+        {
+            return false;
+        }
+
+        size_t offset = kGlbHeaderSize;
+
+        while (length - offset >= kGlbChunkHeaderSize)
+        {
+            const size_t chunkLength = ReadUint32(data, offset);
+            const uint32_t chunkType = ReadUint32(data, offset + sizeof(uint32_t));
+
+            offset += kGlbChunkHeaderSize;
+
+            if (chunkLength > length - offset)
+            {
+                return false;
+            }
+
+            const ByteView chunk(data.data + offset, chunkLength);
+
+            if (chunkType == kGlbJsonChunkType && chunks.json.data == nullptr)
+            {
+                chunks.json = chunk;
+            }
+            else if (chunkType == kGlbBinChunkType && chunks.bin.data == nullptr)
+            {
+                chunks.bin = chunk;
+            }
+
+            // Chunks are 4 byte aligned
+            offset += std::min((chunkLength + 3) / 4 * 4, length - offset);
+        }
+
+        return chunks.json.data != nullptr;
+    }
+
+    static int32_t GetBase64Digit(char c)
+    {
+        if (c >= 'A' && c <= 'Z')
+        {
+            return c - 'A';
+        }
+        if (c >= 'a' && c <= 'z')
+        {
+            return c - 'a' + 26;
+        }
+        if (c >= '0' && c <= '9')
+        {
+            return c - '0' + 52;
+        }
+        if (c == '+' || c == '-')
+        {
+            return 62;
+        }
+        if (c == '/' || c == '_')
+        {
+            return 63;
+        }
+
+        return -1;
+    }
+
+    static bool DecodeBase64(std::string_view text, Bytes& data)
+    {
+        while (!text.empty() && text.back() == '=')
+        {
+            text.remove_suffix(1);
+        }
+
+        data.clear();
+        data.reserve(text.size() * 3 / 4);
+
+        uint32_t bits = 0;
+        uint32_t bitCount = 0;
+
+        for (const char c : text)
+        {
+            const int32_t digit = GetBase64Digit(c);
+
+            if (digit < 0)
+            {
+                return false;
+            }
+
+            bits = bits << 6 | static_cast<uint32_t>(digit);
+            bitCount += 6;
+
+            if (bitCount >= 8)
+            {
+                bitCount -= 8;
+
+                data.push_back(static_cast<uint8_t>(bits >> bitCount));
+            }
+        }
+
+        return true;
+    }
+
+    // Relative uris are percent-encoded
+    static std::string DecodeUri(std::string_view uri)
+    {
+        std::string result;
+        result.reserve(uri.size());
+
+        for (size_t i = 0; i < uri.size(); ++i)
+        {
+            if (uri[i] == '%' && i + 2 < uri.size())
+            {
+                const std::string_view digits = uri.substr(i + 1, 2);
+
+                uint32_t value = 0;
+
+                const auto [ptr, error] = std::from_chars(digits.data(), digits.data() + digits.size(), value, 16);
+
+                if (error == std::errc() && ptr == digits.data() + digits.size())
+                {
+                    result += static_cast<char>(value);
+
+                    i += 2;
+
+                    continue;
+                }
+            }
+
+            result += uri[i];
+        }
+
+        return result;
+    }
+
+    static int32_t GetInt(const JsonValue& value, int32_t defaultValue = -1)
+    {
+        if (!value.IsNumber())
+        {
+            return defaultValue;
+        }
+
+        constexpr int64_t minValue = std::numeric_limits<int32_t>::min();
+        constexpr int64_t maxValue = std::numeric_limits<int32_t>::max();
+
+        return static_cast<int32_t>(std::clamp(value.GetInt(), minValue, maxValue));
+    }
+
+    static size_t GetSize(const JsonValue& value)
+    {
+        return value.IsNumber() ? static_cast<size_t>(std::max(value.GetInt(), int64_t(0))) : 0;
+    }
+
+    static double GetDouble(const JsonValue& value, double defaultValue)
+    {
+        return value.IsNumber() ? value.GetDouble() : defaultValue;
+    }
+
+    static bool GetBool(const JsonValue& value)
+    {
+        return value.IsBool() && value.GetBool();
+    }
+
+    static std::string GetString(const JsonValue& value, const std::string& defaultValue = {})
+    {
+        return value.IsString() ? value.GetString() : defaultValue;
+    }
+
+    static std::vector<double> GetDoubles(const JsonValue& value)
+    {
+        std::vector<double> result;
+
+        if (value.IsArray())
+        {
+            result.reserve(value.GetSize());
+
+            value.ForEachElement([&](const JsonValue& element)
+                {
+                    result.push_back(GetDouble(element, 0.0));
+                });
+        }
+
+        return result;
+    }
+
+    static std::vector<int> GetInts(const JsonValue& value)
+    {
+        std::vector<int> result;
+
+        if (value.IsArray())
+        {
+            result.reserve(value.GetSize());
+
+            value.ForEachElement([&](const JsonValue& element)
+                {
+                    result.push_back(GetInt(element));
+                });
+        }
+
+        return result;
+    }
+
+    static std::vector<std::string> GetStrings(const JsonValue& value)
+    {
+        std::vector<std::string> result;
+
+        if (value.IsArray())
+        {
+            result.reserve(value.GetSize());
+
+            value.ForEachElement([&](const JsonValue& element)
+                {
+                    result.push_back(GetString(element));
+                });
+        }
+
+        return result;
+    }
+
+    // Integral numbers become int values like in tinygltf, so Get<int>() works on indices inside of extensions
+    static tinygltf::Value GetValue(const JsonValue& value)
+    {
+        switch (value.GetType())
+        {
+        case JsonType::eBool:
+            return tinygltf::Value(value.GetBool());
+        case JsonType::eNumber:
+        {
+            if (value.IsInteger())
+            {
+                const int64_t number = value.GetInt();
+
+                if (number >= std::numeric_limits<int>::min() && number <= std::numeric_limits<int>::max())
+                {
+                    return tinygltf::Value(static_cast<int>(number));
+                }
+            }
+
+            return tinygltf::Value(value.GetDouble());
+        }
+        case JsonType::eString:
+            return tinygltf::Value(value.GetString());
+        case JsonType::eArray:
+        {
+            tinygltf::Value::Array array;
+            array.reserve(value.GetSize());
+
+            value.ForEachElement([&](const JsonValue& element)
+                {
+                    array.push_back(GetValue(element));
+                });
+
+            return tinygltf::Value(std::move(array));
+        }
+        case JsonType::eObject:
+        {
+            tinygltf::Value::Object object;
+
+            value.ForEachMember([&](std::string_view key, const JsonValue& member)
+                {
+                    object.emplace(key, GetValue(member));
+                });
+
+            return tinygltf::Value(std::move(object));
+        }
+        default:
+            return tinygltf::Value();
+        }
+    }
+
+    static tinygltf::Value GetExtras(const JsonValue& value)
+    {
+        return value.IsValid() ? GetValue(value) : tinygltf::Value();
+    }
+
+    static tinygltf::ExtensionMap GetExtensions(const JsonValue& value)
+    {
+        tinygltf::ExtensionMap extensions;
+
+        if (value.IsObject())
+        {
+            value.ForEachMember([&](std::string_view key, const JsonValue& member)
+                {
+                    extensions.emplace(key, GetValue(member));
+                });
+        }
+
+        return extensions;
+    }
+
+    static int32_t GetAccessorType(const JsonValue& value)
+    {
+        const std::string_view type = value.IsString() ? value.GetRawString() : std::string_view();
+
+        if (type == "SCALAR")
+        {
+            return TINYGLTF_TYPE_SCALAR;
+        }
+        if (type == "VEC2")
+        {
+            return TINYGLTF_TYPE_VEC2;
+        }
+        if (type == "VEC3")
+        {
+            return TINYGLTF_TYPE_VEC3;
+        }
+        if (type == "VEC4")
+        {
+            return TINYGLTF_TYPE_VEC4;
+        }
+        if (type == "MAT2")
+        {
+            return TINYGLTF_TYPE_MAT2;
+        }
+        if (type == "MAT3")
+        {
+            return TINYGLTF_TYPE_MAT3;
+        }
+        if (type == "MAT4")
+        {
+            return TINYGLTF_TYPE_MAT4;
+        }
+
+        return -1;
+    }
+
+    template <class T>
+    static T GetTextureInfo(const JsonValue& value)
+    {
+        T textureInfo;
+        textureInfo.index = GetInt(value["index"]);
+        textureInfo.texCoord = GetInt(value["texCoord"], 0);
+
+        return textureInfo;
+    }
+
+    template <class T>
+    static std::vector<T> ParseArray(const JsonValue& value, T (*parseFunc)(const JsonValue&))
+    {
+        std::vector<T> result;
+
+        if (value.IsArray())
+        {
+            result.reserve(value.GetSize());
+
+            value.ForEachElement([&](const JsonValue& element)
+                {
+                    result.push_back(parseFunc(element));
+                });
+        }
+
+        return result;
+    }
+
+    static tinygltf::Scene ParseScene(const JsonValue& value)
+    {
+        tinygltf::Scene scene;
+        scene.name = GetString(value["name"]);
+        scene.nodes = GetInts(value["nodes"]);
+
+        return scene;
+    }
+
+    static tinygltf::Node ParseNode(const JsonValue& value)
+    {
+        tinygltf::Node node;
+        node.name = GetString(value["name"]);
+        node.camera = GetInt(value["camera"]);
+        node.mesh = GetInt(value["mesh"]);
+        node.skin = GetInt(value["skin"]);
+        node.children = GetInts(value["children"]);
+        node.matrix = GetDoubles(value["matrix"]);
+        node.rotation = GetDoubles(value["rotation"]);
+        node.scale = GetDoubles(value["scale"]);
+        node.translation = GetDoubles(value["translation"]);
+        node.extensions = GetExtensions(value["extensions"]);
+        node.extras = GetExtras(value["extras"]);
+
+        return node;
+    }
+
+    static tinygltf::Primitive ParsePrimitive(const JsonValue& value)
+    {
+        tinygltf::Primitive primitive;
+        primitive.indices = GetInt(value["indices"]);
+        primitive.material = GetInt(value["material"]);
+        primitive.mode = GetInt(value["mode"], TINYGLTF_MODE_TRIANGLES);
+        primitive.extensions = GetExtensions(value["extensions"]);
+
+        const JsonValue attributes = value["attributes"];
+
+        if (attributes.IsObject())
+        {
+            attributes.ForEachMember([&](std::string_view key, const JsonValue& attribute)
+                {
+                    primitive.attributes.emplace(key, GetInt(attribute));
+                });
+        }
+
+        return primitive;
+    }
+
+    static tinygltf::Mesh ParseMesh(const JsonValue& value)
+    {
+        tinygltf::Mesh mesh;
+        mesh.name = GetString(value["name"]);
+        mesh.primitives = ParseArray(value["primitives"], &ParsePrimitive);
+
+        return mesh;
+    }
+
+    static tinygltf::Accessor ParseAccessor(const JsonValue& value)
+    {
+        tinygltf::Accessor accessor;
+        accessor.name = GetString(value["name"]);
+        accessor.bufferView = GetInt(value["bufferView"]);
+        accessor.byteOffset = GetSize(value["byteOffset"]);
+        accessor.normalized = GetBool(value["normalized"]);
+        accessor.componentType = GetInt(value["componentType"]);
+        accessor.count = GetSize(value["count"]);
+        accessor.type = GetAccessorType(value["type"]);
+
+        return accessor;
+    }
+
+    static tinygltf::BufferView ParseBufferView(const JsonValue& value)
+    {
+        tinygltf::BufferView bufferView;
+        bufferView.name = GetString(value["name"]);
+        bufferView.buffer = GetInt(value["buffer"]);
+        bufferView.byteOffset = GetSize(value["byteOffset"]);
+        bufferView.byteLength = GetSize(value["byteLength"]);
+        bufferView.byteStride = GetSize(value["byteStride"]);
+        bufferView.target = GetInt(value["target"], 0);
+        bufferView.extensions = GetExtensions(value["extensions"]);
+
+        return bufferView;
+    }
+
+    static tinygltf::Material ParseMaterial(const JsonValue& value)
+    {
+        tinygltf::Material material;
+        material.name = GetString(value["name"]);
+
+        const JsonValue pbr = value["pbrMetallicRoughness"];
+
+        if (pbr["baseColorFactor"].IsArray())
+        {
+            material.pbrMetallicRoughness.baseColorFactor = GetDoubles(pbr["baseColorFactor"]);
+        }
+
+        material.pbrMetallicRoughness.baseColorTexture = GetTextureInfo<tinygltf::TextureInfo>(pbr["baseColorTexture"]);
+        material.pbrMetallicRoughness.metallicFactor = GetDouble(pbr["metallicFactor"], 1.0);
+        material.pbrMetallicRoughness.roughnessFactor = GetDouble(pbr["roughnessFactor"], 1.0);
+        material.pbrMetallicRoughness.metallicRoughnessTexture
+                = GetTextureInfo<tinygltf::TextureInfo>(pbr["metallicRoughnessTexture"]);
+
+        material.normalTexture = GetTextureInfo<tinygltf::NormalTextureInfo>(value["normalTexture"]);
+        material.normalTexture.scale = GetDouble(value["normalTexture"]["scale"], 1.0);
+
+        material.occlusionTexture = GetTextureInfo<tinygltf::OcclusionTextureInfo>(value["occlusionTexture"]);
+        material.occlusionTexture.strength = GetDouble(value["occlusionTexture"]["strength"], 1.0);
+
+        material.emissiveTexture = GetTextureInfo<tinygltf::TextureInfo>(value["emissiveTexture"]);
+
+        if (value["emissiveFactor"].IsArray())
+        {
+            material.emissiveFactor = GetDoubles(value["emissiveFactor"]);
+        }
+
+        material.alphaMode = GetString(value["alphaMode"], "OPAQUE");
+        material.alphaCutoff = GetDouble(value["alphaCutoff"], 0.5);
+        material.doubleSided = GetBool(value["doubleSided"]);
+        material.extensions = GetExtensions(value["extensions"]);
+
+        return material;
+    }
+
+    static tinygltf::Texture ParseTexture(const JsonValue& value)
+    {
+        tinygltf::Texture texture;
+        texture.name = GetString(value["name"]);
+        texture.sampler = GetInt(value["sampler"]);
+        texture.source = GetInt(value["source"]);
+        texture.extensions = GetExtensions(value["extensions"]);
+
+        return texture;
+    }
+
+    static tinygltf::Image ParseImage(const JsonValue& value)
+    {
+        tinygltf::Image image;
+        image.name = GetString(value["name"]);
+        image.uri = GetString(value["uri"]);
+        image.mimeType = GetString(value["mimeType"]);
+        image.bufferView = GetInt(value["bufferView"]);
+
+        return image;
+    }
+
+    static tinygltf::Sampler ParseSampler(const JsonValue& value)
+    {
+        tinygltf::Sampler sampler;
+        sampler.name = GetString(value["name"]);
+        sampler.magFilter = GetInt(value["magFilter"]);
+        sampler.minFilter = GetInt(value["minFilter"]);
+        sampler.wrapS = GetInt(value["wrapS"], TINYGLTF_TEXTURE_WRAP_REPEAT);
+        sampler.wrapT = GetInt(value["wrapT"], TINYGLTF_TEXTURE_WRAP_REPEAT);
+
+        return sampler;
+    }
+
+    static tinygltf::Camera ParseCamera(const JsonValue& value)
+    {
+        tinygltf::Camera camera;
+        camera.name = GetString(value["name"]);
+        camera.type = GetString(value["type"]);
+
+        const JsonValue perspective = value["perspective"];
+
+        camera.perspective.aspectRatio = GetDouble(perspective["aspectRatio"], 0.0);
+        camera.perspective.yfov = GetDouble(perspective["yfov"], 0.0);
+        camera.perspective.zfar = GetDouble(perspective["zfar"], 0.0);
+        camera.perspective.znear = GetDouble(perspective["znear"], 0.0);
+
+        const JsonValue orthographic = value["orthographic"];
+
+        camera.orthographic.xmag = GetDouble(orthographic["xmag"], 0.0);
+        camera.orthographic.ymag = GetDouble(orthographic["ymag"], 0.0);
+        camera.orthographic.zfar = GetDouble(orthographic["zfar"], 0.0);
+        camera.orthographic.znear = GetDouble(orthographic["znear"], 0.0);
+
+        return camera;
+    }
+
+    static tinygltf::Light ParseLight(const JsonValue& value)
+    {
+        tinygltf::Light light;
+        light.name = GetString(value["name"]);
+        light.type = GetString(value["type"]);
+        light.color = GetDoubles(value["color"]);
+        light.intensity = GetDouble(value["intensity"], light.intensity);
+        light.range = GetDouble(value["range"], light.range);
+
+        const JsonValue spot = value["spot"];
+
+        light.spot.innerConeAngle = GetDouble(spot["innerConeAngle"], light.spot.innerConeAngle);
+        light.spot.outerConeAngle = GetDouble(spot["outerConeAngle"], light.spot.outerConeAngle);
+
+        return light;
+    }
+
+    // Binary chunks and external files are referenced in place, only data uris are decoded into the buffer
+    static bool LoadBufferData(const JsonValue& value, bool glbBuffer, const ByteView& binChunk,
+            const Filepath& directory, tinygltf::Buffer& buffer, GltfBuffers& buffers)
+    {
+        const size_t byteLength = GetSize(value["byteLength"]);
+
+        if (!value["uri"].IsString())
+        {
+            if (glbBuffer)
+            {
+                if (byteLength > binChunk.size)
+                {
+                    return false;
+                }
+
+                buffers.views.emplace_back(binChunk.data, byteLength);
+
+                return true;
+            }
+
+            buffers.views.emplace_back();
+
+            // Fallback buffers of EXT_meshopt_compression only describe the layout of the decoded data
+            return buffer.extensions.contains(kMeshoptExtension);
+        }
+
+        if (buffer.uri.starts_with(kDataUriPrefix))
+        {
+            const size_t dataOffset = buffer.uri.find(kBase64Marker);
+
+            if (dataOffset == std::string::npos)
+            {
+                return false;
+            }
+
+            const std::string_view text = std::string_view(buffer.uri).substr(dataOffset + kBase64Marker.size());
+
+            if (!DecodeBase64(text, buffer.data) || buffer.data.size() < byteLength)
+            {
+                return false;
+            }
+
+            buffer.data.resize(byteLength);
+
+            // The vector storage doesn't move along with the buffer
+            buffers.views.emplace_back(buffer.data.data(), byteLength);
+
+            return true;
+        }
+
+        MappedFile file(directory / Filepath(DecodeUri(buffer.uri)));
+
+        if (!file.IsValid() || file.GetData().size < byteLength)
+        {
+            return false;
+        }
+
+        buffers.views.emplace_back(file.GetData().data, byteLength);
+        buffers.files.push_back(std::move(file));
+
+        return true;
+    }
+
+    static bool ParseBuffers(const JsonValue& value, const ByteView& binChunk, const Filepath& directory,
+            std::vector<tinygltf::Buffer>& modelBuffers, GltfBuffers& buffers)
+    {
+        if (!value.IsArray())
+        {
+            return true;
+        }
+
+        modelBuffers.reserve(value.GetSize());
+        buffers.views.reserve(value.GetSize());
+
+        bool result = true;
+
+        value.ForEachElement([&](const JsonValue& element)
+            {
+                tinygltf::Buffer buffer;
+                buffer.name = GetString(element["name"]);
+                buffer.uri = GetString(element["uri"]);
+                buffer.extensions = GetExtensions(element["extensions"]);
+
+                // The first buffer of a binary file without uri is the BIN chunk
+                const bool glbBuffer = modelBuffers.empty() && binChunk.data != nullptr;
+
+                if (!LoadBufferData(element, glbBuffer, binChunk, directory, buffer, buffers))
+                {
+                    LogE << "Failed to load glTF buffer " << modelBuffers.size() << ": " << buffer.uri << "\n";
+
+                    buffers.views.resize(modelBuffers.size() + 1);
+
+                    result = false;
+                }
+
+                modelBuffers.push_back(std::move(buffer));
+            });
+
+        return result;
+    }
+
+    // Only buffer views that are read as is have to fit, compressed ones point at empty fallback buffers
+    static bool ValidateBufferViews(const tinygltf::Model& model, const GltfBuffers& buffers)
+    {
+        for (const tinygltf::BufferView& bufferView : model.bufferViews)
+        {
+            if (bufferView.extensions.contains(kMeshoptExtension))
+            {
+                continue;
+            }
+
+            const bool valid = bufferView.buffer >= 0
+                    && bufferView.buffer < static_cast<int32_t>(buffers.views.size())
+                    && bufferView.byteOffset <= buffers.views[bufferView.buffer].size
+                    && bufferView.byteLength <= buffers.views[bufferView.buffer].size - bufferView.byteOffset;
+
+            if (!valid)
+            {
+                LogE << "Invalid glTF buffer view: " << bufferView.name << "\n";
+
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+bool GltfParser::ParseModel(const ByteView& data, bool binary, const Filepath& directory,
+        tinygltf::Model& model, GltfBuffers& buffers)
+{
+    EASY_FUNCTION()
+
+    Details::GlbChunks chunks;
+
+    if (binary)
+    {
+        if (!Details::ReadGlbChunks(data, chunks))
+        {
+            LogE << "Invalid GLB container\n";
+
+            return false;
+        }
+    }
+    else
+    {
+        chunks.json = data;
+    }
+
+    const JsonDocument document(std::string_view(reinterpret_cast<const char*>(chunks.json.data), chunks.json.size));
+
+    if (!document.IsValid() || !document.GetRoot().IsObject())
+    {
+        LogE << "Invalid glTF JSON at offset " << document.GetErrorOffset() << "\n";
+
+        return false;
+    }
+
+    const JsonValue root = document.GetRoot();
+
+    model.asset.version = Details::GetString(root["asset"]["version"]);
+    model.asset.generator = Details::GetString(root["asset"]["generator"]);
+
+    model.extensionsUsed = Details::GetStrings(root["extensionsUsed"]);
+    model.extensionsRequired = Details::GetStrings(root["extensionsRequired"]);
+    model.extensions = Details::GetExtensions(root["extensions"]);
+
+    model.defaultScene = Details::GetInt(root["scene"]);
+
+    model.scenes = Details::ParseArray(root["scenes"], &Details::ParseScene);
+    model.nodes = Details::ParseArray(root["nodes"], &Details::ParseNode);
+    model.meshes = Details::ParseArray(root["meshes"], &Details::ParseMesh);
+    model.accessors = Details::ParseArray(root["accessors"], &Details::ParseAccessor);
+    model.bufferViews = Details::ParseArray(root["bufferViews"], &Details::ParseBufferView);
+    model.materials = Details::ParseArray(root["materials"], &Details::ParseMaterial);
+    model.textures = Details::ParseArray(root["textures"], &Details::ParseTexture);
+    model.images = Details::ParseArray(root["images"], &Details::ParseImage);
+    model.samplers = Details::ParseArray(root["samplers"], &Details::ParseSampler);
+    model.cameras = Details::ParseArray(root["cameras"], &Details::ParseCamera);
+    model.lights = Details::ParseArray(root["extensions"][Details::kLightsExtension]["lights"], &Details::ParseLight);
+
+    if (!Details::ParseBuffers(root["buffers"], chunks.bin, directory, model.buffers, buffers))
+    {
+        return false;
+    }
+
+    return Details::ValidateBufferViews(model, buffers);
+}
@@ -0,0 +1,79 @@
+#include "Engine/Scene/Lod.hpp"
+
+#include "Engine/Scene/MeshOptimizer.hpp"
+
+#include "Utils/AABBox.hpp"
+#include "Utils/Assert.hpp"
+
+std::vector<Lod> LodHelpers::BuildLods(std::vector<uint32_t>& indices, const std::vector<glm::vec3>& positions)
+{
+    EASY_FUNCTION()
+
+    Assert(indices.size() % 3 == 0);
+
+    const uint32_t vertexCount = static_cast<uint32_t>(positions.size());
+
+    std::vector<Lod> lods{ Lod{ 0, static_cast<uint32_t>(indices.size()), 0.0f } };
+
+    AABBox bbox;
+
+    for (const auto& position : positions)
+    {
+        bbox.Add(position);
+    }
+
+    const float maxError = kMaxError * bbox.GetLongestEdge();
+
+    // Every level is simplified from the full detail indices so that errors don't accumulate along the chain
+    const std::vector<uint32_t> sourceIndices = indices;
+
+    size_t indexCount = sourceIndices.size();
+
+    while (lods.size() < kMaxLodCount && indexCount / 3 > kMinTriangleCount)
+    {
+        const size_t targetIndexCount = static_cast<size_t>(
+                static_cast<float>(indexCount / 3) * kTriangleReduction) * 3;
+
+        float error = 0.0f;
+
+        const std::vector<uint32_t> lodIndices = MeshOptimizer::SimplifyMesh(
+                sourceIndices, positions, targetIndexCount, maxError, &error);
+
+        const size_t maxIndexCount = static_cast<size_t>(
+                static_cast<float>(indexCount) * (1.0f - kMinTriangleReduction));
+
+        if (lodIndices.empty() || lodIndices.size() > maxIndexCount)
+        {
+            break;
+        }
+
+        Lod lod;
+
+        lod.firstIndex = static_cast<uint32_t>(indices.size());
+        lod.indexCount = static_cast<uint32_t>(lodIndices.size());
+        lod.error = std::max(error, lods.back().error);
+
+        const std::vector<uint32_t> optimizedIndices = MeshOptimizer::OptimizeVertexCache(lodIndices, vertexCount);
+
+        indices.insert(indices.end(), optimizedIndices.begin(), optimizedIndices.end());
+
+        lods.push_back(lod);
+
+        indexCount = lodIndices.size();
+    }
+
+    return lods;
+}
+
+uint32_t LodHelpers::SelectLod(const std::vector<Lod>& lods, float maxError)
+{
+    for (size_t i = lods.size(); i > 1; --i)
+    {
+        if (lods[i - 1].error <= maxError)
+        {
+            return static_cast<uint32_t>(i - 1);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,354 @@
+#include <unordered_map>
+
+#include "Engine/Scene/MeshData.hpp"
+
+#include "Utils/Assert.hpp"
+#include "Utils/Helpers.hpp"
+#include "Utils/ThreadPool.hpp"
+
+namespace Details
+{
+    // Number of triangles or vertices processed by one parallel task
+    static constexpr size_t kBlockSize = 4096;
+
+    static constexpr size_t kVertexSize = sizeof(glm::vec3) * 3 + sizeof(glm::vec2);
+
+    // Vertex to triangle adjacency in compressed sparse row form, triangles of a vertex are in ascending order
+    struct TriangleAdjacency
+    {
+        std::vector<uint32_t> offsets;
+        std::vector<uint32_t> triangles;
+    };
+
+    static TriangleAdjacency BuildTriangleAdjacency(const std::vector<uint32_t>& indices, size_t vertexCount)
+    {
+        TriangleAdjacency adjacency;
+
+        adjacency.offsets.resize(vertexCount + 1, 0);
+        adjacency.triangles.resize(indices.size());
+
+        for (const uint32_t index : indices)
+        {
+            ++adjacency.offsets[index + 1];
+        }
+
+        for (size_t i = 0; i < vertexCount; ++i)
+        {
+            adjacency.offsets[i + 1] += adjacency.offsets[i];
+        }
+
+        std::vector<uint32_t> cursors(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            adjacency.triangles[cursors[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+
+        return adjacency;
+    }
+
+    static glm::vec3 ComputeFaceNormal(
+            const std::vector<uint32_t>& indices, const std::vector<glm::vec3>& positions, size_t face)
+    {
+        const glm::vec3& position0 = positions[indices[face * 3]];
+        const glm::vec3& position1 = positions[indices[face * 3 + 1]];
+        const glm::vec3& position2 = positions[indices[face * 3 + 2]];
+
+        const glm::vec3 edge1 = position1 - position0;
+        const glm::vec3 edge2 = position2 - position0;
+
+        return glm::normalize(glm::cross(edge1, edge2));
+    }
+
+    static glm::vec3 ComputeFaceTangent(const std::vector<uint32_t>& indices,
+            const std::vector<glm::vec3>& positions, const std::vector<glm::vec2>& texCoords, size_t face)
+    {
+        const glm::vec3& position0 = positions[indices[face * 3]];
+        const glm::vec3& position1 = positions[indices[face * 3 + 1]];
+        const glm::vec3& position2 = positions[indices[face * 3 + 2]];
+
+        const glm::vec3 edge1 = position1 - position0;
+        const glm::vec3 edge2 = position2 - position0;
+
+        const glm::vec2& texCoord0 = texCoords[indices[face * 3]];
+        const glm::vec2& texCoord1 = texCoords[indices[face * 3 + 1]];
+        const glm::vec2& texCoord2 = texCoords[indices[face * 3 + 2]];
+
+        const glm::vec2 deltaTexCoord1 = texCoord1 - texCoord0;
+        const glm::vec2 deltaTexCoord2 = texCoord2 - texCoord0;
+
+        float d = deltaTexCoord1.x * deltaTexCoord2.y - deltaTexCoord1.y * deltaTexCoord2.x;
+
+        if (d == 0.0f)
+        {
+            d = 1.0f;
+        }
+
+        return (edge1 * deltaTexCoord2.y - edge2 * deltaTexCoord1.y) / d;
+    }
+
+    // Sums face values of the triangles around every vertex in triangle order, so the result is the same
+    // for the serial scatter and the parallel gather
+    // Without threadPool the face values are scattered in the same pass, they aren't stored at all
+    template <class TFunc>
+    static std::vector<glm::vec3> AccumulateFaceValues(const std::vector<uint32_t>& indices,
+            size_t vertexCount, ThreadPool* threadPool, const TFunc& computeFaceValue)
+    {
+        const size_t faceCount = indices.size() / 3;
+
+        std::vector<glm::vec3> result(vertexCount, Vector3::kZero);
+
+        if (!threadPool || faceCount <= kBlockSize)
+        {
+            for (size_t i = 0; i < faceCount; ++i)
+            {
+                const glm::vec3 faceValue = computeFaceValue(i);
+
+                result[indices[i * 3]] += faceValue;
+                result[indices[i * 3 + 1]] += faceValue;
+                result[indices[i * 3 + 2]] += faceValue;
+            }
+
+            return result;
+        }
+
+        std::vector<glm::vec3> faceValues(faceCount);
+
+        ThreadPool::ForEachBlock(threadPool, faceCount, kBlockSize, [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    faceValues[i] = computeFaceValue(i);
+                }
+            });
+
+        const TriangleAdjacency adjacency = BuildTriangleAdjacency(indices, vertexCount);
+
+        ThreadPool::ForEachBlock(threadPool, vertexCount, kBlockSize, [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    for (uint32_t j = adjacency.offsets[i]; j < adjacency.offsets[i + 1]; ++j)
+                    {
+                        result[i] += faceValues[adjacency.triangles[j]];
+                    }
+                }
+            });
+
+        return result;
+    }
+
+    template <class T>
+    static size_t GetContentHash(const std::vector<T>& data)
+    {
+        const ByteView byteView = GetByteView(data);
+
+        const std::string_view bytes(reinterpret_cast<const char*>(byteView.data), byteView.size);
+
+        return std::hash<std::string_view>()(bytes);
+    }
+
+    template <class T>
+    static bool HasSameContent(const std::vector<T>& a, const std::vector<T>& b)
+    {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+    }
+
+    static size_t GetContentHash(const MeshData& mesh)
+    {
+        size_t hash = GetContentHash(mesh.indices);
+
+        CombineHash(hash, GetContentHash(mesh.positions));
+        CombineHash(hash, GetContentHash(mesh.normals));
+        CombineHash(hash, GetContentHash(mesh.tangents));
+        CombineHash(hash, GetContentHash(mesh.texCoords));
+
+        return hash;
+    }
+
+    static bool HasSameContent(const MeshData& a, const MeshData& b)
+    {
+        return HasSameContent(a.indices, b.indices)
+                && HasSameContent(a.positions, b.positions)
+                && HasSameContent(a.normals, b.normals)
+                && HasSameContent(a.tangents, b.tangents)
+                && HasSameContent(a.texCoords, b.texCoords);
+    }
+
+    static size_t GetGeometrySize(const MeshData& mesh)
+    {
+        return mesh.indices.size() * sizeof(uint32_t) + mesh.positions.size() * kVertexSize;
+    }
+}
+
+MeshData MeshDataHelpers::CreateMeshData(std::vector<uint32_t> indices,
+        std::vector<glm::vec3> positions, std::vector<glm::vec3> normals,
+        std::vector<glm::vec3> tangents, std::vector<glm::vec2> texCoords, ThreadPool* threadPool)
+{
+    EASY_FUNCTION()
+
+    MeshData mesh;
+
+    mesh.indices = std::move(indices);
+    mesh.positions = std::move(positions);
+    mesh.normals = std::move(normals);
+    mesh.tangents = std::move(tangents);
+    mesh.texCoords = std::move(texCoords);
+
+    if (mesh.normals.empty())
+    {
+        mesh.normals = ComputeNormals(mesh.indices, mesh.positions, threadPool);
+    }
+    if (mesh.texCoords.empty())
+    {
+        mesh.texCoords = Repeat(Vector2::kZero, mesh.positions.size());
+    }
+    if (mesh.tangents.empty())
+    {
+        mesh.tangents = ComputeTangents(mesh.indices, mesh.positions, mesh.normals, mesh.texCoords, threadPool);
+    }
+
+    mesh.bbox = ComputeBBox(mesh.positions);
+
+    mesh.meshlets = MeshletHelpers::BuildMeshlets(mesh.indices, mesh.positions);
+
+    mesh.lods = LodHelpers::BuildLods(mesh.indices, mesh.positions);
+
+    return mesh;
+}
+
+std::vector<glm::vec3> MeshDataHelpers::ComputeNormals(
+        const std::vector<uint32_t>& indices,
+        const std::vector<glm::vec3>& positions,
+        ThreadPool* threadPool)
+{
+    EASY_FUNCTION()
+
+    Assert(!positions.empty());
+
+    std::vector<glm::vec3> normals = Details::AccumulateFaceValues(indices, positions.size(), threadPool,
+            [&](size_t face)
+            {
+                return Details::ComputeFaceNormal(indices, positions, face);
+            });
+
+    ThreadPool::ForEachBlock(threadPool, normals.size(), Details::kBlockSize, [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                normals[i] = glm::normalize(normals[i]);
+            }
+        });
+
+    return normals;
+}
+
+std::vector<glm::vec3> MeshDataHelpers::ComputeTangents(
+        const std::vector<uint32_t>& indices,
+        const std::vector<glm::vec3>& positions,
+        const std::vector<glm::vec3>& normals,
+        const std::vector<glm::vec2>& texCoords,
+        ThreadPool* threadPool)
+{
+    EASY_FUNCTION()
+
+    Assert(!positions.empty());
+    Assert(normals.size() == positions.size());
+    Assert(texCoords.size() == positions.size());
+
+    std::vector<glm::vec3> tangents = Details::AccumulateFaceValues(indices, positions.size(), threadPool,
+            [&](size_t face)
+            {
+                return Details::ComputeFaceTangent(indices, positions, texCoords, face);
+            });
+
+    ThreadPool::ForEachBlock(threadPool, tangents.size(), Details::kBlockSize, [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                glm::vec3& tangent = tangents[i];
+
+                const glm::vec3 orthogonalTangent = tangent - normals[i] * glm::dot(normals[i], tangent);
+
+                if (glm::length(orthogonalTangent) > 0.0f)
+                {
+                    tangent = glm::normalize(orthogonalTangent);
+                }
+                else if (glm::length(tangent) > 0.0f)
+                {
+                    tangent = glm::normalize(tangent);
+                }
+                else
+                {
+                    tangent.x = 1.0f;
+                }
+            }
+        });
+
+    return tangents;
+}
+
+AABBox MeshDataHelpers::ComputeBBox(const std::vector<glm::vec3>& positions)
+{
+    EASY_FUNCTION()
+
+    AABBox bbox;
+
+    for (const auto& position : positions)
+    {
+        bbox.Add(position);
+    }
+
+    return bbox;
+}
+
+std::vector<uint32_t> MeshDataHelpers::RemoveDuplicates(std::vector<MeshData>& meshes)
+{
+    EASY_FUNCTION()
+
+    std::vector<uint32_t> meshIndices(meshes.size());
+
+    std::vector<MeshData> uniqueMeshes;
+    uniqueMeshes.reserve(meshes.size());
+
+    // Content hash to the unique meshes that share it
+    std::unordered_map<size_t, std::vector<uint32_t>> hashedMeshes;
+
+    size_t removedSize = 0;
+
+    for (size_t i = 0; i < meshes.size(); ++i)
+    {
+        std::vector<uint32_t>& candidates = hashedMeshes[Details::GetContentHash(meshes[i])];
+
+        const auto it = std::ranges::find_if(candidates, [&](uint32_t candidate)
+            {
+                return Details::HasSameContent(uniqueMeshes[candidate], meshes[i]);
+            });
+
+        if (it != candidates.end())
+        {
+            meshIndices[i] = *it;
+
+            removedSize += Details::GetGeometrySize(meshes[i]);
+        }
+        else
+        {
+            meshIndices[i] = static_cast<uint32_t>(uniqueMeshes.size());
+
+            candidates.push_back(meshIndices[i]);
+
+            uniqueMeshes.push_back(std::move(meshes[i]));
+        }
+    }
+
+    if (uniqueMeshes.size() < meshes.size())
+    {
+        LogI << Format("Duplicate primitives removed: %zu of %zu, %.2f MB of geometry saved\n",
+                meshes.size() - uniqueMeshes.size(), meshes.size(),
+                static_cast<double>(removedSize) / static_cast<double>(1024 * 1024));
+    }
+
+    meshes = std::move(uniqueMeshes);
+
+    return meshIndices;
+}
@@ -0,0 +1,905 @@
+#include <numeric>
+#include <unordered_map>
+
+#include "Engine/Scene/MeshOptimizer.hpp"
+
+#include "Utils/AABBox.hpp"
+#include "Utils/Assert.hpp"
+#include "Utils/Helpers.hpp"
+
+namespace Details
+{
+    // Collapses that rotate a remaining triangle normal by more than ~75 degrees are rejected as flips
+    static constexpr float kMinNormalDot = 0.25f;
+
+    // Vertex attributes snapped to the weld tolerance grid
+    using WeldKey = std::array<int64_t, 11>;
+
+    struct WeldKeyHash
+    {
+        size_t operator()(const WeldKey& key) const
+        {
+            size_t hash = 0;
+
+            for (const int64_t value : key)
+            {
+                CombineHash(hash, value);
+            }
+
+            return hash;
+        }
+    };
+
+    // Vertex to triangle adjacency in compressed sparse row form
+    struct TriangleAdjacency
+    {
+        std::vector<uint32_t> offsets;
+        std::vector<uint32_t> triangles;
+    };
+
+    // FIFO post-transform cache, a vertex is cached while less than kVertexCacheSize vertices were added after it
+    class VertexCache
+    {
+    public:
+        explicit VertexCache(uint32_t vertexCount)
+            : timestamps(vertexCount, 0)
+        {}
+
+        bool Contains(uint32_t vertex) const
+        {
+            return timestamp - timestamps[vertex] <= MeshOptimizer::kVertexCacheSize;
+        }
+
+        uint32_t GetAge(uint32_t vertex) const
+        {
+            return timestamp - timestamps[vertex];
+        }
+
+        bool Access(uint32_t vertex)
+        {
+            if (Contains(vertex))
+            {
+                return true;
+            }
+
+            timestamps[vertex] = timestamp++;
+
+            return false;
+        }
+
+        void Flush()
+        {
+            timestamp += MeshOptimizer::kVertexCacheSize + 1;
+        }
+
+    private:
+        std::vector<uint32_t> timestamps;
+
+        uint32_t timestamp = MeshOptimizer::kVertexCacheSize + 1;
+    };
+
+    static TriangleAdjacency BuildTriangleAdjacency(const std::vector<uint32_t>& indices, uint32_t vertexCount)
+    {
+        TriangleAdjacency adjacency;
+
+        adjacency.offsets.resize(vertexCount + 1, 0);
+        adjacency.triangles.resize(indices.size());
+
+        for (const uint32_t index : indices)
+        {
+            ++adjacency.offsets[index + 1];
+        }
+
+        for (uint32_t i = 0; i < vertexCount; ++i)
+        {
+            adjacency.offsets[i + 1] += adjacency.offsets[i];
+        }
+
+        std::vector<uint32_t> cursors(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            adjacency.triangles[cursors[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+
+        return adjacency;
+    }
+
+    static uint32_t SkipDeadEnd(std::vector<uint32_t>& deadEndStack,
+            const std::vector<uint32_t>& liveTriangleCounts, uint32_t& cursor)
+    {
+        while (!deadEndStack.empty())
+        {
+            const uint32_t vertex = deadEndStack.back();
+            deadEndStack.pop_back();
+
+            if (liveTriangleCounts[vertex] > 0)
+            {
+                return vertex;
+            }
+        }
+
+        while (cursor < liveTriangleCounts.size())
+        {
+            if (liveTriangleCounts[cursor] > 0)
+            {
+                return cursor;
+            }
+
+            ++cursor;
+        }
+
+        return MeshOptimizer::kUnusedVertex;
+    }
+
+    static uint32_t GetNextVertex(const std::vector<uint32_t>& candidates, const VertexCache& cache,
+            const std::vector<uint32_t>& liveTriangleCounts)
+    {
+        uint32_t nextVertex = MeshOptimizer::kUnusedVertex;
+        int32_t bestPriority = -1;
+
+        for (const uint32_t vertex : candidates)
+        {
+            if (liveTriangleCounts[vertex] == 0)
+            {
+                continue;
+            }
+
+            int32_t priority = 0;
+
+            // Prefer the oldest vertex that stays in cache after its remaining triangles are emitted
+            if (cache.GetAge(vertex) + 2 * liveTriangleCounts[vertex] <= MeshOptimizer::kVertexCacheSize)
+            {
+                priority = static_cast<int32_t>(cache.GetAge(vertex));
+            }
+
+            if (priority > bestPriority)
+            {
+                nextVertex = vertex;
+                bestPriority = priority;
+            }
+        }
+
+        return nextVertex;
+    }
+
+    static std::vector<uint32_t> FindClusters(const std::vector<uint32_t>& indices, uint32_t vertexCount,
+            float threshold)
+    {
+        const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+
+        VertexCache cache(vertexCount);
+
+        // Hard boundaries are triangles that miss on all vertices, reordering there doesn't change cache efficiency
+        std::vector<uint32_t> hardClusters{ 0 };
+
+        for (uint32_t i = 0; i < triangleCount; ++i)
+        {
+            uint32_t misses = 0;
+
+            for (uint32_t j = 0; j < 3; ++j)
+            {
+                misses += cache.Access(indices[i * 3 + j]) ? 0 : 1;
+            }
+
+            if (i > 0 && misses == 3)
+            {
+                hardClusters.push_back(i);
+            }
+        }
+
+        hardClusters.push_back(triangleCount);
+
+        // Soft boundaries split hard clusters while the cold-cache miss ratio stays close to the cluster's own
+        std::vector<uint32_t> clusters;
+
+        for (size_t i = 0; i + 1 < hardClusters.size(); ++i)
+        {
+            const uint32_t begin = hardClusters[i];
+            const uint32_t end = hardClusters[i + 1];
+
+            cache.Flush();
+
+            uint32_t clusterMisses = 0;
+
+            for (uint32_t j = begin * 3; j < end * 3; ++j)
+            {
+                clusterMisses += cache.Access(indices[j]) ? 0 : 1;
+            }
+
+            const float clusterThreshold = threshold * static_cast<float>(clusterMisses)
+                    / static_cast<float>(end - begin);
+
+            clusters.push_back(begin);
+
+            cache.Flush();
+
+            uint32_t misses = 0;
+            uint32_t clusterBegin = begin;
+
+            for (uint32_t j = begin; j < end; ++j)
+            {
+                for (uint32_t k = 0; k < 3; ++k)
+                {
+                    misses += cache.Access(indices[j * 3 + k]) ? 0 : 1;
+                }
+
+                const float acmr = static_cast<float>(misses) / static_cast<float>(j + 1 - clusterBegin);
+
+                if (j + 1 < end && acmr <= clusterThreshold)
+                {
+                    clusterBegin = j + 1;
+                    misses = 0;
+
+                    clusters.push_back(clusterBegin);
+
+                    cache.Flush();
+                }
+            }
+        }
+
+        return clusters;
+    }
+
+    // Sum of squared distances to a set of planes, stored as the upper triangle of a symmetric 4x4 matrix
+    struct Quadric
+    {
+        double a00 = 0.0;
+        double a01 = 0.0;
+        double a02 = 0.0;
+        double a11 = 0.0;
+        double a12 = 0.0;
+        double a22 = 0.0;
+        double b0 = 0.0;
+        double b1 = 0.0;
+        double b2 = 0.0;
+        double c = 0.0;
+
+        Quadric() = default;
+
+        Quadric(const glm::dvec3& normal, double distance)
+            : a00(normal.x * normal.x)
+            , a01(normal.x * normal.y)
+            , a02(normal.x * normal.z)
+            , a11(normal.y * normal.y)
+            , a12(normal.y * normal.z)
+            , a22(normal.z * normal.z)
+            , b0(normal.x * distance)
+            , b1(normal.y * distance)
+            , b2(normal.z * distance)
+            , c(distance * distance)
+        {}
+
+        Quadric& operator+=(const Quadric& other)
+        {
+            a00 += other.a00;
+            a01 += other.a01;
+            a02 += other.a02;
+            a11 += other.a11;
+            a12 += other.a12;
+            a22 += other.a22;
+            b0 += other.b0;
+            b1 += other.b1;
+            b2 += other.b2;
+            c += other.c;
+
+            return *this;
+        }
+
+        double Evaluate(const glm::vec3& point) const
+        {
+            const double x = point.x;
+            const double y = point.y;
+            const double z = point.z;
+
+            const double result = x * (a00 * x + 2.0 * (a01 * y + a02 * z + b0))
+                    + y * (a11 * y + 2.0 * (a12 * z + b1))
+                    + z * (a22 * z + 2.0 * b2)
+                    + c;
+
+            return std::max(result, 0.0);
+        }
+    };
+
+    // Half edge collapse that moves vertex onto target
+    struct Collapse
+    {
+        uint32_t vertex = 0;
+        uint32_t target = 0;
+        double error = 0.0;
+    };
+
+    static uint64_t GetEdgeKey(uint32_t vertex0, uint32_t vertex1)
+    {
+        return (static_cast<uint64_t>(vertex0) << 32) | vertex1;
+    }
+
+    static std::vector<uint32_t> RemoveDegenerateTriangles(const std::vector<uint32_t>& indices)
+    {
+        std::vector<uint32_t> result;
+        result.reserve(indices.size());
+
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            const uint32_t index0 = indices[i];
+            const uint32_t index1 = indices[i + 1];
+            const uint32_t index2 = indices[i + 2];
+
+            if (index0 != index1 && index1 != index2 && index2 != index0)
+            {
+                result.push_back(index0);
+                result.push_back(index1);
+                result.push_back(index2);
+            }
+        }
+
+        return result;
+    }
+
+    // An edge without a single opposite half edge is a border, an attribute seam or non-manifold
+    static std::vector<bool> FindLockedVertices(const std::vector<uint32_t>& indices, uint32_t vertexCount)
+    {
+        std::vector<uint64_t> edges;
+        edges.reserve(indices.size());
+
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            for (size_t j = 0; j < 3; ++j)
+            {
+                edges.push_back(GetEdgeKey(indices[i + j], indices[i + (j + 1) % 3]));
+            }
+        }
+
+        std::ranges::sort(edges);
+
+        std::vector<bool> lockedVertices(vertexCount, false);
+
+        for (size_t i = 0; i < edges.size(); ++i)
+        {
+            const uint32_t vertex0 = static_cast<uint32_t>(edges[i] >> 32);
+            const uint32_t vertex1 = static_cast<uint32_t>(edges[i]);
+
+            const bool repeated = (i > 0 && edges[i - 1] == edges[i])
+                    || (i + 1 < edges.size() && edges[i + 1] == edges[i]);
+
+            const auto opposite = std::ranges::equal_range(edges, GetEdgeKey(vertex1, vertex0));
+
+            if (repeated || opposite.size() != 1)
+            {
+                lockedVertices[vertex0] = true;
+                lockedVertices[vertex1] = true;
+            }
+        }
+
+        return lockedVertices;
+    }
+
+    static std::vector<Quadric> ComputeQuadrics(const std::vector<uint32_t>& indices,
+            const std::vector<glm::vec3>& positions)
+    {
+        std::vector<Quadric> quadrics(positions.size());
+
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            const glm::dvec3 position0 = positions[indices[i]];
+            const glm::dvec3 position1 = positions[indices[i + 1]];
+            const glm::dvec3 position2 = positions[indices[i + 2]];
+
+            const glm::dvec3 normal = glm::cross(position1 - position0, position2 - position0);
+            const double length = glm::length(normal);
+
+            if (length == 0.0)
+            {
+                continue;
+            }
+
+            const Quadric quadric(normal / length, -glm::dot(normal / length, position0));
+
+            quadrics[indices[i]] += quadric;
+            quadrics[indices[i + 1]] += quadric;
+            quadrics[indices[i + 2]] += quadric;
+        }
+
+        return quadrics;
+    }
+
+    // Cheapest direction of every collapsible edge sorted by error
+    static std::vector<Collapse> FindCollapses(const std::vector<uint32_t>& indices,
+            const std::vector<glm::vec3>& positions, const std::vector<Quadric>& quadrics,
+            const std::vector<bool>& lockedVertices)
+    {
+        std::vector<Collapse> collapses;
+
+        const auto getError = [&](uint32_t vertex, uint32_t target)
+            {
+                Quadric quadric = quadrics[vertex];
+                quadric += quadrics[target];
+
+                return quadric.Evaluate(positions[target]);
+            };
+
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            for (size_t j = 0; j < 3; ++j)
+            {
+                const uint32_t vertex0 = indices[i + j];
+                const uint32_t vertex1 = indices[i + (j + 1) % 3];
+
+                // Interior edges are visited twice, once in each direction
+                if (vertex0 > vertex1 || (lockedVertices[vertex0] && lockedVertices[vertex1]))
+                {
+                    continue;
+                }
+
+                const double error0 = lockedVertices[vertex0]
+                        ? std::numeric_limits<double>::max() : getError(vertex0, vertex1);
+                const double error1 = lockedVertices[vertex1]
+                        ? std::numeric_limits<double>::max() : getError(vertex1, vertex0);
+
+                if (error0 <= error1)
+                {
+                    collapses.push_back(Collapse{ vertex0, vertex1, error0 });
+                }
+                else
+                {
+                    collapses.push_back(Collapse{ vertex1, vertex0, error1 });
+                }
+            }
+        }
+
+        std::ranges::sort(collapses, [](const Collapse& a, const Collapse& b)
+            {
+                return std::tie(a.error, a.vertex, a.target) < std::tie(b.error, b.vertex, b.target);
+            });
+
+        return collapses;
+    }
+
+    static bool FlipsTriangles(const Collapse& collapse, const std::vector<uint32_t>& indices,
+            const std::vector<glm::vec3>& positions, const TriangleAdjacency& adjacency)
+    {
+        for (uint32_t i = adjacency.offsets[collapse.vertex]; i < adjacency.offsets[collapse.vertex + 1]; ++i)
+        {
+            const uint32_t triangle = adjacency.triangles[i];
+
+            std::array<uint32_t, 3> triangleIndices{
+                indices[triangle * 3], indices[triangle * 3 + 1], indices[triangle * 3 + 2]
+            };
+
+            if (std::ranges::find(triangleIndices, collapse.target) != triangleIndices.end())
+            {
+                continue;
+            }
+
+            const glm::vec3 normal = glm::cross(positions[triangleIndices[1]] - positions[triangleIndices[0]],
+                    positions[triangleIndices[2]] - positions[triangleIndices[0]]);
+
+            std::ranges::replace(triangleIndices, collapse.vertex, collapse.target);
+
+            const glm::vec3 collapsedNormal = glm::cross(
+                    positions[triangleIndices[1]] - positions[triangleIndices[0]],
+                    positions[triangleIndices[2]] - positions[triangleIndices[0]]);
+
+            if (glm::dot(normal, collapsedNormal)
+                    <= kMinNormalDot * glm::length(normal) * glm::length(collapsedNormal))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
+
+MeshOptimizer::VertexCacheStatistics MeshOptimizer::AnalyzeVertexCache(
+        const std::vector<uint32_t>& indices, uint32_t vertexCount)
+{
+    Assert(indices.size() % 3 == 0);
+
+    Details::VertexCache cache(vertexCount);
+
+    std::vector<bool> referenced(vertexCount, false);
+
+    uint32_t misses = 0;
+    uint32_t referencedCount = 0;
+
+    for (const uint32_t index : indices)
+    {
+        misses += cache.Access(index) ? 0 : 1;
+
+        if (!referenced[index])
+        {
+            referenced[index] = true;
+            ++referencedCount;
+        }
+    }
+
+    VertexCacheStatistics statistics;
+
+    if (!indices.empty())
+    {
+        statistics.acmr = static_cast<float>(misses) / static_cast<float>(indices.size() / 3);
+        statistics.atvr = static_cast<float>(misses) / static_cast<float>(referencedCount);
+    }
+
+    return statistics;
+}
+
+std::vector<uint32_t> MeshOptimizer::OptimizeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount)
+{
+    EASY_FUNCTION()
+
+    Assert(indices.size() % 3 == 0);
+
+    if (indices.empty())
+    {
+        return {};
+    }
+
+    const Details::TriangleAdjacency adjacency = Details::BuildTriangleAdjacency(indices, vertexCount);
+
+    std::vector<uint32_t> liveTriangleCounts(vertexCount);
+
+    for (uint32_t i = 0; i < vertexCount; ++i)
+    {
+        liveTriangleCounts[i] = adjacency.offsets[i + 1] - adjacency.offsets[i];
+    }
+
+    std::vector<bool> emittedTriangles(indices.size() / 3, false);
+
+    std::vector<uint32_t> deadEndStack;
+    std::vector<uint32_t> candidates;
+
+    Details::VertexCache cache(vertexCount);
+
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+
+    uint32_t cursor = 0;
+    uint32_t fanningVertex = Details::SkipDeadEnd(deadEndStack, liveTriangleCounts, cursor);
+
+    while (fanningVertex != kUnusedVertex)
+    {
+        candidates.clear();
+
+        for (uint32_t i = adjacency.offsets[fanningVertex]; i < adjacency.offsets[fanningVertex + 1]; ++i)
+        {
+            const uint32_t triangle = adjacency.triangles[i];
+
+            if (emittedTriangles[triangle])
+            {
+                continue;
+            }
+
+            for (uint32_t j = 0; j < 3; ++j)
+            {
+                const uint32_t vertex = indices[triangle * 3 + j];
+
+                result.push_back(vertex);
+
+                deadEndStack.push_back(vertex);
+                candidates.push_back(vertex);
+
+                --liveTriangleCounts[vertex];
+
+                cache.Access(vertex);
+            }
+
+            emittedTriangles[triangle] = true;
+        }
+
+        fanningVertex = Details::GetNextVertex(candidates, cache, liveTriangleCounts);
+
+        if (fanningVertex == kUnusedVertex)
+        {
+            fanningVertex = Details::SkipDeadEnd(deadEndStack, liveTriangleCounts, cursor);
+        }
+    }
+
+    Assert(result.size() == indices.size());
+
+    return result;
+}
+
+std::vector<uint32_t> MeshOptimizer::OptimizeOverdraw(const std::vector<uint32_t>& indices,
+        const std::vector<glm::vec3>& positions, float threshold)
+{
+    EASY_FUNCTION()
+
+    Assert(indices.size() % 3 == 0);
+
+    if (indices.empty())
+    {
+        return {};
+    }
+
+    const uint32_t vertexCount = static_cast<uint32_t>(positions.size());
+    const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+
+    std::vector<uint32_t> clusters = Details::FindClusters(indices, vertexCount, threshold);
+
+    clusters.push_back(triangleCount);
+
+    const size_t clusterCount = clusters.size() - 1;
+
+    std::vector<glm::vec3> clusterCentroids(clusterCount, Vector3::kZero);
+    std::vector<glm::vec3> clusterNormals(clusterCount, Vector3::kZero);
+
+    glm::vec3 meshCentroid = Vector3::kZero;
+    float meshArea = 0.0f;
+
+    for (size_t i = 0; i < clusterCount; ++i)
+    {
+        float clusterArea = 0.0f;
+
+        for (uint32_t j = clusters[i]; j < clusters[i + 1]; ++j)
+        {
+            const glm::vec3& position0 = positions[indices[j * 3]];
+            const glm::vec3& position1 = positions[indices[j * 3 + 1]];
+            const glm::vec3& position2 = positions[indices[j * 3 + 2]];
+
+            const glm::vec3 normal = glm::cross(position1 - position0, position2 - position0);
+            const float area = glm::length(normal);
+
+            const glm::vec3 centroid = (position0 + position1 + position2) / 3.0f;
+
+            clusterCentroids[i] += centroid * area;
+            clusterNormals[i] += normal;
+            clusterArea += area;
+        }
+
+        meshCentroid += clusterCentroids[i];
+        meshArea += clusterArea;
+
+        clusterCentroids[i] /= std::max(clusterArea, std::numeric_limits<float>::min());
+
+        const float normalLength = glm::length(clusterNormals[i]);
+
+        if (normalLength > 0.0f)
+        {
+            clusterNormals[i] /= normalLength;
+        }
+    }
+
+    meshCentroid /= std::max(meshArea, std::numeric_limits<float>::min());
+
+    // Clusters facing away from the centroid are the likely occluders, so they go first
+    std::vector<float> sortKeys(clusterCount);
+
+    for (size_t i = 0; i < clusterCount; ++i)
+    {
+        sortKeys[i] = glm::dot(clusterCentroids[i] - meshCentroid, clusterNormals[i]);
+    }
+
+    std::vector<uint32_t> order(clusterCount);
+
+    std::iota(order.begin(), order.end(), 0);
+
+    std::ranges::stable_sort(order, [&](uint32_t a, uint32_t b)
+        {
+            return sortKeys[a] > sortKeys[b];
+        });
+
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+
+    for (const uint32_t cluster : order)
+    {
+        const auto begin = indices.begin() + clusters[cluster] * 3;
+        const auto end = indices.begin() + clusters[cluster + 1] * 3;
+
+        result.insert(result.end(), begin, end);
+    }
+
+    return result;
+}
+
+std::vector<uint32_t> MeshOptimizer::OptimizeVertexFetch(std::vector<uint32_t>& indices, uint32_t vertexCount)
+{
+    EASY_FUNCTION()
+
+    std::vector<uint32_t> remap(vertexCount, kUnusedVertex);
+
+    uint32_t nextVertex = 0;
+
+    for (auto& index : indices)
+    {
+        Assert(index < vertexCount);
+
+        if (remap[index] == kUnusedVertex)
+        {
+            remap[index] = nextVertex++;
+        }
+
+        index = remap[index];
+    }
+
+    return remap;
+}
+
+std::vector<uint32_t> MeshOptimizer::WeldVertices(std::vector<uint32_t>& indices,
+        const std::vector<glm::vec3>& positions, const std::vector<glm::vec3>& normals,
+        const std::vector<glm::vec3>& tangents, const std::vector<glm::vec2>& texCoords)
+{
+    EASY_FUNCTION()
+
+    Assert(indices.size() % 3 == 0);
+    Assert(normals.empty() || normals.size() == positions.size());
+    Assert(tangents.empty() || tangents.size() == positions.size());
+    Assert(texCoords.empty() || texCoords.size() == positions.size());
+
+    const uint32_t vertexCount = static_cast<uint32_t>(positions.size());
+
+    AABBox bbox;
+
+    for (const auto& position : positions)
+    {
+        bbox.Add(position);
+    }
+
+    const float positionEpsilon = std::max(kWeldPositionEpsilon * bbox.GetLongestEdge(),
+            std::numeric_limits<float>::min());
+
+    std::unordered_map<Details::WeldKey, uint32_t, Details::WeldKeyHash> uniqueVertices;
+    uniqueVertices.reserve(vertexCount);
+
+    std::vector<uint32_t> remap(vertexCount);
+
+    for (uint32_t i = 0; i < vertexCount; ++i)
+    {
+        Details::WeldKey key{};
+
+        size_t keySize = 0;
+
+        const auto snap = [&](float value, float epsilon)
+            {
+                key[keySize++] = std::llround(value / epsilon);
+            };
+
+        const glm::vec3 position = positions[i] - bbox.GetMin();
+
+        snap(position.x, positionEpsilon);
+        snap(position.y, positionEpsilon);
+        snap(position.z, positionEpsilon);
+
+        if (!normals.empty())
+        {
+            snap(normals[i].x, kWeldDirectionEpsilon);
+            snap(normals[i].y, kWeldDirectionEpsilon);
+            snap(normals[i].z, kWeldDirectionEpsilon);
+        }
+
+        if (!tangents.empty())
+        {
+            snap(tangents[i].x, kWeldDirectionEpsilon);
+            snap(tangents[i].y, kWeldDirectionEpsilon);
+            snap(tangents[i].z, kWeldDirectionEpsilon);
+        }
+
+        if (!texCoords.empty())
+        {
+            snap(texCoords[i].x, kWeldTexCoordEpsilon);
+            snap(texCoords[i].y, kWeldTexCoordEpsilon);
+        }
+
+        const uint32_t uniqueIndex = static_cast<uint32_t>(uniqueVertices.size());
+
+        remap[i] = uniqueVertices.emplace(key, uniqueIndex).first->second;
+    }
+
+    for (auto& index : indices)
+    {
+        Assert(index < vertexCount);
+
+        index = remap[index];
+    }
+
+    indices = Details::RemoveDegenerateTriangles(indices);
+
+    return remap;
+}
+
+std::vector<uint32_t> MeshOptimizer::SimplifyMesh(const std::vector<uint32_t>& indices,
+        const std::vector<glm::vec3>& positions, size_t targetIndexCount, float targetError, float* resultError)
+{
+    EASY_FUNCTION()
+
+    Assert(indices.size() % 3 == 0);
+
+    const uint32_t vertexCount = static_cast<uint32_t>(positions.size());
+
+    std::vector<uint32_t> result = Details::RemoveDegenerateTriangles(indices);
+
+    const std::vector<bool> lockedVertices = Details::FindLockedVertices(result, vertexCount);
+
+    std::vector<Details::Quadric> quadrics = Details::ComputeQuadrics(result, positions);
+
+    const double maxError = static_cast<double>(targetError) * static_cast<double>(targetError);
+
+    double error = 0.0;
+
+    std::vector<uint32_t> remap(vertexCount);
+    std::vector<bool> dirtyVertices(vertexCount);
+
+    // Every pass performs an independent set of the cheapest collapses, fans of collapsed vertices are left alone
+    // until the next pass so that quadrics and flip tests always see up to date geometry
+    while (result.size() > targetIndexCount)
+    {
+        const Details::TriangleAdjacency adjacency = Details::BuildTriangleAdjacency(result, vertexCount);
+
+        const std::vector<Details::Collapse> collapses
+                = Details::FindCollapses(result, positions, quadrics, lockedVertices);
+
+        std::iota(remap.begin(), remap.end(), 0);
+        std::fill(dirtyVertices.begin(), dirtyVertices.end(), false);
+
+        size_t indexCount = result.size();
+        uint32_t collapseCount = 0;
+
+        for (const auto& collapse : collapses)
+        {
+            if (collapse.error > maxError || indexCount <= targetIndexCount)
+            {
+                break;
+            }
+
+            if (dirtyVertices[collapse.vertex] || dirtyVertices[collapse.target])
+            {
+                continue;
+            }
+
+            if (Details::FlipsTriangles(collapse, result, positions, adjacency))
+            {
+                continue;
+            }
+
+            for (uint32_t i = adjacency.offsets[collapse.vertex]; i < adjacency.offsets[collapse.vertex + 1]; ++i)
+            {
+                const uint32_t triangle = adjacency.triangles[i];
+
+                bool removed = false;
+
+                for (uint32_t j = 0; j < 3; ++j)
+                {
+                    const uint32_t vertex = result[triangle * 3 + j];
+
+                    dirtyVertices[vertex] = true;
+
+                    removed = removed || vertex == collapse.target;
+                }
+
+                if (removed)
+                {
+                    indexCount -= 3;
+                }
+            }
+
+            remap[collapse.vertex] = collapse.target;
+
+            quadrics[collapse.target] += quadrics[collapse.vertex];
+
+            error = std::max(error, collapse.error);
+
+            ++collapseCount;
+        }
+
+        if (collapseCount == 0)
+        {
+            break;
+        }
+
+        for (auto& index : result)
+        {
+            index = remap[index];
+        }
+
+        result = Details::RemoveDegenerateTriangles(result);
+    }
+
+    if (resultError)
+    {
+        *resultError = static_cast<float>(std::sqrt(error));
+    }
+
+    return result;
+}
@@ -0,0 +1,299 @@
+#include "Engine/Scene/Meshlet.hpp"
+
+#include "Utils/Assert.hpp"
+
+namespace Details
+{
+    static constexpr float kMinConeDot = 0.1f;
+
+    struct TriangleAdjacency
+    {
+        std::vector<uint32_t> offsets;
+        std::vector<uint32_t> triangles;
+    };
+
+    struct MeshletBuilder
+    {
+        std::vector<uint32_t> triangles;
+        std::vector<uint32_t> vertices;
+        std::vector<uint32_t> candidates;
+    };
+
+    static TriangleAdjacency BuildTriangleAdjacency(const std::vector<uint32_t>& indices, uint32_t vertexCount)
+    {
+        TriangleAdjacency adjacency;
+
+        adjacency.offsets.resize(vertexCount + 1, 0);
+        adjacency.triangles.resize(indices.size());
+
+        for (const uint32_t index : indices)
+        {
+            ++adjacency.offsets[index + 1];
+        }
+
+        for (uint32_t i = 0; i < vertexCount; ++i)
+        {
+            adjacency.offsets[i + 1] += adjacency.offsets[i];
+        }
+
+        std::vector<uint32_t> cursors(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            adjacency.triangles[cursors[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+
+        return adjacency;
+    }
+
+    static void ComputeBounds(Meshlet& meshlet, const std::vector<uint32_t>& indices,
+            const std::vector<glm::vec3>& positions)
+    {
+        const uint32_t firstIndex = meshlet.firstTriangle * 3;
+        const uint32_t indexCount = meshlet.triangleCount * 3;
+
+        for (uint32_t i = firstIndex; i < firstIndex + indexCount; ++i)
+        {
+            meshlet.bbox.Add(positions[indices[i]]);
+        }
+
+        meshlet.sphereCenter = meshlet.bbox.GetCenter();
+
+        for (uint32_t i = firstIndex; i < firstIndex + indexCount; ++i)
+        {
+            const float distance = glm::length(positions[indices[i]] - meshlet.sphereCenter);
+
+            meshlet.sphereRadius = std::max(meshlet.sphereRadius, distance);
+        }
+
+        // Unit normal and a point of every non-degenerate triangle
+        std::vector<std::pair<glm::vec3, glm::vec3>> planes;
+        planes.reserve(meshlet.triangleCount);
+
+        glm::vec3 normalSum = Vector3::kZero;
+
+        for (uint32_t i = firstIndex; i < firstIndex + indexCount; i += 3)
+        {
+            const glm::vec3& position0 = positions[indices[i]];
+            const glm::vec3& position1 = positions[indices[i + 1]];
+            const glm::vec3& position2 = positions[indices[i + 2]];
+
+            const glm::vec3 normal = glm::cross(position1 - position0, position2 - position0);
+            const float length = glm::length(normal);
+
+            if (length > 0.0f)
+            {
+                planes.emplace_back(normal / length, position0);
+
+                normalSum += normal / length;
+            }
+        }
+
+        const float normalSumLength = glm::length(normalSum);
+
+        if (planes.empty() || normalSumLength == 0.0f)
+        {
+            return;
+        }
+
+        const glm::vec3 axis = normalSum / normalSumLength;
+
+        float minDot = 1.0f;
+
+        for (const auto& plane : planes)
+        {
+            minDot = std::min(minDot, glm::dot(plane.first, axis));
+        }
+
+        meshlet.coneAxis = axis;
+
+        // Cones wider than ~84 degrees are rejected too rarely to be worth testing
+        if (minDot < kMinConeDot)
+        {
+            meshlet.coneApex = meshlet.sphereCenter;
+            return;
+        }
+
+        // Move the apex back along the axis until every triangle plane is in front of it
+        float maxT = 0.0f;
+
+        for (const auto& [normal, point] : planes)
+        {
+            maxT = std::max(maxT, glm::dot(meshlet.sphereCenter - point, normal) / glm::dot(normal, axis));
+        }
+
+        meshlet.coneApex = meshlet.sphereCenter - axis * maxT;
+        meshlet.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+    }
+}
+
+std::vector<Meshlet> MeshletHelpers::BuildMeshlets(
+        std::vector<uint32_t>& indices, const std::vector<glm::vec3>& positions)
+{
+    EASY_FUNCTION()
+
+    Assert(indices.size() % 3 == 0);
+
+    const uint32_t vertexCount = static_cast<uint32_t>(positions.size());
+    const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+
+    const Details::TriangleAdjacency adjacency = Details::BuildTriangleAdjacency(indices, vertexCount);
+
+    std::vector<bool> usedTriangles(triangleCount, false);
+
+    // Index of the last meshlet that referenced a vertex, so membership tests are O(1)
+    std::vector<uint32_t> vertexMeshlets(vertexCount, std::numeric_limits<uint32_t>::max());
+
+    std::vector<Meshlet> meshlets;
+
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+
+    Details::MeshletBuilder builder;
+
+    uint32_t seed = 0;
+
+    while (seed < triangleCount)
+    {
+        const uint32_t meshletIndex = static_cast<uint32_t>(meshlets.size());
+
+        builder.triangles.clear();
+        builder.vertices.clear();
+        builder.candidates.clear();
+
+        const auto getNewVertexCount = [&](uint32_t triangle)
+            {
+                uint32_t newVertexCount = 0;
+
+                for (uint32_t i = 0; i < 3; ++i)
+                {
+                    const uint32_t vertex = indices[triangle * 3 + i];
+
+                    const bool repeated = (i > 0 && vertex == indices[triangle * 3])
+                            || (i > 1 && vertex == indices[triangle * 3 + 1]);
+
+                    if (vertexMeshlets[vertex] != meshletIndex && !repeated)
+                    {
+                        ++newVertexCount;
+                    }
+                }
+
+                return newVertexCount;
+            };
+
+        uint32_t triangle = seed;
+
+        while (triangle != std::numeric_limits<uint32_t>::max())
+        {
+            builder.triangles.push_back(triangle);
+
+            usedTriangles[triangle] = true;
+
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                const uint32_t vertex = indices[triangle * 3 + i];
+
+                if (vertexMeshlets[vertex] != meshletIndex)
+                {
+                    vertexMeshlets[vertex] = meshletIndex;
+
+                    builder.vertices.push_back(vertex);
+
+                    for (uint32_t j = adjacency.offsets[vertex]; j < adjacency.offsets[vertex + 1]; ++j)
+                    {
+                        if (!usedTriangles[adjacency.triangles[j]])
+                        {
+                            builder.candidates.push_back(adjacency.triangles[j]);
+                        }
+                    }
+                }
+            }
+
+            if (builder.triangles.size() == kMaxTriangleCount)
+            {
+                break;
+            }
+
+            // Prefer adjacent triangles that add the fewest vertices, ties go to the earliest triangle
+            triangle = std::numeric_limits<uint32_t>::max();
+
+            uint32_t bestNewVertexCount = std::numeric_limits<uint32_t>::max();
+
+            std::erase_if(builder.candidates, [&](uint32_t candidate)
+                {
+                    return usedTriangles[candidate];
+                });
+
+            for (const uint32_t candidate : builder.candidates)
+            {
+                const uint32_t newVertexCount = getNewVertexCount(candidate);
+
+                if (builder.vertices.size() + newVertexCount > kMaxVertexCount)
+                {
+                    continue;
+                }
+
+                if (newVertexCount < bestNewVertexCount
+                        || (newVertexCount == bestNewVertexCount && candidate < triangle))
+                {
+                    triangle = candidate;
+                    bestNewVertexCount = newVertexCount;
+                }
+            }
+
+            // Disconnected parts continue with the next triangle in the original order
+            if (triangle == std::numeric_limits<uint32_t>::max())
+            {
+                while (seed < triangleCount && usedTriangles[seed])
+                {
+                    ++seed;
+                }
+
+                if (seed < triangleCount && builder.vertices.size() + getNewVertexCount(seed) <= kMaxVertexCount)
+                {
+                    triangle = seed;
+                }
+            }
+        }
+
+        while (seed < triangleCount && usedTriangles[seed])
+        {
+            ++seed;
+        }
+
+        // Keep the original order inside the meshlet to preserve vertex cache locality
+        std::ranges::sort(builder.triangles);
+
+        Meshlet meshlet;
+
+        meshlet.firstTriangle = static_cast<uint32_t>(result.size() / 3);
+        meshlet.triangleCount = static_cast<uint32_t>(builder.triangles.size());
+        meshlet.vertexCount = static_cast<uint32_t>(builder.vertices.size());
+
+        for (const uint32_t meshletTriangle : builder.triangles)
+        {
+            result.push_back(indices[meshletTriangle * 3]);
+            result.push_back(indices[meshletTriangle * 3 + 1]);
+            result.push_back(indices[meshletTriangle * 3 + 2]);
+        }
+
+        meshlets.push_back(meshlet);
+    }
+
+    Assert(result.size() == indices.size());
+
+    indices = std::move(result);
+
+    for (auto& meshlet : meshlets)
+    {
+        Details::ComputeBounds(meshlet, indices, positions);
+    }
+
+    return meshlets;
+}
+
+bool MeshletHelpers::IsBackfacing(const Meshlet& meshlet, const glm::vec3& eye)
+{
+    return meshlet.coneCutoff < 1.0f
+            && glm::dot(glm::normalize(meshlet.coneApex - eye), meshlet.coneAxis) >= meshlet.coneCutoff;
+}
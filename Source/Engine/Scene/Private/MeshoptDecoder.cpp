@@ -0,0 +1,761 @@
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define MESHOPT_DECODER_SSE2 1
+#endif
+
+#include "Engine/Scene/MeshoptDecoder.hpp"
+
+namespace Details
+{
+    static constexpr uint8_t kVertexHeader = 0xA0;
+    static constexpr uint8_t kIndexHeader = 0xE0;
+    static constexpr uint8_t kSequenceHeader = 0xD0;
+
+    static constexpr size_t kVertexBlockSizeBytes = 8192;
+    static constexpr size_t kVertexBlockMaxSize = 256;
+    static constexpr size_t kMaxVertexStride = 256;
+
+    static constexpr size_t kByteGroupSize = 16;
+
+    // Largest number of bytes a single byte group can read, checked once per group instead of per read
+    static constexpr size_t kByteGroupDecodeLimit = 24;
+
+    // Vertex data ends with the first vertex padded to at least this size
+    static constexpr size_t kTailMinSize = 32;
+
+    // Triangle codec data ends with a table of frequent codes, the sequence codec with a padding
+    static constexpr size_t kCodeAuxTableSize = 16;
+    static constexpr size_t kSequenceTailSize = 4;
+
+#if MESHOPT_DECODER_SSE2
+    static constexpr bool kSimdAvailable = true;
+#else
+    static constexpr bool kSimdAvailable = false;
+#endif
+
+    using VertexFifo = std::array<uint32_t, 16>;
+    using EdgeFifo = std::array<std::array<uint32_t, 2>, 16>;
+
+    static size_t GetVertexBlockSize(size_t stride)
+    {
+        const size_t blockSize = (kVertexBlockSizeBytes / stride) & ~(kByteGroupSize - 1);
+
+        return std::min(blockSize, kVertexBlockMaxSize);
+    }
+
+    static uint32_t Unzigzag32(uint32_t value)
+    {
+        return (0u - (value & 1)) ^ (value >> 1);
+    }
+
+    // Reads up to 5 bytes, the caller guarantees that they are available
+    static uint32_t DecodeVByte(const uint8_t*& data)
+    {
+        const uint8_t lead = *data++;
+
+        if (lead < 128)
+        {
+            return lead;
+        }
+
+        uint32_t result = lead & 127;
+        uint32_t shift = 7;
+
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            const uint8_t group = *data++;
+
+            result |= static_cast<uint32_t>(group & 127) << shift;
+            shift += 7;
+
+            if (group < 128)
+            {
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    static uint32_t DecodeIndex(const uint8_t*& data, uint32_t last)
+    {
+        return last + Unzigzag32(DecodeVByte(data));
+    }
+
+    static void WriteIndex(uint8_t* dst, size_t index, size_t indexSize, uint32_t value)
+    {
+        if (indexSize == sizeof(uint16_t))
+        {
+            const uint16_t value16 = static_cast<uint16_t>(value);
+
+            std::memcpy(dst + index * sizeof(uint16_t), &value16, sizeof(uint16_t));
+        }
+        else
+        {
+            std::memcpy(dst + index * sizeof(uint32_t), &value, sizeof(uint32_t));
+        }
+    }
+
+    static void WriteTriangle(uint8_t* dst, size_t index, size_t indexSize, uint32_t a, uint32_t b, uint32_t c)
+    {
+        WriteIndex(dst, index + 0, indexSize, a);
+        WriteIndex(dst, index + 1, indexSize, b);
+        WriteIndex(dst, index + 2, indexSize, c);
+    }
+
+    static void PushVertexFifo(VertexFifo& fifo, uint32_t vertex, size_t& offset, bool condition = true)
+    {
+        fifo[offset] = vertex;
+        offset = (offset + static_cast<size_t>(condition)) & 15;
+    }
+
+    static void PushEdgeFifo(EdgeFifo& fifo, uint32_t a, uint32_t b, size_t& offset)
+    {
+        fifo[offset] = { a, b };
+        offset = (offset + 1) & 15;
+    }
+
+    // 2 and 4 bit values are packed from the high bits, the largest value escapes to a full byte that follows
+    template <uint32_t Bits>
+    static const uint8_t* DecodeBytesGroupPacked(const uint8_t* data, uint8_t* dst)
+    {
+        constexpr uint32_t valuesPerByte = 8 / Bits;
+        constexpr uint8_t escape = (1 << Bits) - 1;
+
+        const uint8_t* extra = data + kByteGroupSize / valuesPerByte;
+
+        for (size_t i = 0; i < kByteGroupSize; i += valuesPerByte)
+        {
+            uint8_t byte = *data++;
+
+            for (uint32_t j = 0; j < valuesPerByte; ++j)
+            {
+                const uint8_t value = static_cast<uint8_t>(byte >> (8 - Bits));
+                byte = static_cast<uint8_t>(byte << Bits);
+
+                dst[i + j] = value == escape ? *extra : value;
+                extra += value == escape;
+            }
+        }
+
+        return extra;
+    }
+
+#if MESHOPT_DECODER_SSE2
+    // Unpacks the group with a few shifts, groups that contain escapes fall back to the scalar path
+    template <uint32_t Bits>
+    static const uint8_t* DecodeBytesGroupPackedSimd(const uint8_t* data, uint8_t* dst)
+    {
+        __m128i values;
+
+        if constexpr (Bits == 2)
+        {
+            int32_t packed;
+            std::memcpy(&packed, data, sizeof(packed));
+
+            const __m128i bytes = _mm_cvtsi32_si128(packed);
+            const __m128i mask = _mm_set1_epi8(3);
+
+            const __m128i v0 = _mm_and_si128(_mm_srli_epi16(bytes, 6), mask);
+            const __m128i v1 = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+            const __m128i v2 = _mm_and_si128(_mm_srli_epi16(bytes, 2), mask);
+            const __m128i v3 = _mm_and_si128(bytes, mask);
+
+            values = _mm_unpacklo_epi16(_mm_unpacklo_epi8(v0, v1), _mm_unpacklo_epi8(v2, v3));
+        }
+        else
+        {
+            const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data));
+            const __m128i mask = _mm_set1_epi8(15);
+
+            const __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+            const __m128i low = _mm_and_si128(bytes, mask);
+
+            values = _mm_unpacklo_epi8(high, low);
+        }
+
+        const __m128i escape = _mm_set1_epi8((1 << Bits) - 1);
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(values, escape)) != 0)
+        {
+            return DecodeBytesGroupPacked<Bits>(data, dst);
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), values);
+
+        return data + kByteGroupSize * Bits / 8;
+    }
+#endif
+
+    template <bool Simd>
+    static const uint8_t* DecodeBytesGroup(const uint8_t* data, uint8_t* dst, uint32_t bitsLog2)
+    {
+        switch (bitsLog2)
+        {
+        case 0:
+            std::memset(dst, 0, kByteGroupSize);
+            return data;
+        case 1:
+#if MESHOPT_DECODER_SSE2
+            if constexpr (Simd)
+            {
+                return DecodeBytesGroupPackedSimd<2>(data, dst);
+            }
+            else
+#endif
+            {
+                return DecodeBytesGroupPacked<2>(data, dst);
+            }
+        case 2:
+#if MESHOPT_DECODER_SSE2
+            if constexpr (Simd)
+            {
+                return DecodeBytesGroupPackedSimd<4>(data, dst);
+            }
+            else
+#endif
+            {
+                return DecodeBytesGroupPacked<4>(data, dst);
+            }
+        default:
+            std::memcpy(dst, data, kByteGroupSize);
+            return data + kByteGroupSize;
+        }
+    }
+
+    // Groups of 16 bytes with 2-bit headers that select 0, 2, 4 or 8 bits per byte
+    template <bool Simd>
+    static const uint8_t* DecodeBytes(const uint8_t* data, const uint8_t* dataEnd, uint8_t* dst, size_t size)
+    {
+        const size_t groupCount = size / kByteGroupSize;
+        const size_t headerSize = (groupCount + 3) / 4;
+
+        if (static_cast<size_t>(dataEnd - data) < headerSize)
+        {
+            return nullptr;
+        }
+
+        const uint8_t* header = data;
+        data += headerSize;
+
+        for (size_t i = 0; i < groupCount; ++i)
+        {
+            if (static_cast<size_t>(dataEnd - data) < kByteGroupDecodeLimit)
+            {
+                return nullptr;
+            }
+
+            const uint32_t bitsLog2 = (header[i / 4] >> ((i % 4) * 2)) & 3;
+
+            data = DecodeBytesGroup<Simd>(data, dst + i * kByteGroupSize, bitsLog2);
+        }
+
+        return data;
+    }
+
+    // Reconstructs 4 consecutive bytes of every vertex from zigzag encoded deltas
+    template <bool Simd>
+    static void DecodeDeltas4(const std::array<std::array<uint8_t, kVertexBlockMaxSize>, 4>& deltas,
+            uint8_t* dst, size_t count, size_t stride, uint8_t* lastVertex)
+    {
+#if MESHOPT_DECODER_SSE2
+        if constexpr (Simd)
+        {
+            const __m128i one = _mm_set1_epi8(1);
+            const __m128i lowMask = _mm_set1_epi8(127);
+
+            const auto unzigzag = [&](const uint8_t* src)
+                {
+                    const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+                    const __m128i sign = _mm_sub_epi8(_mm_setzero_si128(), _mm_and_si128(value, one));
+
+                    return _mm_xor_si128(sign, _mm_and_si128(_mm_srli_epi16(value, 1), lowMask));
+                };
+
+            int32_t last32;
+            std::memcpy(&last32, lastVertex, sizeof(last32));
+
+            __m128i last = _mm_set1_epi32(last32);
+
+            // Transposes 16 vertices into 4 registers of 4 vertices, then sums the deltas within and across them
+            for (size_t i = 0; i < count; i += kByteGroupSize)
+            {
+                const __m128i r0 = unzigzag(deltas[0].data() + i);
+                const __m128i r1 = unzigzag(deltas[1].data() + i);
+                const __m128i r2 = unzigzag(deltas[2].data() + i);
+                const __m128i r3 = unzigzag(deltas[3].data() + i);
+
+                const __m128i t0 = _mm_unpacklo_epi8(r0, r1);
+                const __m128i t1 = _mm_unpackhi_epi8(r0, r1);
+                const __m128i t2 = _mm_unpacklo_epi8(r2, r3);
+                const __m128i t3 = _mm_unpackhi_epi8(r2, r3);
+
+                const __m128i vertices[4] = {
+                    _mm_unpacklo_epi16(t0, t2),
+                    _mm_unpackhi_epi16(t0, t2),
+                    _mm_unpacklo_epi16(t1, t3),
+                    _mm_unpackhi_epi16(t1, t3)
+                };
+
+                for (size_t j = 0; j < 4; ++j)
+                {
+                    __m128i v = vertices[j];
+
+                    v = _mm_add_epi8(v, _mm_slli_si128(v, 4));
+                    v = _mm_add_epi8(v, _mm_slli_si128(v, 8));
+                    v = _mm_add_epi8(v, last);
+
+                    last = _mm_shuffle_epi32(v, 0xFF);
+
+                    uint8_t* vertexDst = dst + (i + j * 4) * stride;
+
+                    for (size_t k = 0; k < 4; ++k)
+                    {
+                        const int32_t value = _mm_cvtsi128_si32(v);
+                        std::memcpy(vertexDst + k * stride, &value, sizeof(value));
+
+                        v = _mm_srli_si128(v, 4);
+                    }
+                }
+            }
+        }
+        else
+#endif
+        {
+            const auto unzigzag = [](uint8_t value)
+                {
+                    return static_cast<uint8_t>(-(value & 1) ^ (value >> 1));
+                };
+
+            std::array<uint8_t, 4> last;
+            std::memcpy(last.data(), lastVertex, last.size());
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                for (size_t k = 0; k < last.size(); ++k)
+                {
+                    last[k] = static_cast<uint8_t>(last[k] + unzigzag(deltas[k][i]));
+                }
+
+                std::memcpy(dst + i * stride, last.data(), last.size());
+            }
+        }
+    }
+
+    // The block is decoded for a group aligned vertex count into scratch, then the real vertices are copied out
+    template <bool Simd>
+    static const uint8_t* DecodeVertexBlock(const uint8_t* data, const uint8_t* dataEnd,
+            uint8_t* dst, size_t count, size_t stride, uint8_t* lastVertex)
+    {
+        const size_t alignedCount = (count + kByteGroupSize - 1) & ~(kByteGroupSize - 1);
+
+        std::array<std::array<uint8_t, kVertexBlockMaxSize>, 4> deltas;
+        std::array<uint8_t, kVertexBlockSizeBytes> transposed;
+
+        for (size_t k = 0; k < stride; k += 4)
+        {
+            for (size_t j = 0; j < 4; ++j)
+            {
+                data = DecodeBytes<Simd>(data, dataEnd, deltas[j].data(), alignedCount);
+
+                if (!data)
+                {
+                    return nullptr;
+                }
+            }
+
+            DecodeDeltas4<Simd>(deltas, transposed.data() + k, alignedCount, stride, lastVertex + k);
+
+            std::memcpy(lastVertex + k, transposed.data() + (count - 1) * stride + k, 4);
+        }
+
+        std::memcpy(dst, transposed.data(), count * stride);
+
+        return data;
+    }
+
+    template <class T>
+    static T RoundToInt(float value)
+    {
+        return static_cast<T>(static_cast<int32_t>(value + (value >= 0.0f ? 0.5f : -0.5f)));
+    }
+
+    // Unit vectors stored as octahedral x and y, z holds the encoding of 1.0 and w is untouched
+    template <class T>
+    static void UnfilterOctahedral(uint8_t* data, size_t count)
+    {
+        constexpr float maxValue = static_cast<float>(std::numeric_limits<T>::max());
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::array<T, 4> values;
+            std::memcpy(values.data(), data + i * sizeof(values), sizeof(values));
+
+            float x = static_cast<float>(values[0]);
+            float y = static_cast<float>(values[1]);
+            const float z = static_cast<float>(values[2]) - std::abs(x) - std::abs(y);
+
+            const float t = std::min(z, 0.0f);
+
+            x += x >= 0.0f ? t : -t;
+            y += y >= 0.0f ? t : -t;
+
+            const float length = std::sqrt(x * x + y * y + z * z);
+
+            // Malformed input can produce a zero vector, which mustn't turn into an infinite scale
+            const float scale = length > 0.0f ? maxValue / length : 0.0f;
+
+            values[0] = RoundToInt<T>(x * scale);
+            values[1] = RoundToInt<T>(y * scale);
+            values[2] = RoundToInt<T>(z * scale);
+
+            std::memcpy(data + i * sizeof(values), values.data(), sizeof(values));
+        }
+    }
+
+    // Three smallest components of a unit quaternion, the low 2 bits of w select the dropped component
+    static void UnfilterQuaternion(uint8_t* data, size_t count)
+    {
+        const float range = 1.0f / std::sqrt(2.0f);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::array<int16_t, 4> values;
+            std::memcpy(values.data(), data + i * sizeof(values), sizeof(values));
+
+            const float scale = range / static_cast<float>(values[3] | 3);
+
+            const float x = static_cast<float>(values[0]) * scale;
+            const float y = static_cast<float>(values[1]) * scale;
+            const float z = static_cast<float>(values[2]) * scale;
+
+            const float w = std::sqrt(std::max(1.0f - x * x - y * y - z * z, 0.0f));
+
+            const int32_t maxComponent = values[3] & 3;
+
+            values[(maxComponent + 1) & 3] = RoundToInt<int16_t>(x * 32767.0f);
+            values[(maxComponent + 2) & 3] = RoundToInt<int16_t>(y * 32767.0f);
+            values[(maxComponent + 3) & 3] = RoundToInt<int16_t>(z * 32767.0f);
+            values[(maxComponent + 0) & 3] = RoundToInt<int16_t>(w * 32767.0f);
+
+            std::memcpy(data + i * sizeof(values), values.data(), sizeof(values));
+        }
+    }
+
+    // 24-bit signed mantissa and 8-bit signed exponent to float
+    static void UnfilterExponential(uint8_t* data, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint32_t value;
+            std::memcpy(&value, data + i * sizeof(value), sizeof(value));
+
+            const int32_t mantissa = static_cast<int32_t>(value << 8) >> 8;
+            const int32_t exponent = static_cast<int32_t>(value) >> 24;
+
+            const float power = std::bit_cast<float>(static_cast<uint32_t>(exponent + 127) << 23);
+
+            value = std::bit_cast<uint32_t>(power * static_cast<float>(mantissa));
+
+            std::memcpy(data + i * sizeof(value), &value, sizeof(value));
+        }
+    }
+
+    template <bool Simd>
+    static bool DecodeVertexBuffer(const ByteAccess& dst, size_t count, size_t stride, const ByteView& src)
+    {
+        if (stride == 0 || stride > kMaxVertexStride || stride % 4 != 0 || count > dst.size / stride)
+        {
+            return false;
+        }
+
+        if (src.size < 1 + stride)
+        {
+            return false;
+        }
+
+        const uint8_t* data = src.data;
+        const uint8_t* dataEnd = src.data + src.size;
+
+        if (*data++ != kVertexHeader)
+        {
+            return false;
+        }
+
+        std::array<uint8_t, kMaxVertexStride> lastVertex;
+        std::memcpy(lastVertex.data(), dataEnd - stride, stride);
+
+        const size_t blockSize = GetVertexBlockSize(stride);
+
+        for (size_t offset = 0; offset < count; offset += blockSize)
+        {
+            const size_t blockCount = std::min(blockSize, count - offset);
+
+            data = DecodeVertexBlock<Simd>(data, dataEnd, dst.data + offset * stride,
+                    blockCount, stride, lastVertex.data());
+
+            if (!data)
+            {
+                return false;
+            }
+        }
+
+        return static_cast<size_t>(dataEnd - data) == std::max(stride, kTailMinSize);
+    }
+}
+
+bool MeshoptDecoder::DecodeVertexBuffer(const ByteAccess& dst, size_t count, size_t stride, const ByteView& src)
+{
+    return Details::DecodeVertexBuffer<Details::kSimdAvailable>(dst, count, stride, src);
+}
+
+bool MeshoptDecoder::DecodeVertexBufferScalar(const ByteAccess& dst, size_t count, size_t stride, const ByteView& src)
+{
+    return Details::DecodeVertexBuffer<false>(dst, count, stride, src);
+}
+
+bool MeshoptDecoder::DecodeIndexBuffer(const ByteAccess& dst, size_t count, size_t indexSize, const ByteView& src)
+{
+    if (count % 3 != 0 || (indexSize != 2 && indexSize != 4) || count > dst.size / indexSize)
+    {
+        return false;
+    }
+
+    if (src.size < 1 + count / 3 + Details::kCodeAuxTableSize)
+    {
+        return false;
+    }
+
+    const uint8_t header = src.data[0];
+
+    if ((header & 0xF0) != Details::kIndexHeader || (header & 0x0F) > 1)
+    {
+        return false;
+    }
+
+    // Version 1 uses the last vertex FIFO codes for small deltas from the previous free index
+    const uint32_t maxFifoCode = (header & 0x0F) >= 1 ? 13 : 15;
+
+    Details::EdgeFifo edgeFifo;
+    Details::VertexFifo vertexFifo;
+
+    for (auto& edge : edgeFifo)
+    {
+        edge = { ~0u, ~0u };
+    }
+
+    vertexFifo.fill(~0u);
+
+    size_t edgeFifoOffset = 0;
+    size_t vertexFifoOffset = 0;
+
+    uint32_t next = 0;
+    uint32_t last = 0;
+
+    const uint8_t* code = src.data + 1;
+    const uint8_t* data = code + count / 3;
+
+    // A triangle reads at most 16 bytes of data, the code table behind the data keeps these reads in bounds
+    const uint8_t* dataSafeEnd = src.data + src.size - Details::kCodeAuxTableSize;
+    const uint8_t* codeAuxTable = dataSafeEnd;
+
+    for (size_t i = 0; i < count; i += 3)
+    {
+        if (data > dataSafeEnd)
+        {
+            return false;
+        }
+
+        const uint8_t codeTri = *code++;
+
+        if (codeTri < 0xF0)
+        {
+            // Edge from the FIFO and a vertex that is new, from the FIFO or encoded explicitly
+            const auto [a, b] = edgeFifo[(edgeFifoOffset - 1 - (codeTri >> 4)) & 15];
+
+            const uint32_t fec = codeTri & 15;
+
+            uint32_t c;
+
+            if (fec < maxFifoCode)
+            {
+                c = fec == 0 ? next++ : vertexFifo[(vertexFifoOffset - 1 - fec) & 15];
+
+                Details::PushVertexFifo(vertexFifo, c, vertexFifoOffset, fec == 0);
+            }
+            else
+            {
+                if (fec == 15)
+                {
+                    c = Details::DecodeIndex(data, last);
+                }
+                else
+                {
+                    c = fec == 13 ? last - 1 : last + 1;
+                }
+
+                last = c;
+
+                Details::PushVertexFifo(vertexFifo, c, vertexFifoOffset);
+            }
+
+            Details::WriteTriangle(dst.data, i, indexSize, a, b, c);
+
+            Details::PushEdgeFifo(edgeFifo, c, b, edgeFifoOffset);
+            Details::PushEdgeFifo(edgeFifo, a, c, edgeFifoOffset);
+        }
+        else
+        {
+            // Triangle that starts with a new vertex, the other two are described by a code from the table or a byte
+            const bool tableCode = codeTri < 0xFE;
+
+            const uint8_t codeAux = tableCode ? codeAuxTable[codeTri & 15] : *data++;
+
+            const uint32_t fea = codeTri == 0xFF ? 15 : 0;
+            const uint32_t feb = codeAux >> 4;
+            const uint32_t fec = codeAux & 15;
+
+            if (!tableCode && codeAux == 0)
+            {
+                next = 0;
+            }
+
+            uint32_t a = fea == 0 ? next++ : 0;
+            uint32_t b = feb == 0 ? next++ : vertexFifo[(vertexFifoOffset - feb) & 15];
+            uint32_t c = fec == 0 ? next++ : vertexFifo[(vertexFifoOffset - fec) & 15];
+
+            // Table codes never hold free indices, so this only happens for explicit codes
+            if (fea == 15)
+            {
+                last = a = Details::DecodeIndex(data, last);
+            }
+            if (feb == 15)
+            {
+                last = b = Details::DecodeIndex(data, last);
+            }
+            if (fec == 15)
+            {
+                last = c = Details::DecodeIndex(data, last);
+            }
+
+            Details::WriteTriangle(dst.data, i, indexSize, a, b, c);
+
+            Details::PushVertexFifo(vertexFifo, a, vertexFifoOffset);
+            Details::PushVertexFifo(vertexFifo, b, vertexFifoOffset, feb == 0 || feb == 15);
+            Details::PushVertexFifo(vertexFifo, c, vertexFifoOffset, fec == 0 || fec == 15);
+
+            Details::PushEdgeFifo(edgeFifo, b, a, edgeFifoOffset);
+            Details::PushEdgeFifo(edgeFifo, c, b, edgeFifoOffset);
+            Details::PushEdgeFifo(edgeFifo, a, c, edgeFifoOffset);
+        }
+    }
+
+    return data == dataSafeEnd;
+}
+
+bool MeshoptDecoder::DecodeIndexSequence(const ByteAccess& dst, size_t count, size_t indexSize, const ByteView& src)
+{
+    if ((indexSize != 2 && indexSize != 4) || count > dst.size / indexSize)
+    {
+        return false;
+    }
+
+    if (src.size < 1 + count + Details::kSequenceTailSize)
+    {
+        return false;
+    }
+
+    const uint8_t header = src.data[0];
+
+    if ((header & 0xF0) != Details::kSequenceHeader || (header & 0x0F) > 1)
+    {
+        return false;
+    }
+
+    const uint8_t* data = src.data + 1;
+
+    // An index reads at most 5 bytes, the tail keeps these reads in bounds
+    const uint8_t* dataSafeEnd = src.data + src.size - Details::kSequenceTailSize;
+
+    // Deltas are relative to one of two baselines, which suits interleaved index ranges
+    std::array<uint32_t, 2> last = {};
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (data >= dataSafeEnd)
+        {
+            return false;
+        }
+
+        const uint32_t value = Details::DecodeVByte(data);
+
+        const uint32_t baseline = value & 1;
+
+        last[baseline] += Details::Unzigzag32(value >> 1);
+
+        Details::WriteIndex(dst.data, i, indexSize, last[baseline]);
+    }
+
+    return data == dataSafeEnd;
+}
+
+bool MeshoptDecoder::ApplyFilter(const ByteAccess& data, size_t count, size_t stride, Filter filter)
+{
+    if (stride == 0 || count > data.size / stride)
+    {
+        return false;
+    }
+
+    switch (filter)
+    {
+    case Filter::eNone:
+        return true;
+    case Filter::eOctahedral:
+        if (stride == 4)
+        {
+            Details::UnfilterOctahedral<int8_t>(data.data, count);
+            return true;
+        }
+        if (stride == 8)
+        {
+            Details::UnfilterOctahedral<int16_t>(data.data, count);
+            return true;
+        }
+        return false;
+    case Filter::eQuaternion:
+        if (stride == 8)
+        {
+            Details::UnfilterQuaternion(data.data, count);
+            return true;
+        }
+        return false;
+    case Filter::eExponential:
+        if (stride % 4 == 0)
+        {
+            Details::UnfilterExponential(data.data, count * stride / 4);
+            return true;
+        }
+        return false;
+    default:
+        return false;
+    }
+}
+
+bool MeshoptDecoder::Decode(const ByteAccess& dst, size_t count, size_t stride,
+        Mode mode, Filter filter, const ByteView& src)
+{
+    switch (mode)
+    {
+    case Mode::eAttributes:
+        return DecodeVertexBuffer(dst, count, stride, src) && ApplyFilter(dst, count, stride, filter);
+    case Mode::eTriangles:
+        return filter == Filter::eNone && DecodeIndexBuffer(dst, count, stride, src);
+    case Mode::eIndices:
+        return filter == Filter::eNone && DecodeIndexSequence(dst, count, stride, src);
+    default:
+        return false;
+    }
+}
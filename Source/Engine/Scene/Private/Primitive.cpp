@@ -1,141 +1,112 @@
 #include "Engine/Scene/Primitive.hpp"
 
+#include "Engine/Render/FrameLoop.hpp"
+#include "Engine/Render/RenderContext.hpp"
+#include "Engine/Render/Vulkan/VulkanContext.hpp"
 #include "Engine/Render/Vulkan/Pipelines/GraphicsPipeline.hpp"
 #include "Engine/Render/Vulkan/Resources/ResourceContext.hpp"
+#include "Engine/Scene/VertexQuantization.hpp"
 
 #include "Utils/Assert.hpp"
 #include "Utils/Helpers.hpp"
 
 namespace Details
 {
-    static std::vector<glm::vec3> ComputeNormals(
-            const std::vector<uint32_t>& indices,
-            const std::vector<glm::vec3>& positions)
+    // Vertex streams in the order of Primitive::kVertexInputs
+    static constexpr uint32_t kPositionStream = 0;
+    static constexpr uint32_t kNormalStream = 1;
+    static constexpr uint32_t kTangentStream = 2;
+    static constexpr uint32_t kTexCoordStream = 3;
+
+    // Padded to a whole number of 32-bit words, so shaders can fetch 16-bit indices in pairs
+    static std::vector<uint16_t> NarrowIndices(const DataView<uint32_t>& indices)
     {
-        Assert(!positions.empty());
+        std::vector<uint16_t> narrowIndices((indices.size + 1) / 2 * 2, 0);
 
-        std::vector<glm::vec3> normals = Repeat(Vector3::kZero, positions.size());
-
-        for (size_t i = 0; i < indices.size(); i = i + 3)
+        for (size_t i = 0; i < indices.size; ++i)
         {
-            const glm::vec3& position0 = positions[indices[i]];
-            const glm::vec3& position1 = positions[indices[i + 1]];
-            const glm::vec3& position2 = positions[indices[i + 2]];
-
-            const glm::vec3 edge1 = position1 - position0;
-            const glm::vec3 edge2 = position2 - position0;
-
-            const glm::vec3 normal = glm::normalize(glm::cross(edge1, edge2));
+            Assert(indices[i] <= std::numeric_limits<uint16_t>::max());
 
-            normals[indices[i]] += normal;
-            normals[indices[i + 1]] += normal;
-            normals[indices[i + 2]] += normal;
+            narrowIndices[i] = static_cast<uint16_t>(indices[i]);
         }
 
-        for (auto& normal : normals)
-        {
-            normal = glm::normalize(normal);
-        }
-
-        return normals;
+        return narrowIndices;
     }
 
-    static std::vector<glm::vec3> ComputeTangents(
-            const std::vector<uint32_t>& indices,
-            const std::vector<glm::vec3>& positions,
-            const std::vector<glm::vec2>& texCoords)
+    template <class T>
+    static size_t GetCapacitySize(const std::vector<T>& values)
     {
-        Assert(!positions.empty());
-        Assert(!texCoords.empty());
-
-        std::vector<glm::vec3> tangents = Repeat(Vector3::kZero, positions.size());
-
-        for (size_t i = 0; i < indices.size(); i = i + 3)
-        {
-            const glm::vec3& position0 = positions[indices[i]];
-            const glm::vec3& position1 = positions[indices[i + 1]];
-            const glm::vec3& position2 = positions[indices[i + 2]];
-
-            const glm::vec3 edge1 = position1 - position0;
-            const glm::vec3 edge2 = position2 - position0;
-
-            const glm::vec2& texCoord0 = texCoords[indices[i]];
-            const glm::vec2& texCoord1 = texCoords[indices[i + 1]];
-            const glm::vec2& texCoord2 = texCoords[indices[i + 2]];
-
-            const glm::vec2 deltaTexCoord1 = texCoord1 - texCoord0;
-            const glm::vec2 deltaTexCoord2 = texCoord2 - texCoord0;
-
-            float d = deltaTexCoord1.x * deltaTexCoord2.y - deltaTexCoord1.y * deltaTexCoord2.x;
-
-            if (d == 0.0f)
-            {
-                d = 1.0f;
-            }
+        return values.capacity() * sizeof(T);
+    }
 
-            const glm::vec3 tangent = (edge1 * deltaTexCoord2.y - edge2 * deltaTexCoord1.y) / d;
+    static size_t GetCpuGeometrySize(const MeshData& meshData)
+    {
+        return GetCapacitySize(meshData.indices)
+                + GetCapacitySize(meshData.positions)
+                + GetCapacitySize(meshData.normals)
+                + GetCapacitySize(meshData.tangents)
+                + GetCapacitySize(meshData.texCoords);
+    }
 
-            tangents[indices[i]] += tangent;
-            tangents[indices[i + 1]] += tangent;
-            tangents[indices[i + 2]] += tangent;
-        }
+    static std::vector<VertexInput> GetInstancedVertexInputs(
+            const std::vector<VertexInput>& vertexInputs, const VertexInput& instanceInput)
+    {
+        std::vector<VertexInput> instancedVertexInputs = vertexInputs;
 
-        for (auto& tangent : tangents)
-        {
-            if (glm::length(tangent) > 0.0f)
-            {
-                tangent = glm::normalize(tangent);
-            }
-            else
-            {
-                tangent.x = 1.0f;
-            }
-        }
+        instancedVertexInputs.push_back(instanceInput);
 
-        return tangents;
+        return instancedVertexInputs;
     }
 }
 
-const std::vector<VertexInput> Primitive::kVertexInputs{
-    VertexInput{ { vk::Format::eR32G32B32Sfloat }, 0, vk::VertexInputRate::eVertex },
-    VertexInput{ { vk::Format::eR32G32B32Sfloat }, 0, vk::VertexInputRate::eVertex },
-    VertexInput{ { vk::Format::eR32G32B32Sfloat }, 0, vk::VertexInputRate::eVertex },
-    VertexInput{ { vk::Format::eR32G32Sfloat }, 0, vk::VertexInputRate::eVertex }
+const std::vector<VertexInput> Primitive::kVertexInputs = Config::kQuantizedVertices
+        ? std::vector<VertexInput>{
+            VertexInput{ { vk::Format::eR16G16B16A16Unorm }, 0, vk::VertexInputRate::eVertex },
+            VertexInput{ { vk::Format::eR16G16Snorm }, 0, vk::VertexInputRate::eVertex },
+            VertexInput{ { vk::Format::eR16G16Snorm }, 0, vk::VertexInputRate::eVertex },
+            VertexInput{ { vk::Format::eR16G16Sfloat }, 0, vk::VertexInputRate::eVertex }
+        }
+        : std::vector<VertexInput>{
+            VertexInput{ { vk::Format::eR32G32B32Sfloat }, 0, vk::VertexInputRate::eVertex },
+            VertexInput{ { vk::Format::eR32G32B32Sfloat }, 0, vk::VertexInputRate::eVertex },
+            VertexInput{ { vk::Format::eR32G32B32Sfloat }, 0, vk::VertexInputRate::eVertex },
+            VertexInput{ { vk::Format::eR32G32Sfloat }, 0, vk::VertexInputRate::eVertex }
+        };
+
+const VertexInput Primitive::kInstanceInput{
+    { vk::Format::eR32G32B32A32Sfloat, vk::Format::eR32G32B32A32Sfloat, vk::Format::eR32G32B32A32Sfloat },
+    0, vk::VertexInputRate::eInstance
 };
 
-Primitive::Primitive(std::vector<uint32_t> indices_,
-        std::vector<glm::vec3> positions_, std::vector<glm::vec3> normals_,
-        std::vector<glm::vec3> tangents_, std::vector<glm::vec2> texCoords_)
-    : indices(std::move(indices_))
-    , positions(std::move(positions_))
-    , normals(std::move(normals_))
-    , tangents(std::move(tangents_))
-    , texCoords(std::move(texCoords_))
+const std::vector<VertexInput> Primitive::kInstancedVertexInputs
+        = Details::GetInstancedVertexInputs(Primitive::kVertexInputs, Primitive::kInstanceInput);
+
+Primitive::Primitive(MeshData meshData_)
+    : meshData(std::move(meshData_))
 {
-    if (normals.empty())
-    {
-        normals = Details::ComputeNormals(indices, positions);
-    }
-    if (texCoords.empty())
-    {
-        texCoords = Repeat(Vector2::kZero, GetVertexCount());
-    }
-    if (tangents.empty())
-    {
-        tangents = Details::ComputeTangents(indices, positions, texCoords);
-    }
+    Assert(meshData.normals.size() == meshData.positions.size());
+    Assert(meshData.tangents.size() == meshData.positions.size());
+    Assert(meshData.texCoords.size() == meshData.positions.size());
+    Assert(!meshData.lods.empty());
 
-    for (const auto& position : positions)
-    {
-        bbox.Add(position);
-    }
+    indexCount = meshData.GetIndexCount();
+    vertexCount = meshData.GetVertexCount();
+}
 
-    CreateBuffers();
+Primitive::Primitive(const MeshView& meshView)
+    : externalGeometry(meshView)
+{
+    Assert(meshView.normals.size == meshView.positions.size);
+    Assert(meshView.tangents.size == meshView.positions.size);
+    Assert(meshView.texCoords.size == meshView.positions.size);
+    Assert(meshView.lods.size > 0);
 
-    if constexpr (Config::kRayTracingEnabled)
-    {
-        GenerateBlas();
-    }
+    meshData.bbox = meshView.bbox;
+    meshData.meshlets = meshView.meshlets.GetCopy();
+    meshData.lods = meshView.lods.GetCopy();
+
+    indexCount = static_cast<uint32_t>(meshView.indices.size);
+    vertexCount = static_cast<uint32_t>(meshView.positions.size);
 }
 
 Primitive::Primitive(const Primitive& other) noexcept
@@ -145,38 +116,32 @@ Primitive::Primitive(const Primitive& other) noexcept
     DestroyBuffers();
     DestroyBlas();
 
-    indices = other.indices;
-    positions = other.positions;
-    normals = other.normals;
-    tangents = other.tangents;
-    texCoords = other.texCoords;
+    meshData = other.meshData;
+
+    externalGeometry = other.externalGeometry;
+
+    indexCount = other.indexCount;
+    vertexCount = other.vertexCount;
 
-    bbox = other.bbox;
+    residency = other.residency;
 
-    indexBuffer = other.indexBuffer;
-    positionBuffer = other.positionBuffer;
-    normalBuffer = other.normalBuffer;
-    tangentBuffer = other.tangentBuffer;
-    texCoordBuffer = other.texCoordBuffer;
+    geometry = other.geometry;
 
     blas = other.blas;
 }
 
 Primitive::Primitive(Primitive&& other) noexcept
 {
-    std::swap(indices, other.indices);
-    std::swap(positions, other.positions);
-    std::swap(normals, other.normals);
-    std::swap(tangents, other.tangents);
-    std::swap(texCoords, other.texCoords);
+    std::swap(meshData, other.meshData);
 
-    std::swap(bbox, other.bbox);
+    std::swap(externalGeometry, other.externalGeometry);
 
-    std::swap(indexBuffer, other.indexBuffer);
-    std::swap(positionBuffer, other.positionBuffer);
-    std::swap(normalBuffer, other.normalBuffer);
-    std::swap(tangentBuffer, other.tangentBuffer);
-    std::swap(texCoordBuffer, other.texCoordBuffer);
+    std::swap(indexCount, other.indexCount);
+    std::swap(vertexCount, other.vertexCount);
+
+    std::swap(residency, other.residency);
+
+    std::swap(geometry, other.geometry);
 
     std::swap(blas, other.blas);
 }
@@ -191,19 +156,16 @@ Primitive& Primitive::operator=(Primitive other) noexcept
 {
     if (this != &other)
     {
-        std::swap(indices, other.indices);
-        std::swap(positions, other.positions);
-        std::swap(normals, other.normals);
-        std::swap(tangents, other.tangents);
-        std::swap(texCoords, other.texCoords);
+        std::swap(meshData, other.meshData);
+
+        std::swap(externalGeometry, other.externalGeometry);
 
-        std::swap(bbox, other.bbox);
+        std::swap(indexCount, other.indexCount);
+        std::swap(vertexCount, other.vertexCount);
 
-        std::swap(indexBuffer, other.indexBuffer);
-        std::swap(positionBuffer, other.positionBuffer);
-        std::swap(normalBuffer, other.normalBuffer);
-        std::swap(tangentBuffer, other.tangentBuffer);
-        std::swap(texCoordBuffer, other.texCoordBuffer);
+        std::swap(residency, other.residency);
+
+        std::swap(geometry, other.geometry);
 
         std::swap(blas, other.blas);
     }
@@ -211,97 +173,197 @@ Primitive& Primitive::operator=(Primitive other) noexcept
     return *this;
 }
 
-uint32_t Primitive::GetIndexCount() const
+vk::IndexType Primitive::GetIndexType() const
+{
+    if (vertexCount <= std::numeric_limits<uint16_t>::max())
+    {
+        return vk::IndexType::eUint16;
+    }
+
+    return vk::IndexType::eUint32;
+}
+
+glm::vec4 Primitive::GetPositionTransform() const
+{
+    if constexpr (Config::kQuantizedVertices)
+    {
+        return glm::vec4(meshData.bbox.GetMin(), VertexQuantization::GetPositionScale(meshData.bbox));
+    }
+
+    return glm::vec4(Vector3::kZero, 1.0f);
+}
+
+vk::DescriptorBufferInfo Primitive::GetIndexBufferInfo() const
+{
+    return RenderContext::geometryArena->GetIndexBufferInfo(geometry);
+}
+
+vk::DescriptorBufferInfo Primitive::GetNormalBufferInfo() const
 {
-    return static_cast<uint32_t>(indices.size());
+    return RenderContext::geometryArena->GetVertexBufferInfo(geometry, Details::kNormalStream);
 }
 
-uint32_t Primitive::GetVertexCount() const
+vk::DescriptorBufferInfo Primitive::GetTangentBufferInfo() const
 {
-    return static_cast<uint32_t>(positions.size());
+    return RenderContext::geometryArena->GetVertexBufferInfo(geometry, Details::kTangentStream);
 }
 
-void Primitive::CreateBuffers()
+vk::DescriptorBufferInfo Primitive::GetTexCoordBufferInfo() const
 {
-    constexpr vk::BufferUsageFlags indexUsage
-            = vk::BufferUsageFlagBits::eIndexBuffer
-            | vk::BufferUsageFlagBits::eStorageBuffer;
-
-    constexpr vk::BufferUsageFlags vertexUsage
-            = vk::BufferUsageFlagBits::eVertexBuffer
-            | vk::BufferUsageFlagBits::eStorageBuffer;
-
-    Assert(!indices.empty());
-    indexBuffer = ResourceContext::CreateBuffer({
-        .usage = indexUsage,
-        .initialData = GetByteView(indices)
-    });
-
-    Assert(!positions.empty());
-    positionBuffer = ResourceContext::CreateBuffer({
-        .usage = vertexUsage,
-        .initialData = GetByteView(positions)
-    });
-
-    Assert(!normals.empty());
-    normalBuffer = ResourceContext::CreateBuffer({
-        .usage = vertexUsage,
-        .initialData = GetByteView(normals)
-    });
-
-    Assert(!tangents.empty());
-    tangentBuffer = ResourceContext::CreateBuffer({
-        .usage = vertexUsage,
-        .initialData = GetByteView(tangents)
-    });
-
-    Assert(!texCoords.empty());
-    texCoordBuffer = ResourceContext::CreateBuffer({
-        .usage = vertexUsage,
-        .initialData = GetByteView(texCoords)
-    });
+    return RenderContext::geometryArena->GetVertexBufferInfo(geometry, Details::kTexCoordStream);
+}
+
+void Primitive::CreateBuffers(vk::CommandBuffer commandBuffer)
+{
+    Assert(!geometry.IsValid());
+    Assert(residency == GeometryResidency::eFull);
+
+    GeometryArena& geometryArena = *RenderContext::geometryArena;
+
+    const MeshView meshView = GetGeometryView();
+
+    std::vector<uint16_t> narrowIndices;
+
+    ByteView indexData = meshView.indices.GetByteView();
+
+    if (GetIndexType() == vk::IndexType::eUint16)
+    {
+        narrowIndices = Details::NarrowIndices(meshView.indices);
+
+        indexData = GetByteView(narrowIndices);
+    }
+
+    const uint32_t wordCount = static_cast<uint32_t>(indexData.size / sizeof(uint32_t));
+
+    geometry = geometryArena.Allocate(wordCount, GetVertexCount());
+
+    geometryArena.UpdateIndices(commandBuffer, geometry, indexData);
+
+    if constexpr (Config::kQuantizedVertices)
+    {
+        const std::vector<uint64_t> quantizedPositions
+                = VertexQuantization::QuantizePositions(meshView.positions, meshView.bbox);
+        const std::vector<uint32_t> quantizedNormals = VertexQuantization::QuantizeDirections(meshView.normals);
+        const std::vector<uint32_t> quantizedTangents = VertexQuantization::QuantizeDirections(meshView.tangents);
+        const std::vector<uint32_t> quantizedTexCoords = VertexQuantization::QuantizeTexCoords(meshView.texCoords);
+
+        geometryArena.UpdateVertices(commandBuffer, geometry,
+                Details::kPositionStream, GetByteView(quantizedPositions));
+        geometryArena.UpdateVertices(commandBuffer, geometry,
+                Details::kNormalStream, GetByteView(quantizedNormals));
+        geometryArena.UpdateVertices(commandBuffer, geometry,
+                Details::kTangentStream, GetByteView(quantizedTangents));
+        geometryArena.UpdateVertices(commandBuffer, geometry,
+                Details::kTexCoordStream, GetByteView(quantizedTexCoords));
+    }
+    else
+    {
+        geometryArena.UpdateVertices(commandBuffer, geometry,
+                Details::kPositionStream, meshView.positions.GetByteView());
+        geometryArena.UpdateVertices(commandBuffer, geometry,
+                Details::kNormalStream, meshView.normals.GetByteView());
+        geometryArena.UpdateVertices(commandBuffer, geometry,
+                Details::kTangentStream, meshView.tangents.GetByteView());
+        geometryArena.UpdateVertices(commandBuffer, geometry,
+                Details::kTexCoordStream, meshView.texCoords.GetByteView());
+    }
 }
 
 void Primitive::GenerateBlas()
 {
-    Assert(!indices.empty());
-    Assert(!positions.empty());
+    Assert(residency != GeometryResidency::eNone);
 
     BlasGeometryData geometryData;
 
-    geometryData.indexType = Primitive::kIndexType;
-    geometryData.indexCount = static_cast<uint32_t>(indices.size());
-    geometryData.indices = GetByteView(indices);
+    const MeshView meshView = GetGeometryView();
+
+    const DataView<uint32_t> lodIndices(meshView.indices.data, meshData.lods.front().indexCount);
+
+    std::vector<uint16_t> narrowIndices;
+
+    geometryData.indexType = GetIndexType();
+    geometryData.indexCount = static_cast<uint32_t>(lodIndices.size);
+
+    if (geometryData.indexType == vk::IndexType::eUint16)
+    {
+        narrowIndices = Details::NarrowIndices(lodIndices);
+
+        geometryData.indices = GetByteView(narrowIndices);
+    }
+    else
+    {
+        geometryData.indices = lodIndices.GetByteView();
+    }
 
     geometryData.vertexFormat = vk::Format::eR32G32B32Sfloat;
     geometryData.vertexStride = sizeof(glm::vec3);
-    geometryData.vertexCount = static_cast<uint32_t>(positions.size());
-    geometryData.vertices = GetByteView(positions);
+    geometryData.vertexCount = GetVertexCount();
+    geometryData.vertices = meshView.positions.GetByteView();
 
     blas = ResourceContext::GenerateBlas(geometryData);
 }
 
-void Primitive::DestroyBuffers() const
+void Primitive::ReleaseGeometry(GeometryResidency targetResidency)
 {
-    if (indexBuffer)
+    Assert(geometry.IsValid());
+    Assert(targetResidency >= residency);
+
+    if (externalGeometry.has_value())
     {
-        ResourceContext::DestroyResourceSafe(indexBuffer);
+        const MeshView& meshView = externalGeometry.value();
+
+        if (targetResidency == GeometryResidency::eFull)
+        {
+            meshData.indices = meshView.indices.GetCopy();
+            meshData.positions = meshView.positions.GetCopy();
+            meshData.normals = meshView.normals.GetCopy();
+            meshData.tangents = meshView.tangents.GetCopy();
+            meshData.texCoords = meshView.texCoords.GetCopy();
+        }
+        else if (targetResidency == GeometryResidency::eCompact)
+        {
+            meshData.indices = DataView<uint32_t>(meshView.indices.data, meshData.lods.front().indexCount).GetCopy();
+            meshData.positions = meshView.positions.GetCopy();
+        }
+
+        externalGeometry.reset();
+
+        residency = targetResidency;
+
+        return;
     }
-    if (positionBuffer)
+
+    if (targetResidency == residency)
     {
-        ResourceContext::DestroyResourceSafe(positionBuffer);
+        return;
     }
-    if (normalBuffer)
+
+    meshData.normals = {};
+    meshData.tangents = {};
+    meshData.texCoords = {};
+
+    if (targetResidency == GeometryResidency::eCompact)
     {
-        ResourceContext::DestroyResourceSafe(normalBuffer);
+        meshData.indices.resize(meshData.lods.front().indexCount);
+        meshData.indices.shrink_to_fit();
     }
-    if (tangentBuffer)
+    else
     {
-        ResourceContext::DestroyResourceSafe(tangentBuffer);
+        meshData.indices = {};
+        meshData.positions = {};
     }
-    if (texCoordBuffer)
+
+    residency = targetResidency;
+}
+
+void Primitive::DestroyBuffers() const
+{
+    if (geometry.IsValid())
     {
-        ResourceContext::DestroyResourceSafe(texCoordBuffer);
+        RenderContext::frameLoop->DestroyResource([allocation = geometry]()
+            {
+                RenderContext::geometryArena->Free(allocation);
+            });
     }
 }
 
@@ -313,42 +375,91 @@ void Primitive::DestroyBlas() const
     }
 }
 
-void Primitive::Draw(vk::CommandBuffer commandBuffer) const
+MeshView Primitive::GetGeometryView() const
+{
+    return externalGeometry.has_value() ? externalGeometry.value() : meshData.GetView();
+}
+
+void Primitive::Draw(vk::CommandBuffer commandBuffer, GeometryBinding& binding, uint32_t lod,
+        uint32_t instanceCount, uint32_t firstInstance) const
 {
-    std::vector<vk::Buffer> vertexBuffers;
+    const vk::IndexType indexType = GetIndexType();
 
-    if (positionBuffer)
+    RenderContext::geometryArena->Bind(commandBuffer, geometry.page, indexType, binding);
+
+    const uint32_t firstIndex = indexType == vk::IndexType::eUint16 ? geometry.firstWord * 2 : geometry.firstWord;
+
+    const Lod& drawLod = meshData.lods[lod];
+
+    commandBuffer.drawIndexed(drawLod.indexCount, instanceCount, firstIndex + drawLod.firstIndex,
+            static_cast<int32_t>(geometry.firstVertex), firstInstance);
+}
+
+void PrimitiveHelpers::MakeResident(std::vector<Primitive>& primitives)
+{
+    EASY_FUNCTION()
+
+    if (primitives.empty())
     {
-        vertexBuffers.push_back(positionBuffer);
+        return;
     }
-    if (normalBuffer)
+
+    VulkanContext::device->ExecuteOneTimeCommands([&](vk::CommandBuffer commandBuffer)
+        {
+            for (auto& primitive : primitives)
+            {
+                primitive.CreateBuffers(commandBuffer);
+            }
+        });
+
+    size_t indexCount = 0;
+    size_t narrowIndexCount = 0;
+
+    for (const auto& primitive : primitives)
     {
-        vertexBuffers.push_back(normalBuffer);
+        indexCount += primitive.GetIndexCount();
+
+        if (primitive.GetIndexType() == vk::IndexType::eUint16)
+        {
+            narrowIndexCount += primitive.GetIndexCount();
+        }
     }
-    if (tangentBuffer)
+
+    if (narrowIndexCount > 0)
     {
-        vertexBuffers.push_back(tangentBuffer);
+        LogI << Format("16-bit indices: %zu of %zu, %.2f MB of index buffers saved\n",
+                narrowIndexCount, indexCount,
+                static_cast<double>(narrowIndexCount * sizeof(uint16_t)) / static_cast<double>(1024 * 1024));
     }
-    if (texCoordBuffer)
+
+    if constexpr (Config::kRayTracingEnabled)
     {
-        vertexBuffers.push_back(texCoordBuffer);
+        for (auto& primitive : primitives)
+        {
+            primitive.GenerateBlas();
+        }
     }
 
-    if (!vertexBuffers.empty())
+    size_t releasedSize = 0;
+    size_t keptSize = 0;
+
+    // Primitives created from views only get the copies the residency keeps here
+    for (auto& primitive : primitives)
     {
-        const std::vector<vk::DeviceSize> offsets(vertexBuffers.size(), 0);
+        const size_t size = Details::GetCpuGeometrySize(primitive.GetMeshData());
 
-        commandBuffer.bindVertexBuffers(0, vertexBuffers, offsets);
-    }
+        primitive.ReleaseGeometry(Config::kGeometryResidency);
 
-    if (indexBuffer)
-    {
-        commandBuffer.bindIndexBuffer(indexBuffer, 0, Primitive::kIndexType);
+        const size_t primitiveKeptSize = Details::GetCpuGeometrySize(primitive.GetMeshData());
 
-        commandBuffer.drawIndexed(GetIndexCount(), 1, 0, 0, 0);
+        releasedSize += std::max(size, primitiveKeptSize) - primitiveKeptSize;
+        keptSize += primitiveKeptSize;
     }
-    else
+
+    if constexpr (Config::kGeometryResidency != GeometryResidency::eFull)
     {
-        commandBuffer.draw(GetVertexCount(), 1, 0, 0);
+        LogI << Format("CPU geometry copies: %.2f MB released, %.2f MB kept\n",
+                static_cast<double>(releasedSize) / static_cast<double>(1024 * 1024),
+                static_cast<double>(keptSize) / static_cast<double>(1024 * 1024));
     }
 }
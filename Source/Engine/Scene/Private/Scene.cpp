@@ -8,6 +8,7 @@
 #include "Engine/Scene/Material.hpp"
 #include "Engine/Scene/SceneHelpers.hpp"
 #include "Engine/Scene/SceneLoader.hpp"
+#include "Engine/Scene/TransformHierarchy.hpp"
 
 namespace Details
 {
@@ -121,10 +122,17 @@ namespace Details
     }
 }
 
-Scene::Scene() = default;
+Scene::Scene()
+    : transformHierarchy(std::make_unique<TransformHierarchy>())
+{
+    ConnectSignals();
+}
 
 Scene::Scene(const Filepath& path)
+    : transformHierarchy(std::make_unique<TransformHierarchy>())
 {
+    ConnectSignals();
+
     SceneLoader sceneLoader(*this, path);
 }
 
@@ -155,37 +163,6 @@ Scene::~Scene()
     }
 }
 
-void Scene::EnumerateDescendants(entt::entity entity, const SceneEntityFunc& func) const
-{
-    if (entity != entt::null)
-    {
-        for (const auto child : get<HierarchyComponent>(entity).GetChildren())
-        {
-            func(child);
-
-            EnumerateDescendants(child, func);
-        }
-    }
-    else
-    {
-        each(func);
-    }
-}
-
-void Scene::EnumerateAncestors(entt::entity entity, const SceneEntityFunc& func) const
-{
-    Assert(entity != entt::null);
-
-    const entt::entity parent = get<HierarchyComponent>(entity).GetParent();
-
-    if (parent != entt::null)
-    {
-        func(parent);
-
-        EnumerateAncestors(parent, func);
-    }
-}
-
 void Scene::EnumerateRenderView(const SceneRenderFunc& func) const
 {
     for (auto&& [entity, tc, rc] : view<TransformComponent, RenderComponent>().each())
@@ -199,15 +176,9 @@ void Scene::EnumerateRenderView(const SceneRenderFunc& func) const
 
 entt::entity Scene::FindEntity(const std::string& name) const
 {
-    for (auto&& [entity, nc] : view<NameComponent>().each())
-    {
-        if (nc.name == name)
-        {
-            return entity;
-        }
-    }
+    const auto it = nameIndex.find(name);
 
-    return entt::null;
+    return it != nameIndex.end() ? it->second.front() : entt::null;
 }
 
 entt::entity Scene::CreateEntity(entt::entity parent, const Transform& transform)
@@ -246,23 +217,32 @@ void Scene::RemoveEntity(entt::entity entity)
 
     if (const auto* sic = try_get<SceneInstanceComponent>(entity))
     {
-        std::erase(get<ScenePrefabComponent>(sic->prefab).instances, sic->prefab);
+        std::erase(get<ScenePrefabComponent>(sic->prefab).instances, entity);
     }
 
+    // Dropped before unlinking, so detaching the entity doesn't mark the hierarchy modified
+    transformHierarchy->Remove(entity);
+
     get<HierarchyComponent>(entity).SetParent(entt::null);
 
     RemoveChildren(entity);
 
     destroy(entity);
+
+    InvalidateHierarchy();
 }
 
 void Scene::RemoveChildren(entt::entity entity)
 {
-    const std::vector<entt::entity> children = get<HierarchyComponent>(entity).GetChildren();
+    entt::entity child = get<HierarchyComponent>(entity).GetFirstChild();
 
-    for (const auto child : children)
+    while (child != entt::null)
     {
+        const entt::entity nextChild = get<HierarchyComponent>(child).GetNextSibling();
+
         RemoveEntity(child);
+
+        child = nextChild;
     }
 }
 
@@ -278,6 +258,9 @@ void Scene::EmplaceScenePrefab(Scene&& scene, entt::entity entity)
 
     SceneHelpers::CopyHierarchy(scene, *prefab.hierarchy, entt::null, entt::null);
 
+    // Every instance copies the whole prefab, so its descendants are scanned in order
+    prefab.hierarchy->SortHierarchy();
+
     SceneHelpers::MergeStorageComponents(scene, *this);
 }
 
@@ -294,17 +277,11 @@ void Scene::EmplaceSceneInstance(entt::entity scene, entt::entity entity)
 
 entt::entity Scene::CreateSceneInstance(entt::entity scene, const Transform& transform)
 {
-    const entt::entity entity = CreateEntity(entt::null, {});
+    // The instance root places the prefab, so the copied entities don't have to be modified
+    const entt::entity entity = CreateEntity(entt::null, transform);
 
     EmplaceSceneInstance(scene, entity);
 
-    for (const auto child : get<HierarchyComponent>(entity).GetChildren())
-    {
-        auto& tc = get<TransformComponent>(child);
-
-        tc.SetLocalTransform(tc.GetLocalTransform() * transform);
-    }
-
     return entity;
 }
 
@@ -334,3 +311,126 @@ std::unique_ptr<Scene> Scene::EraseScenePrefab(entt::entity scene)
 
     return std::move(prefab.hierarchy);
 }
+
+void Scene::InvalidateHierarchy()
+{
+    hierarchySorted = false;
+}
+
+void Scene::SortHierarchy()
+{
+    if (hierarchySorted)
+    {
+        return;
+    }
+
+    EASY_FUNCTION()
+
+    // Entities in depth-first pre-order
+    std::vector<entt::entity> order;
+    order.reserve(storage<HierarchyComponent>().size());
+
+    const auto addEntity = [&](entt::entity entity)
+        {
+            order.push_back(entity);
+        };
+
+    for (auto&& [entity, hc] : view<HierarchyComponent>().each())
+    {
+        if (hc.GetParent() == entt::null)
+        {
+            addEntity(entity);
+
+            EnumerateLinkedDescendants(entity, addEntity);
+        }
+    }
+
+    // Depth-first position of every entity, indexed by the entity index
+    std::vector<uint32_t> positions;
+
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        const size_t index = static_cast<size_t>(entt::to_entity(order[i]));
+
+        if (index >= positions.size())
+        {
+            positions.resize(index + 1);
+        }
+
+        positions[index] = static_cast<uint32_t>(i);
+    }
+
+    sort<HierarchyComponent>([&](entt::entity lhs, entt::entity rhs)
+        {
+            return positions[entt::to_entity(lhs)] < positions[entt::to_entity(rhs)];
+        });
+
+    // Children follow their parents, so visiting the entities backwards completes every subtree before its root
+    for (const entt::entity entity : order)
+    {
+        get<HierarchyComponent>(entity).descendantCount = 0;
+    }
+
+    for (auto it = order.rbegin(); it != order.rend(); ++it)
+    {
+        const auto& hc = get<HierarchyComponent>(*it);
+
+        if (hc.GetParent() != entt::null)
+        {
+            get<HierarchyComponent>(hc.GetParent()).descendantCount += hc.descendantCount + 1;
+        }
+    }
+
+    hierarchySorted = true;
+}
+
+void Scene::ConnectSignals()
+{
+    on_construct<NameComponent>().connect<&Scene::AddName>(*this);
+    on_update<NameComponent>().connect<&Scene::UpdateName>(*this);
+    on_destroy<NameComponent>().connect<&Scene::RemoveName>(*this);
+
+    on_destroy<TransformComponent>().connect<&Scene::RemoveTransform>(*this);
+}
+
+void Scene::AddName(entt::registry&, entt::entity entity)
+{
+    const auto it = nameIndex.try_emplace(get<NameComponent>(entity).name).first;
+
+    it->second.push_back(entity);
+
+    indexedNames.emplace(entity, &it->first);
+}
+
+void Scene::RemoveName(entt::registry&, entt::entity entity)
+{
+    const auto indexedName = indexedNames.find(entity);
+
+    Assert(indexedName != indexedNames.end());
+
+    const auto it = nameIndex.find(*indexedName->second);
+
+    Assert(it != nameIndex.end());
+
+    // Keeps the order of the remaining entities, so lookups stay deterministic
+    std::erase(it->second, entity);
+
+    if (it->second.empty())
+    {
+        nameIndex.erase(it);
+    }
+
+    indexedNames.erase(indexedName);
+}
+
+void Scene::UpdateName(entt::registry& registry, entt::entity entity)
+{
+    RemoveName(registry, entity);
+
+    AddName(registry, entity);
+}
+
+void Scene::RemoveTransform(entt::registry&, entt::entity entity)
+{
+    transformHierarchy->Remove(entity);
+}
@@ -0,0 +1,349 @@
+PRAGMA_DISABLE_WARNINGS
+#include <tiny_gltf.h>
+PRAGMA_ENABLE_WARNINGS
+
+#include "Engine/Scene/SceneCooker.hpp"
+
+#include "Engine/Filesystem/Filesystem.hpp"
+#include "Engine/Scene/CookedScene.hpp"
+#include "Engine/Scene/GltfHelpers.hpp"
+#include "Engine/Scene/GltfParser.hpp"
+#include "Engine/Scene/MeshData.hpp"
+
+#include "Utils/Assert.hpp"
+#include "Utils/ThreadPool.hpp"
+#include "Utils/TimeHelpers.hpp"
+
+namespace Details
+{
+    using Sections = std::array<Bytes, static_cast<size_t>(CookedScene::Section::eCount)>;
+
+    template <class T>
+    static uint32_t Append(Sections& sections, CookedScene::Section section, const T* data, size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        Bytes& bytes = sections[static_cast<size_t>(section)];
+
+        Assert(bytes.size() % sizeof(T) == 0);
+
+        const uint32_t first = static_cast<uint32_t>(bytes.size() / sizeof(T));
+
+        const uint8_t* begin = reinterpret_cast<const uint8_t*>(data);
+
+        bytes.insert(bytes.end(), begin, begin + count * sizeof(T));
+
+        return first;
+    }
+
+    template <class T>
+    static uint32_t Append(Sections& sections, CookedScene::Section section, const T& value)
+    {
+        return Append(sections, section, &value, 1);
+    }
+
+    template <class T>
+    static uint32_t Append(Sections& sections, CookedScene::Section section, const std::vector<T>& values)
+    {
+        return Append(sections, section, values.data(), values.size());
+    }
+
+    static CookedScene::Range AppendBytes(Sections& sections, CookedScene::Section section, const ByteView& data)
+    {
+        const uint32_t offset = Append(sections, section, data.data, data.size);
+
+        return CookedScene::Range{ offset, data.size };
+    }
+
+    static CookedScene::Range AppendString(Sections& sections, const std::string& string)
+    {
+        const ByteView data(reinterpret_cast<const uint8_t*>(string.data()), string.size());
+
+        return AppendBytes(sections, CookedScene::Section::eStrings, data);
+    }
+
+    static std::string GetExtrasString(const tinygltf::Value& extras, const std::string& key)
+    {
+        if (extras.Has(key))
+        {
+            return extras.Get(key).Get<std::string>();
+        }
+
+        return {};
+    }
+
+    static uint64_t AlignSectionOffset(uint64_t offset)
+    {
+        return (offset + CookedScene::kSectionAlignment - 1) / CookedScene::kSectionAlignment
+                * CookedScene::kSectionAlignment;
+    }
+
+    static Bytes BuildBlob(const Sections& sections)
+    {
+        CookedScene::Header header;
+
+        uint64_t offset = AlignSectionOffset(sizeof(CookedScene::Header));
+
+        for (size_t i = 0; i < sections.size(); ++i)
+        {
+            header.sections[i] = CookedScene::Range{ offset, sections[i].size() };
+
+            offset = AlignSectionOffset(offset + sections[i].size());
+        }
+
+        Bytes blob(offset, 0);
+
+        std::memcpy(blob.data(), &header, sizeof(CookedScene::Header));
+
+        for (size_t i = 0; i < sections.size(); ++i)
+        {
+            std::ranges::copy(sections[i], blob.data() + header.sections[i].offset);
+        }
+
+        return blob;
+    }
+
+    static void CookTextures(const tinygltf::Model& model, const GltfBuffers& buffers,
+            const Filepath& scenePath, const Filepath& cookedPath, Sections& sections)
+    {
+        EASY_FUNCTION()
+
+        const std::filesystem::path sceneDirectory(scenePath.GetDirectory());
+        const std::filesystem::path cookedDirectory(Filepath(cookedPath.GetDirectory()).GetAbsolute());
+
+        std::map<int32_t, CookedScene::Range> embeddedImages;
+
+        for (const auto& modelTexture : model.textures)
+        {
+            Assert(modelTexture.source >= 0);
+
+            const tinygltf::Image& image = model.images[modelTexture.source];
+
+            CookedScene::Texture texture;
+
+            if (image.bufferView >= 0)
+            {
+                if (!embeddedImages.contains(modelTexture.source))
+                {
+                    const ByteView imageData = GltfHelpers::GetBufferViewData(model, buffers, image.bufferView);
+
+                    embeddedImages.emplace(modelTexture.source,
+                            AppendBytes(sections, CookedScene::Section::eImageData, imageData));
+                }
+
+                texture.imageData = embeddedImages.at(modelTexture.source);
+            }
+            else
+            {
+                const std::filesystem::path imagePath = std::filesystem::absolute(sceneDirectory / image.uri);
+
+                texture.path = AppendString(sections, imagePath.lexically_relative(cookedDirectory).generic_string());
+            }
+
+            if (modelTexture.sampler >= 0)
+            {
+                texture.sampler = GltfHelpers::GetSamplerDescription(model.samplers[modelTexture.sampler]);
+                texture.hasSampler = 1;
+            }
+
+            Append(sections, CookedScene::Section::eTextures, texture);
+        }
+    }
+
+    static void CookMaterials(const tinygltf::Model& model, Sections& sections)
+    {
+        EASY_FUNCTION()
+
+        for (const auto& gltfMaterial : model.materials)
+        {
+            const Material material = GltfHelpers::RetrieveMaterial(gltfMaterial);
+
+            const CookedScene::Material cookedMaterial{ material.data, static_cast<uint32_t>(material.flags) };
+
+            Append(sections, CookedScene::Section::eMaterials, cookedMaterial);
+        }
+    }
+
+    // Returns the cooked index of every glTF primitive, duplicates share one
+    static std::vector<uint32_t> CookGeometry(const tinygltf::Model& model, const GltfBuffers& buffers,
+            Sections& sections)
+    {
+        EASY_FUNCTION()
+
+        ThreadPool threadPool;
+
+        std::vector<std::future<MeshData>> meshFutures;
+
+        for (const auto& mesh : model.meshes)
+        {
+            for (const auto& primitive : mesh.primitives)
+            {
+                meshFutures.push_back(threadPool.Execute([&model, &buffers, &primitive, &threadPool]()
+                    {
+                        return GltfHelpers::RetrieveMeshData(model, buffers, primitive, &threadPool);
+                    }));
+            }
+        }
+
+        std::vector<MeshData> meshes;
+        meshes.reserve(meshFutures.size());
+
+        for (auto& meshFuture : meshFutures)
+        {
+            meshes.push_back(threadPool.Wait(meshFuture));
+        }
+
+        std::vector<uint32_t> primitiveIndices = MeshDataHelpers::RemoveDuplicates(meshes);
+
+        for (const MeshData& mesh : meshes)
+        {
+            CookedScene::Primitive cookedPrimitive;
+
+            cookedPrimitive.firstIndex = Append(sections, CookedScene::Section::eIndices, mesh.indices);
+            cookedPrimitive.indexCount = mesh.GetIndexCount();
+            cookedPrimitive.firstVertex = Append(sections, CookedScene::Section::ePositions, mesh.positions);
+            cookedPrimitive.vertexCount = mesh.GetVertexCount();
+            cookedPrimitive.firstMeshlet = Append(sections, CookedScene::Section::eMeshlets, mesh.meshlets);
+            cookedPrimitive.meshletCount = static_cast<uint32_t>(mesh.meshlets.size());
+            cookedPrimitive.firstLod = Append(sections, CookedScene::Section::eLods, mesh.lods);
+            cookedPrimitive.lodCount = static_cast<uint32_t>(mesh.lods.size());
+            cookedPrimitive.bbox = mesh.bbox;
+
+            Append(sections, CookedScene::Section::eNormals, mesh.normals);
+            Append(sections, CookedScene::Section::eTangents, mesh.tangents);
+            Append(sections, CookedScene::Section::eTexCoords, mesh.texCoords);
+
+            Append(sections, CookedScene::Section::ePrimitives, cookedPrimitive);
+        }
+
+        return primitiveIndices;
+    }
+
+    static void CookNodes(const tinygltf::Model& model, const GltfBuffers& buffers,
+            const std::vector<uint32_t>& primitiveIndices, Sections& sections)
+    {
+        EASY_FUNCTION()
+
+        const std::vector<uint32_t> primitiveOffsets = GltfHelpers::GetPrimitiveOffsets(model);
+
+        std::vector<uint32_t> cookedIndices(model.nodes.size(), CookedScene::kInvalidIndex);
+
+        uint32_t nodeCount = 0;
+
+        GltfHelpers::EnumerateNodes(model, [&](int32_t nodeIndex, int32_t parentIndex)
+            {
+                const tinygltf::Node& node = model.nodes[nodeIndex];
+
+                CookedScene::Node cookedNode;
+
+                cookedNode.parent = parentIndex >= 0 ? cookedIndices[parentIndex] : CookedScene::kInvalidIndex;
+                cookedNode.transform = GltfHelpers::RetrieveTransform(node).GetMatrix();
+                cookedNode.name = AppendString(sections, node.name);
+
+                if (node.mesh >= 0)
+                {
+                    const tinygltf::Mesh& mesh = model.meshes[node.mesh];
+
+                    for (size_t i = 0; i < mesh.primitives.size(); ++i)
+                    {
+                        Assert(mesh.primitives[i].material >= 0);
+
+                        const RenderObject renderObject{
+                            .primitive = primitiveIndices[primitiveOffsets[node.mesh] + i],
+                            .material = static_cast<uint32_t>(mesh.primitives[i].material)
+                        };
+
+                        const uint32_t index = Append(sections, CookedScene::Section::eRenderObjects, renderObject);
+
+                        if (i == 0)
+                        {
+                            cookedNode.firstRenderObject = index;
+                        }
+                    }
+
+                    cookedNode.renderObjectCount = static_cast<uint32_t>(mesh.primitives.size());
+
+                    const std::vector<glm::mat4> instanceTransforms
+                            = GltfHelpers::RetrieveInstanceTransforms(model, buffers, node);
+
+                    if (!instanceTransforms.empty())
+                    {
+                        cookedNode.firstInstance = Append(sections,
+                                CookedScene::Section::eInstances, instanceTransforms);
+                        cookedNode.instanceCount = static_cast<uint32_t>(instanceTransforms.size());
+                    }
+                }
+
+                if (node.camera >= 0)
+                {
+                    const CookedScene::Camera camera{
+                        GltfHelpers::RetrieveCameraLocation(node),
+                        GltfHelpers::RetrieveCameraProjection(model.cameras[node.camera])
+                    };
+
+                    cookedNode.camera = Append(sections, CookedScene::Section::eCameras, camera);
+                }
+
+                if (node.extensions.contains("KHR_lights_punctual"))
+                {
+                    const LightComponent light = GltfHelpers::RetrieveLight(model, node);
+
+                    cookedNode.light = Append(sections, CookedScene::Section::eLights, light);
+                }
+
+                if (node.extras.Has("environment"))
+                {
+                    const std::string panoramaPath
+                            = node.extras.Get("environment").Get("panorama_path").Get<std::string>();
+
+                    cookedNode.environment = AppendString(sections, panoramaPath);
+                }
+
+                cookedNode.scenePrefab = AppendString(sections, GetExtrasString(node.extras, "scene_prefab"));
+                cookedNode.sceneInstance = AppendString(sections, GetExtrasString(node.extras, "scene_instance"));
+                cookedNode.sceneSpawn = AppendString(sections, GetExtrasString(node.extras, "scene_spawn"));
+
+                Append(sections, CookedScene::Section::eNodes, cookedNode);
+
+                cookedIndices[nodeIndex] = nodeCount++;
+            });
+    }
+}
+
+bool SceneCooker::Cook(const Filepath& scenePath, const Filepath& cookedPath)
+{
+    EASY_FUNCTION()
+
+    const float startSeconds = Timer::GetGlobalSeconds();
+
+    GltfBuffers buffers;
+
+    const std::unique_ptr<tinygltf::Model> model = GltfHelpers::LoadModel(scenePath, buffers);
+
+    Details::Sections sections;
+
+    Details::CookTextures(*model, buffers, scenePath, cookedPath, sections);
+
+    Details::CookMaterials(*model, sections);
+
+    const std::vector<uint32_t> primitiveIndices = Details::CookGeometry(*model, buffers, sections);
+
+    Details::CookNodes(*model, buffers, primitiveIndices, sections);
+
+    const Bytes blob = Details::BuildBlob(sections);
+
+    if (!Filesystem::WriteFile(cookedPath, GetByteView(blob)))
+    {
+        LogE << "Failed to write cooked scene: " << cookedPath.GetAbsolute() << "\n";
+
+        return false;
+    }
+
+    const float cookSeconds = Timer::GetGlobalSeconds() - startSeconds;
+
+    LogI << "Scene cooked: " << scenePath.GetFilename() << " -> " << cookedPath.GetFilename()
+            << " (" << Format("%.2f", static_cast<double>(blob.size()) / 1048576.0) << " MB) in "
+            << Format("%.3f", cookSeconds) << " s\n";
+
+    return true;
+}
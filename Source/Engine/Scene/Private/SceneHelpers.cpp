@@ -1,3 +1,5 @@
+#include <ranges>
+
 #include "Engine/Scene/SceneHelpers.hpp"
 
 #include "Engine/Render/Vulkan/VulkanContext.hpp"
@@ -19,6 +21,46 @@ namespace Details
 
         src.erase(srcBegin, srcEnd);
     }
+
+    // Only the copied entities are looked up, the copies are inserted into the destination pool in one batch
+    // and func is called for each of them afterwards
+    template <class T, class TFunc>
+    static void CopyComponents(const Scene& srcScene, Scene& dstScene, const std::vector<entt::entity>& srcEntities,
+            const std::vector<entt::entity>& dstEntities, const TFunc& func)
+    {
+        std::vector<entt::entity> entities;
+        std::vector<const T*> components;
+
+        for (size_t i = 0; i < srcEntities.size(); ++i)
+        {
+            if (const T* component = srcScene.try_get<T>(srcEntities[i]))
+            {
+                entities.push_back(dstEntities[i]);
+                components.push_back(component);
+            }
+        }
+
+        const auto values = components | std::views::transform([](const T* component) -> const T&
+            {
+                return *component;
+            });
+
+        auto& dstStorage = dstScene.storage<T>();
+
+        dstStorage.insert(entities.begin(), entities.end(), values.begin());
+
+        for (const entt::entity entity : entities)
+        {
+            func(dstStorage.get(entity));
+        }
+    }
+
+    template <class T>
+    static void CopyComponents(const Scene& srcScene, Scene& dstScene,
+            const std::vector<entt::entity>& srcEntities, const std::vector<entt::entity>& dstEntities)
+    {
+        CopyComponents<T>(srcScene, dstScene, srcEntities, dstEntities, [](T&) {});
+    }
 }
 
 AABBox SceneHelpers::ComputeBBox(const Scene& scene)
@@ -29,11 +71,23 @@ AABBox SceneHelpers::ComputeBBox(const Scene& scene)
 
     for (auto&& [entity, tc, rc] : scene.view<TransformComponent, RenderComponent>().each())
     {
+        const glm::mat4& worldTransform = tc.GetWorldTransform().GetMatrix();
+
         for (const auto& ro : rc.renderObjects)
         {
             const Primitive& primitive = geometryStorageComponent.primitives[ro.primitive];
 
-            bbox.Add(primitive.GetBBox().GetTransformed(tc.GetWorldTransform().GetMatrix()));
+            if (const auto* ic = scene.try_get<InstanceComponent>(entity))
+            {
+                for (const glm::mat4& transform : ic->transforms)
+                {
+                    bbox.Add(primitive.GetBBox().GetTransformed(worldTransform * transform));
+                }
+            }
+            else
+            {
+                bbox.Add(primitive.GetBBox().GetTransformed(worldTransform));
+            }
         }
     }
 
@@ -57,12 +111,16 @@ void SceneHelpers::CopyComponents(
 {
     if (const auto* nc = srcScene.try_get<NameComponent>(srcEntity))
     {
-        dstScene.emplace<NameComponent>(dstEntity) = *nc;
+        dstScene.emplace<NameComponent>(dstEntity, *nc);
     }
     if (const auto* rc = srcScene.try_get<RenderComponent>(srcEntity))
     {
         dstScene.emplace<RenderComponent>(dstEntity) = *rc;
     }
+    if (const auto* ic = srcScene.try_get<InstanceComponent>(srcEntity))
+    {
+        dstScene.emplace<InstanceComponent>(dstEntity, *ic).updated = true;
+    }
     if (const auto* cc = srcScene.try_get<CameraComponent>(srcEntity))
     {
         dstScene.emplace<CameraComponent>(dstEntity) = *cc;
@@ -80,30 +138,82 @@ void SceneHelpers::CopyComponents(
 void SceneHelpers::CopyHierarchy(
         const Scene& srcScene, Scene& dstScene, entt::entity srcParent, entt::entity dstParent)
 {
-    std::map<entt::entity, entt::entity> entities;
+    EASY_FUNCTION()
 
-    srcScene.EnumerateDescendants(srcParent, [&](const entt::entity srcEntity)
-        {
-            const auto& srcTc = srcScene.get<TransformComponent>(srcEntity);
+    // Depth-first order, parents are created before their children
+    std::vector<entt::entity> srcEntities;
 
-            entities.emplace(srcEntity, dstScene.CreateEntity(entt::null, srcTc.GetLocalTransform()));
-        });
+    const auto addEntity = [&](entt::entity entity)
+        {
+            srcEntities.push_back(entity);
+        };
 
-    for (const auto& [srcEntity, dstEntity] : entities)
+    if (srcParent != entt::null)
     {
-        const auto& srcHc = srcScene.get<HierarchyComponent>(srcEntity);
-
-        if (srcHc.GetParent() == srcParent)
+        srcScene.EnumerateDescendants(srcParent, addEntity);
+    }
+    else
+    {
+        for (auto&& [entity, hc] : srcScene.view<HierarchyComponent>().each())
         {
-            dstScene.get<HierarchyComponent>(dstEntity).SetParent(dstParent);
+            if (hc.GetParent() == entt::null)
+            {
+                addEntity(entity);
+
+                srcScene.EnumerateDescendants(entity, addEntity);
+            }
         }
-        else
+    }
+
+    std::vector<entt::entity> dstEntities(srcEntities.size());
+
+    dstScene.create(dstEntities.begin(), dstEntities.end());
+
+    // Copy of every source entity, indexed by the source entity index
+    std::vector<entt::entity> remap;
+
+    for (size_t i = 0; i < srcEntities.size(); ++i)
+    {
+        const size_t index = static_cast<size_t>(entt::to_entity(srcEntities[i]));
+
+        if (index >= remap.size())
         {
-            dstScene.get<HierarchyComponent>(dstEntity).SetParent(entities.at(srcHc.GetParent()));
+            remap.resize(index + 1, entt::null);
         }
 
-        CopyComponents(srcScene, dstScene, srcEntity, dstEntity);
+        remap[index] = dstEntities[i];
+    }
+
+    auto& dstHierarchyStorage = dstScene.storage<HierarchyComponent>();
+    auto& dstTransformStorage = dstScene.storage<TransformComponent>();
+
+    dstHierarchyStorage.reserve(dstHierarchyStorage.size() + dstEntities.size());
+    dstTransformStorage.reserve(dstTransformStorage.size() + dstEntities.size());
+
+    // Constructors link every copy to its siblings and append it to the TransformHierarchy, which needs
+    // the parent's links and world transform, so these are emplaced one at a time in parent-first order
+    for (size_t i = 0; i < srcEntities.size(); ++i)
+    {
+        const entt::entity srcEntityParent = srcScene.get<HierarchyComponent>(srcEntities[i]).GetParent();
+
+        const entt::entity dstEntityParent = srcEntityParent != srcParent
+                ? remap[static_cast<size_t>(entt::to_entity(srcEntityParent))] : dstParent;
+
+        const Transform localTransform = srcScene.get<TransformComponent>(srcEntities[i]).GetLocalTransform();
+
+        dstScene.emplace<HierarchyComponent>(dstEntities[i], dstScene, dstEntities[i], dstEntityParent);
+        dstScene.emplace<TransformComponent>(dstEntities[i], dstScene, dstEntities[i], localTransform);
     }
+
+    Details::CopyComponents<NameComponent>(srcScene, dstScene, srcEntities, dstEntities);
+    Details::CopyComponents<RenderComponent>(srcScene, dstScene, srcEntities, dstEntities);
+    Details::CopyComponents<InstanceComponent>(srcScene, dstScene, srcEntities, dstEntities, [](InstanceComponent& ic)
+        {
+            ic.updated = true;
+        });
+    Details::CopyComponents<CameraComponent>(srcScene, dstScene, srcEntities, dstEntities);
+    Details::CopyComponents<LightComponent>(srcScene, dstScene, srcEntities, dstEntities);
+    Details::CopyComponents<EnvironmentComponent>(srcScene, dstScene, srcEntities, dstEntities);
 }
 
 void SceneHelpers::MergeStorageComponents(Scene& srcScene, Scene& dstScene)
@@ -164,27 +274,34 @@ void SceneHelpers::SplitStorageComponents(Scene& srcScene, Scene& dstScene, cons
 }
 
 vk::AccelerationStructureInstanceKHR SceneHelpers::GetTlasInstance(
-        const Scene& scene, const TransformComponent& tc, const RenderObject& ro)
+        const Scene& scene, const glm::mat4& transform, const RenderObject& ro)
 {
     const auto& geometryComponent = scene.ctx().get<GeometryStorageComponent>();
     const auto& materialComponent = scene.ctx().get<MaterialStorageComponent>();
 
     vk::TransformMatrixKHR transformMatrix;
 
-    const glm::mat4 transposedTransform = glm::transpose(tc.GetWorldTransform().GetMatrix());
+    const glm::mat4 transposedTransform = glm::transpose(transform);
 
     std::memcpy(&transformMatrix.matrix, &transposedTransform, sizeof(vk::TransformMatrixKHR));
 
-    Assert(ro.primitive <= static_cast<uint32_t>(std::numeric_limits<uint16_t>::max()));
+    Assert(ro.primitive <= static_cast<uint32_t>(INSTANCE_PRIMITIVE_MASK));
     Assert(ro.material <= static_cast<uint32_t>(std::numeric_limits<uint8_t>::max()));
 
-    const uint32_t customIndex = ro.primitive | (ro.material << 16);
+    const Primitive& primitive = geometryComponent.primitives[ro.primitive];
+
+    uint32_t customIndex = ro.primitive | (ro.material << INSTANCE_MATERIAL_SHIFT);
+
+    if (primitive.GetIndexType() == vk::IndexType::eUint16)
+    {
+        customIndex |= INSTANCE_INDEX16_BIT;
+    }
 
     const Material& material = materialComponent.materials[ro.material];
 
     const vk::GeometryInstanceFlagsKHR flags = MaterialHelpers::GetTlasInstanceFlags(material.flags);
 
-    const vk::AccelerationStructureKHR blas = geometryComponent.primitives[ro.primitive].GetBlas();
+    const vk::AccelerationStructureKHR blas = primitive.GetBlas();
 
     return vk::AccelerationStructureInstanceKHR(transformMatrix,
             customIndex, 0xFF, 0, flags, VulkanContext::device->GetAddress(blas));
@@ -1,421 +1,281 @@
 PRAGMA_DISABLE_WARNINGS
-#define TINYGLTF_IMPLEMENTATION
-#define STB_IMAGE_WRITE_IMPLEMENTATION
-#define TINYGLTF_USE_CPP14
 #include <tiny_gltf.h>
 PRAGMA_ENABLE_WARNINGS
 
+#include <unordered_map>
+
 #include "Engine/Scene/SceneLoader.hpp"
 
+#include "Engine/Filesystem/ImageLoader.hpp"
+#include "Engine/Filesystem/MappedFile.hpp"
 #include "Engine/Render/Vulkan/VulkanContext.hpp"
 #include "Engine/Scene/Components/Components.hpp"
 #include "Engine/Scene/Components/EnvironmentComponent.hpp"
+#include "Engine/Scene/CookedScene.hpp"
+#include "Engine/Scene/GltfHelpers.hpp"
+#include "Engine/Scene/GltfParser.hpp"
 #include "Engine/Scene/Material.hpp"
+#include "Engine/Scene/MeshData.hpp"
 #include "Engine/Scene/Primitive.hpp"
 #include "Engine/Scene/Scene.hpp"
 
 #include "Utils/Assert.hpp"
+#include "Utils/ThreadPool.hpp"
 #include "Utils/TimeHelpers.hpp"
 
 namespace Details
 {
-    using NodeFunc = std::function<entt::entity(const tinygltf::Node&, entt::entity)>;
-
-    static vk::Filter GetSamplerFilter(int32_t filter)
+    struct TextureSource
     {
-        switch (filter)
-        {
-        case TINYGLTF_TEXTURE_FILTER_NEAREST:
-        case TINYGLTF_TEXTURE_FILTER_NEAREST_MIPMAP_NEAREST:
-        case TINYGLTF_TEXTURE_FILTER_NEAREST_MIPMAP_LINEAR:
-            return vk::Filter::eNearest;
-        case TINYGLTF_TEXTURE_FILTER_LINEAR:
-        case TINYGLTF_TEXTURE_FILTER_LINEAR_MIPMAP_NEAREST:
-        case TINYGLTF_TEXTURE_FILTER_LINEAR_MIPMAP_LINEAR:
-            return vk::Filter::eLinear;
-        default:
-            return vk::Filter::eLinear;
-        }
-    }
+        Filepath key;
+        ByteView encodedData;
+        std::optional<SamplerDescription> sampler;
+    };
 
-    static vk::SamplerMipmapMode GetSamplerMipmapMode(int32_t filter)
+    // SteelCook writes blobs next to their source scenes by default
+    static std::optional<Filepath> FindSourceScene(const Filepath& cookedPath)
     {
-        switch (filter)
+        for (const char* extension : { ".gltf", ".glb" })
         {
-        case TINYGLTF_TEXTURE_FILTER_NEAREST:
-        case TINYGLTF_TEXTURE_FILTER_NEAREST_MIPMAP_NEAREST:
-        case TINYGLTF_TEXTURE_FILTER_LINEAR:
-        case TINYGLTF_TEXTURE_FILTER_LINEAR_MIPMAP_NEAREST:
-            return vk::SamplerMipmapMode::eNearest;
-        case TINYGLTF_TEXTURE_FILTER_NEAREST_MIPMAP_LINEAR:
-        case TINYGLTF_TEXTURE_FILTER_LINEAR_MIPMAP_LINEAR:
-            return vk::SamplerMipmapMode::eLinear;
-        default:
-            return vk::SamplerMipmapMode::eLinear;
-        }
-    }
+            const Filepath sourcePath(cookedPath.GetDirectory() + cookedPath.GetBaseName() + extension);
 
-    static vk::SamplerAddressMode GetSamplerAddressMode(int32_t wrap)
-    {
-        switch (wrap)
-        {
-        case TINYGLTF_TEXTURE_WRAP_REPEAT:
-            return vk::SamplerAddressMode::eRepeat;
-        case TINYGLTF_TEXTURE_WRAP_CLAMP_TO_EDGE:
-            return vk::SamplerAddressMode::eClampToEdge;
-        case TINYGLTF_TEXTURE_WRAP_MIRRORED_REPEAT:
-            return vk::SamplerAddressMode::eMirroredRepeat;
-        default:
-            return vk::SamplerAddressMode::eRepeat;
+            if (sourcePath.Exists())
+            {
+                return sourcePath;
+            }
         }
+
+        return std::nullopt;
     }
 
-    static vk::IndexType GetIndexType(int32_t componentType)
+    static std::string GetExtrasString(const tinygltf::Node& node, const std::string& key)
     {
-        switch (componentType)
+        if (node.extras.Has(key))
         {
-        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
-            return vk::IndexType::eUint16;
-        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
-            return vk::IndexType::eUint32;
-        default:
-            Assert(false);
-            return {};
+            return node.extras.Get(key).Get<std::string>();
         }
-    }
 
-    static SamplerDescription GetSamplerDescription(const tinygltf::Sampler& sampler)
-    {
-        return SamplerDescription{
-            .magFilter = GetSamplerFilter(sampler.magFilter),
-            .minFilter = GetSamplerFilter(sampler.minFilter),
-            .mipmapMode = GetSamplerMipmapMode(sampler.magFilter),
-            .addressMode = GetSamplerAddressMode(sampler.wrapS)
-        };
+        return {};
     }
 
-    template <glm::length_t L>
-    static glm::vec<L, float, glm::defaultp> GetVec(const std::vector<double>& values)
+    static std::vector<TextureSource> GetTextureSources(const tinygltf::Model& model, const GltfBuffers& buffers,
+            const Filepath& scenePath, const Filepath& sceneDirectory)
     {
-        const glm::length_t valueCount = static_cast<glm::length_t>(values.size());
-
-        glm::vec<L, float, glm::defaultp> result(0.0f);
+        std::vector<TextureSource> sources;
+        sources.reserve(model.textures.size());
 
-        for (glm::length_t i = 0; i < valueCount && i < L; ++i)
+        for (const auto& modelTexture : model.textures)
         {
-            result[i] = static_cast<float>(values[i]);
-        }
-
-        return result;
-    }
+            Assert(modelTexture.source >= 0);
 
-    static glm::quat GetQuaternion(const std::vector<double>& values)
-    {
-        Assert(values.size() == 4);
+            const tinygltf::Image& image = model.images[modelTexture.source];
 
-        glm::quat quat;
-        quat.x = static_cast<float>(values[0]);
-        quat.y = static_cast<float>(values[1]);
-        quat.z = static_cast<float>(values[2]);
-        quat.w = static_cast<float>(values[3]);
+            TextureSource source;
 
-        return quat;
-    }
+            if (image.bufferView >= 0)
+            {
+                source.key = Filepath(scenePath.GetAbsolute() + "#" + std::to_string(modelTexture.source));
+                source.encodedData = GltfHelpers::GetBufferViewData(model, buffers, image.bufferView);
+            }
+            else
+            {
+                source.key = sceneDirectory / Filepath(image.uri);
+            }
 
-    static size_t GetAccessorValueSize(const tinygltf::Accessor& accessor)
-    {
-        const int32_t count = tinygltf::GetNumComponentsInType(accessor.type);
-        Assert(count >= 0);
+            if (modelTexture.sampler >= 0)
+            {
+                source.sampler = GltfHelpers::GetSamplerDescription(model.samplers[modelTexture.sampler]);
+            }
 
-        const int32_t size = tinygltf::GetComponentSizeInBytes(accessor.componentType);
-        Assert(size >= 0);
+            sources.push_back(source);
+        }
 
-        return static_cast<size_t>(count) * static_cast<size_t>(size);
+        return sources;
     }
 
-    template <class T>
-    static DataView<T> GetAccessorDataView(const tinygltf::Model& model,
-            const tinygltf::Accessor& accessor)
+    static std::vector<TextureSource> GetTextureSources(const ByteView& cookedData,
+            const Filepath& scenePath, const Filepath& sceneDirectory)
     {
-        const tinygltf::BufferView& bufferView = model.bufferViews[accessor.bufferView];
-        Assert(bufferView.byteStride == 0 || bufferView.byteStride == GetAccessorValueSize(accessor));
+        const DataView<CookedScene::Texture> textures
+                = CookedScene::GetSection<CookedScene::Texture>(cookedData, CookedScene::Section::eTextures);
 
-        const size_t offset = bufferView.byteOffset + accessor.byteOffset;
-        const T* data = reinterpret_cast<const T*>(model.buffers[bufferView.buffer].data.data() + offset);
+        const ByteView imageData = CookedScene::GetSection<uint8_t>(cookedData, CookedScene::Section::eImageData);
 
-        return DataView<T>(data, accessor.count);
-    }
-
-    static void EnumerateNodes(const tinygltf::Model& model, const NodeFunc& func)
-    {
-        using Enumerator = std::function<void(const tinygltf::Node&, entt::entity)>;
-
-        const Enumerator enumerator = [&](const tinygltf::Node& node, entt::entity parent)
-            {
-                const entt::entity entity = func(node, parent);
+        std::vector<TextureSource> sources;
+        sources.reserve(textures.size);
 
-                for (const auto& childIndex : node.children)
-                {
-                    const tinygltf::Node& child = model.nodes[childIndex];
+        for (size_t i = 0; i < textures.size; ++i)
+        {
+            const CookedScene::Texture& texture = textures[i];
 
-                    enumerator(child, entity);
-                }
-            };
+            TextureSource source;
 
-        for (const auto& scene : model.scenes)
-        {
-            for (const auto& nodeIndex : scene.nodes)
+            if (texture.imageData.size > 0)
             {
-                const tinygltf::Node& node = model.nodes[nodeIndex];
+                Assert(texture.imageData.offset + texture.imageData.size <= imageData.size);
 
-                enumerator(node, entt::null);
+                source.key = Filepath(scenePath.GetAbsolute() + "#" + std::to_string(texture.imageData.offset));
+                source.encodedData = ByteView(imageData.data + texture.imageData.offset, texture.imageData.size);
             }
-        }
-    }
-
-    static std::vector<Texture> LoadTextures(const tinygltf::Model& model, const Filepath& sceneDirectory)
-    {
-        std::vector<Texture> textures;
-        textures.reserve(model.textures.size());
-
-        for (const auto& modelTexture : model.textures)
-        {
-            Assert(modelTexture.source >= 0);
-
-            const Filepath imagePath(model.images[modelTexture.source].uri);
-
-            Texture texture = TextureCache::GetTexture(sceneDirectory / imagePath);
-
-            if (modelTexture.sampler >= 0)
+            else
             {
-                const tinygltf::Sampler& modelSampler = model.samplers[modelTexture.sampler];
+                source.key = sceneDirectory / Filepath(CookedScene::GetString(cookedData, texture.path));
+            }
 
-                texture.sampler = TextureCache::GetSampler(GetSamplerDescription(modelSampler));
+            if (texture.hasSampler)
+            {
+                source.sampler = texture.sampler;
             }
 
-            textures.push_back(texture);
+            sources.push_back(source);
         }
 
-        return textures;
+        return sources;
     }
 
-    static Material RetrieveMaterial(const tinygltf::Material& gltfMaterial)
+    static ImageSource DecodeImage(const TextureSource& source)
     {
-        Assert(gltfMaterial.pbrMetallicRoughness.baseColorTexture.texCoord == 0);
-        Assert(gltfMaterial.pbrMetallicRoughness.metallicRoughnessTexture.texCoord == 0);
-        Assert(gltfMaterial.normalTexture.texCoord == 0);
-        Assert(gltfMaterial.occlusionTexture.texCoord == 0);
-        Assert(gltfMaterial.emissiveTexture.texCoord == 0);
-
-        Material material{};
-
-        material.data.baseColorTexture = gltfMaterial.pbrMetallicRoughness.baseColorTexture.index;
-        material.data.roughnessMetallicTexture = gltfMaterial.pbrMetallicRoughness.metallicRoughnessTexture.index;
-        material.data.normalTexture = gltfMaterial.normalTexture.index;
-        material.data.occlusionTexture = gltfMaterial.occlusionTexture.index;
-        material.data.emissionTexture = gltfMaterial.emissiveTexture.index;
-
-        material.data.baseColorFactor = GetVec<4>(gltfMaterial.pbrMetallicRoughness.baseColorFactor);
-        material.data.emissionFactor = GetVec<4>(gltfMaterial.emissiveFactor);
-
-        material.data.roughnessFactor = static_cast<float>(gltfMaterial.pbrMetallicRoughness.roughnessFactor);
-        material.data.metallicFactor = static_cast<float>(gltfMaterial.pbrMetallicRoughness.metallicFactor);
-        material.data.normalScale = static_cast<float>(gltfMaterial.normalTexture.scale);
-        material.data.occlusionStrength = static_cast<float>(gltfMaterial.occlusionTexture.strength);
-        material.data.alphaCutoff = static_cast<float>(gltfMaterial.alphaCutoff);
-
-        if (gltfMaterial.alphaMode == "MASK")
-        {
-            material.flags |= MaterialFlagBits::eAlphaTest;
-        }
-        if (gltfMaterial.alphaMode == "BLEND")
-        {
-            material.flags |= MaterialFlagBits::eAlphaBlend;
-        }
-        if (gltfMaterial.doubleSided)
-        {
-            material.flags |= MaterialFlagBits::eDoubleSided;
-        }
-        if (gltfMaterial.normalTexture.index >= 0)
-        {
-            material.flags |= MaterialFlagBits::eNormalMapping;
-        }
-
-        return material;
-    }
+        EASY_FUNCTION()
 
-    template <class T>
-    static DataView<T> RetrieveAttribute(const tinygltf::Model& model,
-            const tinygltf::Primitive& gltfPrimitive, const std::string& attributeName)
-    {
-        if (gltfPrimitive.attributes.contains(attributeName))
+        if (source.encodedData.data)
         {
-            const tinygltf::Accessor& accessor = model.accessors[gltfPrimitive.attributes.at(attributeName)];
-
-            Assert(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
-            return GetAccessorDataView<T>(model, accessor);
+            return ImageLoader::LoadImage(source.encodedData, 4);
         }
 
-        return {};
+        return ImageLoader::LoadImage(source.key, 4);
     }
 
-    static Primitive RetrievePrimitive(
-            const tinygltf::Model& model, const tinygltf::Primitive& gltfPrimitive)
+    static std::vector<Texture> LoadTextures(const std::vector<TextureSource>& sources, ThreadPool& threadPool)
     {
-        Assert(gltfPrimitive.indices >= 0);
-        const tinygltf::Accessor& indicesAccessor = model.accessors[gltfPrimitive.indices];
+        std::vector<std::optional<Texture>> cachedTextures;
+        cachedTextures.reserve(sources.size());
 
-        std::vector<uint32_t> indices;
+        std::map<Filepath, std::future<ImageSource>> decodedImages;
 
-        if (GetIndexType(indicesAccessor.componentType) == vk::IndexType::eUint32)
-        {
-            indices = GetAccessorDataView<uint32_t>(model, indicesAccessor).GetCopy();
-        }
-        else
+        for (const auto& source : sources)
         {
-            const DataView<uint16_t> indices16 = GetAccessorDataView<uint16_t>(model, indicesAccessor);
-
-            indices.resize(indices16.size);
+            cachedTextures.push_back(TextureCache::FindTexture(source.key));
 
-            for (size_t i = 0; i < indices16.size; ++i)
+            if (!cachedTextures.back().has_value() && !decodedImages.contains(source.key))
             {
-                indices[i] = static_cast<uint32_t>(indices16[i]);
+                decodedImages.emplace(source.key, threadPool.Execute([&source]()
+                    {
+                        return DecodeImage(source);
+                    }));
             }
         }
 
-        const DataView<glm::vec3> positions = RetrieveAttribute<glm::vec3>(model, gltfPrimitive, "POSITION");
-        const DataView<glm::vec3> normals = RetrieveAttribute<glm::vec3>(model, gltfPrimitive, "NORMAL");
-        const DataView<glm::vec3> tangents = RetrieveAttribute<glm::vec3>(model, gltfPrimitive, "TANGENT");
-        const DataView<glm::vec2> texCoords = RetrieveAttribute<glm::vec2>(model, gltfPrimitive, "TEXCOORD_0");
-
-        return Primitive(std::move(indices),
-                positions.GetCopy(), normals.GetCopy(),
-                tangents.GetCopy(), texCoords.GetCopy());
-    }
-
-    static Transform RetrieveTransform(const tinygltf::Node& node)
-    {
-        Transform transform;
+        std::vector<Texture> textures;
+        textures.reserve(sources.size());
 
-        if (!node.matrix.empty())
+        for (size_t i = 0; i < sources.size(); ++i)
         {
-            const glm::mat4 matrix = glm::make_mat4(node.matrix.data());
+            const TextureSource& source = sources[i];
 
-            transform = Transform(matrix);
-        }
+            std::optional<Texture> texture = cachedTextures[i];
 
-        if (!node.scale.empty())
-        {
-            transform.SetScale(GetVec<3>(node.scale));
-        }
+            if (!texture.has_value())
+            {
+                texture = TextureCache::FindTexture(source.key);
+            }
 
-        if (!node.rotation.empty())
-        {
-            transform.SetRotation(GetQuaternion(node.rotation));
-        }
+            if (!texture.has_value())
+            {
+                texture = TextureCache::AddTexture(source.key, threadPool.Wait(decodedImages.at(source.key)));
+            }
 
-        if (!node.translation.empty())
-        {
-            transform.SetTranslation(GetVec<3>(node.translation));
+            if (source.sampler.has_value())
+            {
+                texture->sampler = TextureCache::GetSampler(source.sampler.value());
+            }
+
+            textures.push_back(texture.value());
         }
 
-        return transform;
+        return textures;
     }
+}
 
-    static CameraLocation RetrieveCameraLocation(const tinygltf::Node& node)
-    {
-        glm::quat rotation = glm::quat();
-        if (!node.rotation.empty())
-        {
-            rotation = GetQuaternion(node.rotation);
-        }
+SceneLoader::SceneLoader(Scene& scene_, const Filepath& path)
+    : scene(scene_)
+    , scenePath(path)
+    , sceneDirectory(path.GetDirectory())
+{
+    const float startSeconds = Timer::GetGlobalSeconds();
 
-        const glm::vec3 position = GetVec<3>(node.translation);
-        const glm::vec3 direction = rotation * Direction::kForward;
-        const glm::vec3 up = Direction::kUp;
+    threadPool = std::make_unique<ThreadPool>();
 
-        return CameraLocation{ position, direction, up };
+    if (path.GetExtension() != CookedScene::kExtension)
+    {
+        LoadGltfScene();
     }
-
-    static CameraProjection RetrieveCameraProjection(const tinygltf::Camera& camera)
+    else if (!LoadCookedScene())
     {
-        if (camera.type == "perspective")
-        {
-            const tinygltf::PerspectiveCamera& perspectiveCamera = camera.perspective;
+        const std::optional<Filepath> sourcePath = Details::FindSourceScene(path);
 
-            return CameraProjection{
-                static_cast<float>(perspectiveCamera.yfov),
-                static_cast<float>(perspectiveCamera.aspectRatio), 1.0f,
-                static_cast<float>(perspectiveCamera.znear),
-                static_cast<float>(perspectiveCamera.zfar),
-            };
-        }
-
-        if (camera.type == "orthographic")
+        if (!sourcePath.has_value())
         {
-            const tinygltf::OrthographicCamera& orthographicCamera = camera.orthographic;
-
-            return CameraProjection{
-                0.0f,
-                static_cast<float>(orthographicCamera.xmag),
-                static_cast<float>(orthographicCamera.ymag),
-                static_cast<float>(orthographicCamera.znear),
-                static_cast<float>(orthographicCamera.zfar),
-            };
+            return;
         }
 
-        return Config::DefaultCamera::kProjection;
+        LogW << "Loading source scene instead: " << sourcePath->GetAbsolute() << "\n";
+
+        scenePath = sourcePath.value();
+
+        LoadGltfScene();
     }
+
+    const float loadSeconds = Timer::GetGlobalSeconds() - startSeconds;
+
+    LogI << "Scene loaded: " << path.GetFilename() << " in " << Format("%.3f", loadSeconds) << " s\n";
 }
 
-SceneLoader::SceneLoader(Scene& scene_, const Filepath& path)
-    : scene(scene_)
-    , sceneDirectory(path.GetDirectory())
+SceneLoader::~SceneLoader() = default;
+
+void SceneLoader::LoadGltfScene()
 {
-    model = std::make_unique<tinygltf::Model>();
+    EASY_FUNCTION()
 
-    LoadModel(path);
+    buffers = std::make_unique<GltfBuffers>();
+
+    model = GltfHelpers::LoadModel(scenePath, *buffers);
 
     AddTextureStorageComponent();
 
     AddMaterialStorageComponent();
 
-    AddGeometryStorageComponent();
+    const std::vector<uint32_t> primitiveIndices = AddGeometryStorageComponent();
 
-    AddEntities();
-}
+    // Instance transforms are read from the buffers as well
+    AddEntities(primitiveIndices);
 
-SceneLoader::~SceneLoader() = default;
+    GltfHelpers::ReleaseBuffers(*model, *buffers);
+}
 
-void SceneLoader::LoadModel(const Filepath& path) const
+bool SceneLoader::LoadCookedScene() const
 {
     EASY_FUNCTION()
 
-    const auto imageLoader = [](tinygltf::Image*, const int, std::string*,
-            std::string*, int, int, const unsigned char*, int, void*)
-        {
-            return true;
-        };
-
-    tinygltf::TinyGLTF loader;
-    loader.SetImageLoader(imageLoader, nullptr);
-
-    std::string errors;
-    std::string warnings;
+    const MappedFile file(scenePath);
 
-    const bool result = loader.LoadASCIIFromFile(model.get(), &errors, &warnings, path.GetAbsolute());
+    const ByteView cookedData = file.GetData();
 
-    if (!warnings.empty())
+    if (!file.IsValid() || !CookedScene::IsValid(cookedData))
     {
-        LogW << "Scene loaded with warnings:\n" << warnings;
-    }
+        LogE << "Invalid cooked scene: " << scenePath.GetAbsolute() << "\n";
 
-    if (!errors.empty())
-    {
-        LogE << "Failed to load scene:\n" << errors;
+        return false;
     }
 
-    Assert(result);
+    AddTextureStorageComponent(cookedData);
+
+    AddMaterialStorageComponent(cookedData);
+
+    AddGeometryStorageComponent(cookedData);
+
+    AddEntities(cookedData);
+
+    return true;
 }
 
 void SceneLoader::AddTextureStorageComponent() const
@@ -424,7 +284,18 @@ void SceneLoader::AddTextureStorageComponent() const
 
     auto& tsc = scene.ctx().emplace<TextureStorageComponent>();
 
-    tsc.textures = Details::LoadTextures(*model, sceneDirectory);
+    tsc.textures = Details::LoadTextures(
+            Details::GetTextureSources(*model, *buffers, scenePath, sceneDirectory), *threadPool);
+}
+
+void SceneLoader::AddTextureStorageComponent(const ByteView& cookedData) const
+{
+    EASY_FUNCTION()
+
+    auto& tsc = scene.ctx().emplace<TextureStorageComponent>();
+
+    tsc.textures = Details::LoadTextures(
+            Details::GetTextureSources(cookedData, scenePath, sceneDirectory), *threadPool);
 }
 
 void SceneLoader::AddMaterialStorageComponent() const
@@ -437,34 +308,141 @@ void SceneLoader::AddMaterialStorageComponent() const
 
     for (const auto& material : model->materials)
     {
-        msc.materials.push_back(Details::RetrieveMaterial(material));
+        msc.materials.push_back(GltfHelpers::RetrieveMaterial(material));
     }
 }
 
-void SceneLoader::AddGeometryStorageComponent() const
+void SceneLoader::AddMaterialStorageComponent(const ByteView& cookedData) const
 {
     EASY_FUNCTION()
 
-    auto& gsc = scene.ctx().emplace<GeometryStorageComponent>();
+    const DataView<CookedScene::Material> materials
+            = CookedScene::GetSection<CookedScene::Material>(cookedData, CookedScene::Section::eMaterials);
+
+    auto& msc = scene.ctx().emplace<MaterialStorageComponent>();
 
-    gsc.primitives.reserve(model->meshes.size());
+    msc.materials.reserve(materials.size);
+
+    for (size_t i = 0; i < materials.size; ++i)
+    {
+        msc.materials.push_back(Material{ materials[i].data, MaterialFlags(materials[i].flags) });
+    }
+}
+
+std::vector<uint32_t> SceneLoader::AddGeometryStorageComponent() const
+{
+    EASY_FUNCTION()
+
+    std::vector<std::future<MeshData>> meshFutures;
 
     for (const auto& mesh : model->meshes)
     {
         for (const auto& primitive : mesh.primitives)
         {
-            gsc.primitives.emplace_back(Details::RetrievePrimitive(*model, primitive));
+            meshFutures.push_back(threadPool->Execute([this, &primitive]()
+                {
+                    return GltfHelpers::RetrieveMeshData(*model, *buffers, primitive, threadPool.get());
+                }));
         }
     }
+
+    std::vector<MeshData> meshes;
+    meshes.reserve(meshFutures.size());
+
+    for (auto& meshFuture : meshFutures)
+    {
+        meshes.push_back(threadPool->Wait(meshFuture));
+    }
+
+    std::vector<uint32_t> primitiveIndices = MeshDataHelpers::RemoveDuplicates(meshes);
+
+    auto& gsc = scene.ctx().emplace<GeometryStorageComponent>();
+
+    gsc.primitives.reserve(meshes.size());
+
+    for (MeshData& mesh : meshes)
+    {
+        gsc.primitives.emplace_back(std::move(mesh));
+    }
+
+    PrimitiveHelpers::MakeResident(gsc.primitives);
+
+    return primitiveIndices;
+}
+
+void SceneLoader::AddGeometryStorageComponent(const ByteView& cookedData) const
+{
+    EASY_FUNCTION()
+
+    const DataView<CookedScene::Primitive> primitives
+            = CookedScene::GetSection<CookedScene::Primitive>(cookedData, CookedScene::Section::ePrimitives);
+
+    const DataView<uint32_t> indices
+            = CookedScene::GetSection<uint32_t>(cookedData, CookedScene::Section::eIndices);
+    const DataView<glm::vec3> positions
+            = CookedScene::GetSection<glm::vec3>(cookedData, CookedScene::Section::ePositions);
+    const DataView<glm::vec3> normals
+            = CookedScene::GetSection<glm::vec3>(cookedData, CookedScene::Section::eNormals);
+    const DataView<glm::vec3> tangents
+            = CookedScene::GetSection<glm::vec3>(cookedData, CookedScene::Section::eTangents);
+    const DataView<glm::vec2> texCoords
+            = CookedScene::GetSection<glm::vec2>(cookedData, CookedScene::Section::eTexCoords);
+    const DataView<Meshlet> meshlets
+            = CookedScene::GetSection<Meshlet>(cookedData, CookedScene::Section::eMeshlets);
+    const DataView<Lod> lods
+            = CookedScene::GetSection<Lod>(cookedData, CookedScene::Section::eLods);
+
+    auto& gsc = scene.ctx().emplace<GeometryStorageComponent>();
+
+    gsc.primitives.reserve(primitives.size);
+
+    for (size_t i = 0; i < primitives.size; ++i)
+    {
+        const CookedScene::Primitive& primitive = primitives[i];
+
+        Assert(primitive.firstIndex + primitive.indexCount <= indices.size);
+        Assert(primitive.firstVertex + primitive.vertexCount <= positions.size);
+        Assert(primitive.firstMeshlet + primitive.meshletCount <= meshlets.size);
+        Assert(primitive.firstLod + primitive.lodCount <= lods.size);
+
+        const auto getStream = [&]<class T>(const DataView<T>& stream)
+            {
+                return DataView<T>(stream.data + primitive.firstVertex, primitive.vertexCount);
+            };
+
+        const MeshView meshView{
+            .indices = DataView<uint32_t>(indices.data + primitive.firstIndex, primitive.indexCount),
+            .positions = getStream(positions),
+            .normals = getStream(normals),
+            .tangents = getStream(tangents),
+            .texCoords = getStream(texCoords),
+            .bbox = primitive.bbox,
+            .meshlets = DataView<Meshlet>(meshlets.data + primitive.firstMeshlet, primitive.meshletCount),
+            .lods = DataView<Lod>(lods.data + primitive.firstLod, primitive.lodCount)
+        };
+
+        gsc.primitives.emplace_back(meshView);
+    }
+
+    // Streams are uploaded straight from the mapping, which outlives this call
+    PrimitiveHelpers::MakeResident(gsc.primitives);
 }
 
-void SceneLoader::AddEntities() const
+void SceneLoader::AddEntities(const std::vector<uint32_t>& primitiveIndices) const
 {
     EASY_FUNCTION()
 
-    Details::EnumerateNodes(*model, [&](const tinygltf::Node& node, entt::entity parent)
+    const std::vector<uint32_t> primitiveOffsets = GltfHelpers::GetPrimitiveOffsets(*model);
+
+    std::vector<entt::entity> entities(model->nodes.size(), entt::null);
+
+    GltfHelpers::EnumerateNodes(*model, [&](int32_t nodeIndex, int32_t parentIndex)
         {
-            const entt::entity entity = scene.CreateEntity(parent, Details::RetrieveTransform(node));
+            const tinygltf::Node& node = model->nodes[nodeIndex];
+
+            const entt::entity parent = parentIndex >= 0 ? entities[parentIndex] : entt::null;
+
+            const entt::entity entity = scene.CreateEntity(parent, GltfHelpers::RetrieveTransform(node));
 
             if (!node.name.empty())
             {
@@ -473,63 +451,130 @@ void SceneLoader::AddEntities() const
 
             if (node.mesh >= 0)
             {
-                AddRenderComponent(entity, node);
+                const tinygltf::Mesh& mesh = model->meshes[node.mesh];
+
+                AddRenderComponent(entity, mesh, DataView<uint32_t>(
+                        primitiveIndices.data() + primitiveOffsets[node.mesh], mesh.primitives.size()));
+
+                std::vector<glm::mat4> instanceTransforms
+                        = GltfHelpers::RetrieveInstanceTransforms(*model, *buffers, node);
+
+                if (!instanceTransforms.empty())
+                {
+                    scene.emplace<InstanceComponent>(entity).transforms = std::move(instanceTransforms);
+                }
             }
 
             if (node.camera >= 0)
             {
-                AddCameraComponent(entity, node);
+                AddCameraComponent(entity, GltfHelpers::RetrieveCameraLocation(node),
+                        GltfHelpers::RetrieveCameraProjection(model->cameras[node.camera]));
             }
 
             if (node.extensions.contains("KHR_lights_punctual"))
             {
-                AddLightComponent(entity, node);
+                scene.emplace<LightComponent>(entity, GltfHelpers::RetrieveLight(*model, node));
             }
 
             if (node.extras.Has("environment"))
             {
-                AddEnvironmentComponent(entity, node);
+                const std::string panoramaPath
+                        = node.extras.Get("environment").Get("panorama_path").Get<std::string>();
+
+                AddEnvironmentComponent(entity, Filepath(panoramaPath));
             }
 
-            if (node.extras.Has("scene_prefab"))
-            {
-                const Filepath scenePath(node.extras.Get("scene_prefab").Get<std::string>());
+            AddSceneReferences(entity, Details::GetExtrasString(node, "scene_prefab"),
+                    scene.FindEntity(Details::GetExtrasString(node, "scene_instance")),
+                    scene.FindEntity(Details::GetExtrasString(node, "scene_spawn")));
 
-                scene.EmplaceScenePrefab(Scene(scenePath), entity);
-            }
+            entities[nodeIndex] = entity;
+        });
+}
 
-            if (node.extras.Has("scene_instance"))
-            {
-                const std::string name = node.extras.Get("scene_instance").Get<std::string>();
+void SceneLoader::AddEntities(const ByteView& cookedData) const
+{
+    EASY_FUNCTION()
 
-                scene.EmplaceSceneInstance(scene.FindEntity(name), entity);
-            }
+    const DataView<CookedScene::Node> nodes
+            = CookedScene::GetSection<CookedScene::Node>(cookedData, CookedScene::Section::eNodes);
+    const DataView<RenderObject> renderObjects
+            = CookedScene::GetSection<RenderObject>(cookedData, CookedScene::Section::eRenderObjects);
+    const DataView<CookedScene::Camera> cameras
+            = CookedScene::GetSection<CookedScene::Camera>(cookedData, CookedScene::Section::eCameras);
+    const DataView<LightComponent> lights
+            = CookedScene::GetSection<LightComponent>(cookedData, CookedScene::Section::eLights);
+    const DataView<glm::mat4> instances
+            = CookedScene::GetSection<glm::mat4>(cookedData, CookedScene::Section::eInstances);
+
+    std::vector<entt::entity> entities;
+    entities.reserve(nodes.size);
+
+    for (size_t i = 0; i < nodes.size; ++i)
+    {
+        const CookedScene::Node& node = nodes[i];
 
-            if (node.extras.Has("scene_spawn"))
-            {
-                const std::string name = node.extras.Get("scene_spawn").Get<std::string>();
+        Assert(node.parent == CookedScene::kInvalidIndex || node.parent < i);
 
-                scene.CreateSceneInstance(scene.FindEntity(name), scene.GetEntityTransform(entity));
-            }
+        const entt::entity parent = node.parent != CookedScene::kInvalidIndex ? entities[node.parent] : entt::null;
 
-            return entity;
-        });
+        const entt::entity entity = scene.CreateEntity(parent, Transform(node.transform));
+
+        if (node.name.size > 0)
+        {
+            const std::string name = CookedScene::GetString(cookedData, node.name);
+
+            scene.emplace<NameComponent>(entity, name);
+        }
+
+        if (node.renderObjectCount > 0)
+        {
+            Assert(node.firstRenderObject + node.renderObjectCount <= renderObjects.size);
+
+            auto& rc = scene.emplace<RenderComponent>(entity);
+
+            rc.renderObjects = DataView<RenderObject>(renderObjects.data + node.firstRenderObject,
+                    node.renderObjectCount).GetCopy();
+        }
+
+        if (node.instanceCount > 0)
+        {
+            Assert(node.firstInstance + node.instanceCount <= instances.size);
+
+            scene.emplace<InstanceComponent>(entity).transforms
+                    = DataView<glm::mat4>(instances.data + node.firstInstance, node.instanceCount).GetCopy();
+        }
+
+        if (node.camera != CookedScene::kInvalidIndex)
+        {
+            AddCameraComponent(entity, cameras[node.camera].location, cameras[node.camera].projection);
+        }
+
+        if (node.light != CookedScene::kInvalidIndex)
+        {
+            scene.emplace<LightComponent>(entity, lights[node.light]);
+        }
+
+        if (node.environment.size > 0)
+        {
+            AddEnvironmentComponent(entity, Filepath(CookedScene::GetString(cookedData, node.environment)));
+        }
+
+        AddSceneReferences(entity, CookedScene::GetString(cookedData, node.scenePrefab),
+                scene.FindEntity(CookedScene::GetString(cookedData, node.sceneInstance)),
+                scene.FindEntity(CookedScene::GetString(cookedData, node.sceneSpawn)));
+
+        entities.push_back(entity);
+    }
 }
 
-void SceneLoader::AddRenderComponent(entt::entity entity, const tinygltf::Node& node) const
+void SceneLoader::AddRenderComponent(entt::entity entity,
+        const tinygltf::Mesh& mesh, const DataView<uint32_t>& primitiveIndices) const
 {
     EASY_FUNCTION()
 
     auto& rc = scene.emplace<RenderComponent>(entity);
 
-    const tinygltf::Mesh& mesh = model->meshes[node.mesh];
-
-    size_t meshOffset = 0;
-    for (int32_t i = 0; i < node.mesh; ++i)
-    {
-        meshOffset += model->meshes[i].primitives.size();
-    }
-
     rc.renderObjects.resize(mesh.primitives.size());
 
     for (size_t i = 0; i < mesh.primitives.size(); ++i)
@@ -538,21 +583,20 @@ void SceneLoader::AddRenderComponent(entt::entity entity, const tinygltf::Node&
 
         Assert(primitive.material >= 0);
 
-        rc.renderObjects[i].primitive = static_cast<uint32_t>(meshOffset + i);
+        rc.renderObjects[i].primitive = primitiveIndices[i];
         rc.renderObjects[i].material = static_cast<uint32_t>(primitive.material);
     }
 }
 
-void SceneLoader::AddCameraComponent(entt::entity entity, const tinygltf::Node& node) const
+void SceneLoader::AddCameraComponent(entt::entity entity,
+        const CameraLocation& location, const CameraProjection& projection) const
 {
     EASY_FUNCTION()
 
     auto& cc = scene.emplace<CameraComponent>(entity);
 
-    const tinygltf::Camera& camera = model->cameras[node.camera];
-
-    cc.location = Details::RetrieveCameraLocation(node);
-    cc.projection = Details::RetrieveCameraProjection(camera);
+    cc.location = location;
+    cc.projection = projection;
 
     cc.viewMatrix = CameraHelpers::ComputeViewMatrix(cc.location);
     cc.projMatrix = CameraHelpers::ComputeProjMatrix(cc.projection);
@@ -563,46 +607,35 @@ void SceneLoader::AddCameraComponent(entt::entity entity, const tinygltf::Node&
     }
 }
 
-void SceneLoader::AddLightComponent(entt::entity entity, const tinygltf::Node& node) const
+void SceneLoader::AddEnvironmentComponent(entt::entity entity, const Filepath& panoramaPath) const
 {
     EASY_FUNCTION()
 
-    auto& lc = scene.emplace<LightComponent>(entity);
-
-    const int32_t lightIndex = node.extensions.at("KHR_lights_punctual").Get("light").Get<int32_t>();
-
-    Assert(lightIndex >= 0);
+    auto& ec = scene.emplace<EnvironmentComponent>(entity);
 
-    const tinygltf::Light& light = model->lights[lightIndex];
+    ec = EnvironmentHelpers::LoadEnvironment(panoramaPath);
 
-    if (light.type == "directional")
-    {
-        lc.type = LightType::eDirectional;
-    }
-    else if (light.type == "point")
-    {
-        lc.type = LightType::ePoint;
-    }
-    else
+    if (!scene.ctx().contains<EnvironmentComponent&>())
     {
-        Assert(false);
+        scene.ctx().emplace<EnvironmentComponent&>(ec);
     }
-
-    lc.color = Details::GetVec<3>(light.color) * static_cast<float>(light.intensity);
 }
 
-void SceneLoader::AddEnvironmentComponent(entt::entity entity, const tinygltf::Node& node) const
+void SceneLoader::AddSceneReferences(entt::entity entity, const std::string& scenePrefab,
+        entt::entity sceneInstance, entt::entity sceneSpawn) const
 {
-    EASY_FUNCTION()
-
-    auto& ec = scene.emplace<EnvironmentComponent>(entity);
-
-    const Filepath panoramaPath(node.extras.Get("environment").Get("panorama_path").Get<std::string>());
+    if (!scenePrefab.empty())
+    {
+        scene.EmplaceScenePrefab(Scene(Filepath(scenePrefab)), entity);
+    }
 
-    ec = EnvironmentHelpers::LoadEnvironment(panoramaPath);
+    if (sceneInstance != entt::null)
+    {
+        scene.EmplaceSceneInstance(sceneInstance, entity);
+    }
 
-    if (!scene.ctx().contains<EnvironmentComponent&>())
+    if (sceneSpawn != entt::null)
     {
-        scene.ctx().emplace<EnvironmentComponent&>(ec);
+        scene.CreateSceneInstance(sceneSpawn, scene.GetEntityTransform(entity));
     }
 }
@@ -1,5 +1,3 @@
-#include <glm/gtx/matrix_decompose.hpp>
-
 #include "Engine/Scene/Transform.hpp"
 
 #include "Utils/Helpers.hpp"
@@ -8,50 +6,52 @@ const Transform Transform::kIdentity = Transform{};
 
 Transform::Transform(const glm::mat4& matrix_)
     : matrix(matrix_)
+    , trsValid(false)
 {}
 
-Transform::Transform(const glm::vec3& translation)
-{
-    SetTranslation(translation);
-}
-
-Transform::Transform(const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale)
-{
-    const glm::mat4 scaleMatrix = glm::scale(Matrix4::kIdentity, scale);
-    const glm::mat4 rotationMatrix = glm::toMat4(rotation);
-
-    matrix = rotationMatrix * scaleMatrix;
+Transform::Transform(const glm::vec3& translation_)
+    : translation(translation_)
+    , matrixValid(false)
+{}
 
-    SetTranslation(translation);
-}
+Transform::Transform(const glm::vec3& translation_, const glm::quat& rotation_, const glm::vec3& scale_)
+    : translation(translation_)
+    , rotation(glm::normalize(rotation_))
+    , scale(scale_)
+    , matrixValid(false)
+{}
 
 const glm::mat4& Transform::GetMatrix() const
 {
+    if (!matrixValid)
+    {
+        ComposeMatrix();
+    }
+
     return matrix;
 }
 
 glm::vec3 Transform::GetTranslation() const
 {
-    return matrix[3];
+    return trsValid ? translation : glm::vec3(matrix[3]);
 }
 
 glm::quat Transform::GetRotation() const
 {
-    glm::mat3 rotationMatrix;
-    rotationMatrix[0] = GetAxis(Axis::eX);
-    rotationMatrix[1] = GetAxis(Axis::eY);
-    rotationMatrix[2] = GetAxis(Axis::eZ);
+    if (!trsValid)
+    {
+        DecomposeMatrix();
+    }
 
-    return glm::quat(rotationMatrix);
+    return rotation;
 }
 
 glm::vec3 Transform::GetScale() const
 {
-    glm::vec3 scale;
-
-    scale.x = glm::length(matrix[0]);
-    scale.y = glm::length(matrix[1]);
-    scale.z = glm::length(matrix[2]);
+    if (!trsValid)
+    {
+        DecomposeMatrix();
+    }
 
     return scale;
 }
@@ -63,29 +63,50 @@ glm::vec3 Transform::GetAxis(Axis axis) const
 
 glm::vec3 Transform::GetScaledAxis(Axis axis) const
 {
-    return matrix[static_cast<int32_t>(axis)];
+    return GetMatrix()[static_cast<int32_t>(axis)];
 }
 
 Transform Transform::GetInverse() const
 {
-    return Transform(glm::inverse(matrix));
+    return Transform(glm::inverse(GetMatrix()));
 }
 
-void Transform::SetTranslation(const glm::vec3& translation)
+void Transform::SetTranslation(const glm::vec3& translation_)
 {
-    matrix[3].x = translation.x;
-    matrix[3].y = translation.y;
-    matrix[3].z = translation.z;
+    if (trsValid)
+    {
+        translation = translation_;
+    }
+
+    if (matrixValid)
+    {
+        matrix[3] = glm::vec4(translation_, 1.0f);
+    }
 }
 
-void Transform::SetRotation(const glm::quat& rotation)
+void Transform::SetRotation(const glm::quat& rotation_)
 {
-    *this = Transform(GetTranslation(), rotation, GetScale());
+    if (!trsValid)
+    {
+        DecomposeMatrix();
+    }
+
+    // Normalization keeps incremental rotations from drifting away from unit length
+    rotation = glm::normalize(rotation_);
+
+    matrixValid = false;
 }
 
-void Transform::SetScale(const glm::vec3& scale)
+void Transform::SetScale(const glm::vec3& scale_)
 {
-    *this = Transform(GetTranslation(), GetRotation(), scale);
+    if (!trsValid)
+    {
+        DecomposeMatrix();
+    }
+
+    scale = scale_;
+
+    matrixValid = false;
 }
 
 void Transform::operator*=(const Transform& other)
@@ -93,6 +114,42 @@ void Transform::operator*=(const Transform& other)
     *this = *this * other;
 }
 
+void Transform::ComposeMatrix() const
+{
+    const glm::mat3 rotationMatrix = glm::mat3_cast(rotation);
+
+    matrix[0] = glm::vec4(rotationMatrix[0] * scale.x, 0.0f);
+    matrix[1] = glm::vec4(rotationMatrix[1] * scale.y, 0.0f);
+    matrix[2] = glm::vec4(rotationMatrix[2] * scale.z, 0.0f);
+    matrix[3] = glm::vec4(translation, 1.0f);
+
+    matrixValid = true;
+}
+
+void Transform::DecomposeMatrix() const
+{
+    translation = glm::vec3(matrix[3]);
+
+    scale.x = glm::length(glm::vec3(matrix[0]));
+    scale.y = glm::length(glm::vec3(matrix[1]));
+    scale.z = glm::length(glm::vec3(matrix[2]));
+
+    // Mirroring is kept as a negative scale along x, the rest of the matrix is a proper rotation then
+    if (glm::determinant(glm::mat3(matrix)) < 0.0f)
+    {
+        scale.x = -scale.x;
+    }
+
+    glm::mat3 rotationMatrix;
+    rotationMatrix[0] = glm::vec3(matrix[0]) / scale.x;
+    rotationMatrix[1] = glm::vec3(matrix[1]) / scale.y;
+    rotationMatrix[2] = glm::vec3(matrix[2]) / scale.z;
+
+    rotation = glm::normalize(glm::quat(rotationMatrix));
+
+    trsValid = true;
+}
+
 Transform operator*(const Transform& a, const Transform& b)
 {
     return Transform(b.GetMatrix() * a.GetMatrix());
@@ -0,0 +1,456 @@
+#include <numeric>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <xmmintrin.h>
+    #define TRANSFORM_SSE 1
+#endif
+
+#include "Engine/Scene/TransformHierarchy.hpp"
+
+#include "Engine/Scene/Components/Components.hpp"
+#include "Engine/Scene/Scene.hpp"
+#include "Engine/Scene/Transform.hpp"
+
+#include "Utils/Assert.hpp"
+#include "Utils/ThreadPool.hpp"
+
+namespace Details
+{
+    // Number of entities processed by one parallel task
+    static constexpr size_t kBlockSize = 1024;
+
+    static glm::mat4 ComposeMatrix(const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale)
+    {
+        const glm::mat3 rotationMatrix = glm::mat3_cast(rotation);
+
+        return glm::mat4(
+                glm::vec4(rotationMatrix[0] * scale.x, 0.0f),
+                glm::vec4(rotationMatrix[1] * scale.y, 0.0f),
+                glm::vec4(rotationMatrix[2] * scale.z, 0.0f),
+                glm::vec4(translation, 1.0f));
+    }
+
+    template <class T>
+    static void Reorder(std::vector<T>& data, const std::vector<uint32_t>& order)
+    {
+        std::vector<T> reordered;
+        reordered.reserve(order.size());
+
+        for (const uint32_t index : order)
+        {
+            reordered.push_back(data[index]);
+        }
+
+        data = std::move(reordered);
+    }
+
+#if TRANSFORM_SSE
+    // Every column of the result is a linear combination of the columns of a
+    static glm::mat4 Multiply(const glm::mat4& a, const glm::mat4& b)
+    {
+        const __m128 a0 = _mm_loadu_ps(&a[0][0]);
+        const __m128 a1 = _mm_loadu_ps(&a[1][0]);
+        const __m128 a2 = _mm_loadu_ps(&a[2][0]);
+        const __m128 a3 = _mm_loadu_ps(&a[3][0]);
+
+        glm::mat4 result;
+
+        for (glm::length_t i = 0; i < 4; ++i)
+        {
+            const __m128 column01 = _mm_add_ps(
+                    _mm_mul_ps(a0, _mm_set1_ps(b[i][0])),
+                    _mm_mul_ps(a1, _mm_set1_ps(b[i][1])));
+
+            const __m128 column23 = _mm_add_ps(
+                    _mm_mul_ps(a2, _mm_set1_ps(b[i][2])),
+                    _mm_mul_ps(a3, _mm_set1_ps(b[i][3])));
+
+            _mm_storeu_ps(&result[i][0], _mm_add_ps(column01, column23));
+        }
+
+        return result;
+    }
+#else
+    static glm::mat4 Multiply(const glm::mat4& a, const glm::mat4& b)
+    {
+        return a * b;
+    }
+#endif
+}
+
+glm::mat4 TransformHierarchy::Add(entt::entity entity, entt::entity parent, const Transform& localTransform)
+{
+    const uint32_t index = static_cast<uint32_t>(entities.size());
+    const uint32_t parentIndex = parent != entt::null ? GetIndex(parent) : kInvalidIndex;
+
+    Assert(parent == entt::null || parentIndex != kInvalidIndex);
+
+    const size_t entityIndex = static_cast<size_t>(entt::to_entity(entity));
+
+    if (entityIndex >= indices.size())
+    {
+        indices.resize(entityIndex + 1, kInvalidIndex);
+    }
+
+    indices[entityIndex] = index;
+
+    entities.push_back(entity);
+    parents.push_back(parentIndex);
+
+    translations.push_back(localTransform.GetTranslation());
+    rotations.push_back(localTransform.GetRotation());
+    scales.push_back(localTransform.GetScale());
+
+    const glm::mat4 localMatrix = Details::ComposeMatrix(translations.back(), rotations.back(), scales.back());
+
+    if (parentIndex != kInvalidIndex)
+    {
+        worldMatrices.push_back(Details::Multiply(worldMatrices[parentIndex], localMatrix));
+    }
+    else
+    {
+        worldMatrices.push_back(localMatrix);
+    }
+
+    dirty.push_back(0);
+
+    return worldMatrices.back();
+}
+
+void TransformHierarchy::Remove(entt::entity entity)
+{
+    const uint32_t index = GetIndex(entity);
+
+    if (index == kInvalidIndex)
+    {
+        return;
+    }
+
+    // The entry stays in place until the next sort, nothing refers to it anymore
+    indices[static_cast<size_t>(entt::to_entity(entity))] = kInvalidIndex;
+
+    entities[index] = entt::null;
+    parents[index] = kInvalidIndex;
+    dirty[index] = 0;
+
+    ++removedCount;
+}
+
+void TransformHierarchy::Reparent(entt::entity entity, entt::entity parent)
+{
+    const uint32_t index = GetIndex(entity);
+
+    // Entities are reparented once before they get their transform
+    if (index == kInvalidIndex)
+    {
+        return;
+    }
+
+    const uint32_t parentIndex = parent != entt::null ? GetIndex(parent) : kInvalidIndex;
+
+    Assert(parent == entt::null || parentIndex != kInvalidIndex);
+
+    parents[index] = parentIndex;
+
+    if (parentIndex != kInvalidIndex && !IsProcessedBefore(parentIndex, index))
+    {
+        sorted = false;
+    }
+
+    MarkModified(index);
+}
+
+Transform TransformHierarchy::GetLocalTransform(entt::entity entity) const
+{
+    const uint32_t index = GetIndex(entity);
+
+    Assert(index != kInvalidIndex);
+
+    return Transform(translations[index], rotations[index], scales[index]);
+}
+
+void TransformHierarchy::SetLocalTransform(entt::entity entity, const Transform& transform)
+{
+    const uint32_t index = GetIndex(entity);
+
+    Assert(index != kInvalidIndex);
+
+    translations[index] = transform.GetTranslation();
+    rotations[index] = transform.GetRotation();
+    scales[index] = transform.GetScale();
+
+    MarkModified(index);
+}
+
+void TransformHierarchy::SetLocalTranslation(entt::entity entity, const glm::vec3& translation)
+{
+    const uint32_t index = GetIndex(entity);
+
+    Assert(index != kInvalidIndex);
+
+    translations[index] = translation;
+
+    MarkModified(index);
+}
+
+void TransformHierarchy::SetLocalRotation(entt::entity entity, const glm::quat& rotation)
+{
+    const uint32_t index = GetIndex(entity);
+
+    Assert(index != kInvalidIndex);
+
+    // Normalization keeps incremental rotations from drifting away from unit length
+    rotations[index] = glm::normalize(rotation);
+
+    MarkModified(index);
+}
+
+void TransformHierarchy::SetLocalScale(entt::entity entity, const glm::vec3& scale)
+{
+    const uint32_t index = GetIndex(entity);
+
+    Assert(index != kInvalidIndex);
+
+    scales[index] = scale;
+
+    MarkModified(index);
+}
+
+void TransformHierarchy::Update(const Scene& scene, ThreadPool* threadPool)
+{
+    EASY_FUNCTION()
+
+    const size_t sortedCount = GetSortedCount();
+    const size_t appendedCount = entities.size() - sortedCount;
+
+    // Appended and removed entities are sorted in or dropped once they make up a noticeable part of the storage
+    if (!sorted || removedCount > entities.size() / 4
+            || appendedCount > std::max(Details::kBlockSize, sortedCount / 4))
+    {
+        Sort();
+    }
+
+    if (!modified)
+    {
+        return;
+    }
+
+    PropagateDirty();
+
+    ComputeWorldMatrices(threadPool);
+
+    StoreWorldTransforms(scene, threadPool);
+
+    modified = false;
+}
+
+uint32_t TransformHierarchy::GetIndex(entt::entity entity) const
+{
+    const size_t entityIndex = static_cast<size_t>(entt::to_entity(entity));
+
+    if (entityIndex >= indices.size() || indices[entityIndex] == kInvalidIndex)
+    {
+        return kInvalidIndex;
+    }
+
+    const uint32_t index = indices[entityIndex];
+
+    return entities[index] == entity ? index : kInvalidIndex;
+}
+
+bool TransformHierarchy::IsProcessedBefore(uint32_t index, uint32_t otherIndex) const
+{
+    const uint32_t sortedCount = GetSortedCount();
+
+    if (otherIndex >= sortedCount)
+    {
+        return index < otherIndex;
+    }
+
+    if (index >= sortedCount)
+    {
+        return false;
+    }
+
+    return std::ranges::upper_bound(levels, index) < std::ranges::upper_bound(levels, otherIndex);
+}
+
+void TransformHierarchy::MarkModified(uint32_t index)
+{
+    dirty[index] = 1;
+
+    modified = true;
+}
+
+void TransformHierarchy::Sort()
+{
+    EASY_FUNCTION()
+
+    const size_t count = entities.size();
+
+    const auto isRoot = [&](size_t i)
+        {
+            return parents[i] == kInvalidIndex || entities[parents[i]] == entt::null;
+        };
+
+    // Children of every entity in one array, childOffsets[i] is where the children of entity i begin
+    std::vector<uint32_t> childOffsets(count + 1, 0);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (entities[i] != entt::null && !isRoot(i))
+        {
+            ++childOffsets[parents[i] + 1];
+        }
+    }
+
+    std::partial_sum(childOffsets.begin(), childOffsets.end(), childOffsets.begin());
+
+    std::vector<uint32_t> children(childOffsets.back());
+    std::vector<uint32_t> childEnds(childOffsets.begin(), childOffsets.end() - 1);
+
+    std::vector<uint32_t> order;
+    order.reserve(count - removedCount);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (entities[i] == entt::null)
+        {
+            continue;
+        }
+
+        if (isRoot(i))
+        {
+            order.push_back(static_cast<uint32_t>(i));
+        }
+        else
+        {
+            children[childEnds[parents[i]]++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    levels.clear();
+
+    size_t levelBegin = 0;
+
+    while (levelBegin < order.size())
+    {
+        levels.push_back(static_cast<uint32_t>(levelBegin));
+
+        const size_t levelEnd = order.size();
+
+        for (size_t i = levelBegin; i < levelEnd; ++i)
+        {
+            const auto childrenBegin = children.begin() + childOffsets[order[i]];
+            const auto childrenEnd = children.begin() + childOffsets[order[i] + 1];
+
+            order.insert(order.end(), childrenBegin, childrenEnd);
+        }
+
+        levelBegin = levelEnd;
+    }
+
+    levels.push_back(static_cast<uint32_t>(order.size()));
+
+    Assert(order.size() == count - removedCount);
+
+    std::vector<uint32_t> newIndices(count, kInvalidIndex);
+
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        newIndices[order[i]] = static_cast<uint32_t>(i);
+    }
+
+    for (uint32_t& parent : parents)
+    {
+        parent = parent != kInvalidIndex ? newIndices[parent] : kInvalidIndex;
+    }
+
+    Details::Reorder(entities, order);
+    Details::Reorder(parents, order);
+    Details::Reorder(translations, order);
+    Details::Reorder(rotations, order);
+    Details::Reorder(scales, order);
+    Details::Reorder(worldMatrices, order);
+    Details::Reorder(dirty, order);
+
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        indices[static_cast<size_t>(entt::to_entity(entities[i]))] = static_cast<uint32_t>(i);
+    }
+
+    removedCount = 0;
+
+    sorted = true;
+}
+
+void TransformHierarchy::PropagateDirty()
+{
+    EASY_FUNCTION()
+
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        if (parents[i] != kInvalidIndex && dirty[parents[i]])
+        {
+            dirty[i] = 1;
+        }
+    }
+}
+
+void TransformHierarchy::ComputeWorldMatrices(ThreadPool* threadPool)
+{
+    EASY_FUNCTION()
+
+    const auto computeRange = [this](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (!dirty[i])
+                {
+                    continue;
+                }
+
+                const glm::mat4 localMatrix = Details::ComposeMatrix(translations[i], rotations[i], scales[i]);
+
+                if (parents[i] == kInvalidIndex)
+                {
+                    worldMatrices[i] = localMatrix;
+                }
+                else
+                {
+                    worldMatrices[i] = Details::Multiply(worldMatrices[parents[i]], localMatrix);
+                }
+            }
+        };
+
+    for (size_t level = 0; level + 1 < levels.size(); ++level)
+    {
+        const size_t offset = levels[level];
+        const size_t count = levels[level + 1] - offset;
+
+        ThreadPool::ForEachBlock(threadPool, count, Details::kBlockSize, [&](size_t begin, size_t end)
+            {
+                computeRange(offset + begin, offset + end);
+            });
+    }
+
+    computeRange(GetSortedCount(), entities.size());
+}
+
+void TransformHierarchy::StoreWorldTransforms(const Scene& scene, ThreadPool* threadPool)
+{
+    EASY_FUNCTION()
+
+    ThreadPool::ForEachBlock(threadPool, entities.size(), Details::kBlockSize, [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (dirty[i])
+                {
+                    scene.get<TransformComponent>(entities[i]).worldTransform = Transform(worldMatrices[i]);
+
+                    dirty[i] = 0;
+                }
+            }
+        });
+}
@@ -0,0 +1,99 @@
+#include <glm/gtc/packing.hpp>
+
+#include "Engine/Scene/VertexQuantization.hpp"
+
+namespace Details
+{
+    static glm::vec2 EncodeOctahedral(const glm::vec3& direction)
+    {
+        const glm::vec3 v = direction / (std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z));
+
+        if (v.z >= 0.0f)
+        {
+            return glm::vec2(v.x, v.y);
+        }
+
+        return glm::vec2(
+                (1.0f - std::abs(v.y)) * (v.x >= 0.0f ? 1.0f : -1.0f),
+                (1.0f - std::abs(v.x)) * (v.y >= 0.0f ? 1.0f : -1.0f));
+    }
+
+    // Same as DecodeOctahedral in Common.glsl
+    static glm::vec3 DecodeOctahedral(const glm::vec2& e)
+    {
+        glm::vec3 v(e, 1.0f - std::abs(e.x) - std::abs(e.y));
+
+        const float t = std::max(-v.z, 0.0f);
+
+        v.x += v.x >= 0.0f ? -t : t;
+        v.y += v.y >= 0.0f ? -t : t;
+
+        return glm::normalize(v);
+    }
+}
+
+float VertexQuantization::GetPositionScale(const AABBox& bbox)
+{
+    return std::max(bbox.GetLongestEdge(), std::numeric_limits<float>::min());
+}
+
+std::vector<uint64_t> VertexQuantization::QuantizePositions(
+        const DataView<glm::vec3>& positions, const AABBox& bbox)
+{
+    EASY_FUNCTION()
+
+    const glm::vec3& origin = bbox.GetMin();
+    const float scale = 1.0f / GetPositionScale(bbox);
+
+    std::vector<uint64_t> result(positions.size);
+
+    for (size_t i = 0; i < positions.size; ++i)
+    {
+        result[i] = glm::packUnorm4x16(glm::vec4((positions[i] - origin) * scale, 0.0f));
+    }
+
+    return result;
+}
+
+std::vector<uint32_t> VertexQuantization::QuantizeDirections(const DataView<glm::vec3>& directions)
+{
+    EASY_FUNCTION()
+
+    std::vector<uint32_t> result(directions.size);
+
+    for (size_t i = 0; i < directions.size; ++i)
+    {
+        result[i] = glm::packSnorm2x16(Details::EncodeOctahedral(directions[i]));
+    }
+
+    return result;
+}
+
+std::vector<uint32_t> VertexQuantization::QuantizeTexCoords(const DataView<glm::vec2>& texCoords)
+{
+    EASY_FUNCTION()
+
+    std::vector<uint32_t> result(texCoords.size);
+
+    for (size_t i = 0; i < texCoords.size; ++i)
+    {
+        result[i] = glm::packHalf2x16(texCoords[i]);
+    }
+
+    return result;
+}
+
+glm::vec3 VertexQuantization::DecodePosition(uint64_t position, const AABBox& bbox)
+{
+    return glm::vec3(glm::unpackUnorm4x16(position)) * GetPositionScale(bbox) + bbox.GetMin();
+}
+
+glm::vec3 VertexQuantization::DecodeDirection(uint32_t direction)
+{
+    return Details::DecodeOctahedral(glm::unpackSnorm2x16(direction));
+}
+
+glm::vec2 VertexQuantization::DecodeTexCoord(uint32_t texCoord)
+{
+    return glm::unpackHalf2x16(texCoord);
+}
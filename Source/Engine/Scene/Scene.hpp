@@ -2,10 +2,14 @@
 
 #include <entt/entity/registry.hpp>
 
+#include "Engine/Scene/Components/HierarchyComponent.hpp"
 #include "Engine/Scene/SceneHelpers.hpp"
 #include "Engine/Filesystem/Filepath.hpp"
 
+#include "Utils/Assert.hpp"
+
 class Transform;
+class TransformHierarchy;
 
 class Scene : public entt::registry
 {
@@ -15,14 +19,23 @@ public:
 
     ~Scene();
 
-    void EnumerateDescendants(entt::entity entity, const SceneEntityFunc& func) const;
+    // Depth-first pre-order, func must not change the hierarchy
+    // Scans the range of descendants in the storage if the hierarchy is sorted, follows the links otherwise
+    template <class TFunc>
+    void EnumerateDescendants(entt::entity entity, const TFunc& func) const;
 
-    void EnumerateAncestors(entt::entity entity, const SceneEntityFunc& func) const;
+    template <class TFunc>
+    void EnumerateAncestors(entt::entity entity, const TFunc& func) const;
 
     void EnumerateRenderView(const SceneRenderFunc& func) const; // TODO start using
 
+    // Returns the entity that got the name first if there are several
     entt::entity FindEntity(const std::string& name) const;
 
+    // Visits the entities in the order in which they got the name
+    template <class TFunc>
+    void EnumerateNamedEntities(const std::string& name, const TFunc& func) const;
+
     entt::entity CreateEntity(entt::entity parent, const Transform& transform);
 
     entt::entity CloneEntity(entt::entity entity, const Transform& transform);
@@ -41,5 +54,120 @@ public:
 
     std::unique_ptr<Scene> EraseScenePrefab(entt::entity scene);
 
+    TransformHierarchy& GetTransformHierarchy() const { return *transformHierarchy; }
+
+    // Called on creation, removal and reparenting of entities
+    void InvalidateHierarchy();
+
+    // Lays out hierarchy components depth-first if the hierarchy changed since the last call
+    void SortHierarchy();
+
 private:
+    using NameIndex = std::unordered_map<std::string, std::vector<entt::entity>>;
+
+    std::unique_ptr<TransformHierarchy> transformHierarchy;
+
+    bool hierarchySorted = true;
+
+    // Kept in sync with NameComponent through the registry signals
+    NameIndex nameIndex;
+
+    // Key of the index entry of every named entity, node keys don't move when the index grows
+    std::unordered_map<entt::entity, const std::string*> indexedNames;
+
+    template <class TFunc>
+    void EnumerateLinkedDescendants(entt::entity entity, const TFunc& func) const;
+
+    void ConnectSignals();
+
+    void AddName(entt::registry& registry, entt::entity entity);
+
+    void RemoveName(entt::registry& registry, entt::entity entity);
+
+    void UpdateName(entt::registry& registry, entt::entity entity);
+
+    void RemoveTransform(entt::registry& registry, entt::entity entity);
 };
+
+template <class TFunc>
+void Scene::EnumerateDescendants(entt::entity entity, const TFunc& func) const
+{
+    if (entity == entt::null)
+    {
+        each(func);
+
+        return;
+    }
+
+    if (!hierarchySorted)
+    {
+        EnumerateLinkedDescendants(entity, func);
+
+        return;
+    }
+
+    const auto hierarchyView = view<HierarchyComponent>();
+
+    auto it = hierarchyView.find(entity);
+
+    for (uint32_t i = 0; i < get<HierarchyComponent>(entity).descendantCount; ++i)
+    {
+        func(*++it);
+    }
+}
+
+template <class TFunc>
+void Scene::EnumerateLinkedDescendants(entt::entity entity, const TFunc& func) const
+{
+    entt::entity current = get<HierarchyComponent>(entity).GetFirstChild();
+
+    while (current != entt::null)
+    {
+        func(current);
+
+        const auto& hc = get<HierarchyComponent>(current);
+
+        if (hc.GetFirstChild() != entt::null)
+        {
+            current = hc.GetFirstChild();
+
+            continue;
+        }
+
+        while (current != entity && get<HierarchyComponent>(current).GetNextSibling() == entt::null)
+        {
+            current = get<HierarchyComponent>(current).GetParent();
+        }
+
+        current = current != entity ? get<HierarchyComponent>(current).GetNextSibling() : entt::null;
+    }
+}
+
+template <class TFunc>
+void Scene::EnumerateNamedEntities(const std::string& name, const TFunc& func) const
+{
+    const auto it = nameIndex.find(name);
+
+    if (it != nameIndex.end())
+    {
+        for (const entt::entity entity : it->second)
+        {
+            func(entity);
+        }
+    }
+}
+
+template <class TFunc>
+void Scene::EnumerateAncestors(entt::entity entity, const TFunc& func) const
+{
+    Assert(entity != entt::null);
+
+    entt::entity parent = get<HierarchyComponent>(entity).GetParent();
+
+    while (parent != entt::null)
+    {
+        func(parent);
+
+        parent = get<HierarchyComponent>(parent).GetParent();
+    }
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+class Filepath;
+
+namespace SceneCooker
+{
+    // Converts a glTF scene into a CookedScene blob, image paths are stored relative to the blob
+    bool Cook(const Filepath& scenePath, const Filepath& cookedPath);
+}
@@ -4,7 +4,6 @@
 #include "Utils/Helpers.hpp"
 
 class Scene;
-class TransformComponent;
 class Transform;
 struct RenderObject;
 
@@ -18,8 +17,6 @@ struct StorageRange
     Range primitives;
 };
 
-using SceneEntityFunc = std::function<void(entt::entity)>;
-
 using SceneRenderFunc = std::function<void(const Transform&, const RenderObject&)>;
 
 namespace SceneHelpers
@@ -37,5 +34,5 @@ namespace SceneHelpers
     void SplitStorageComponents(Scene& srcScene, Scene& dstScene, const StorageRange& range);
 
     vk::AccelerationStructureInstanceKHR GetTlasInstance(
-            const Scene& scene, const TransformComponent& tc, const RenderObject& ro);
+            const Scene& scene, const glm::mat4& transform, const RenderObject& ro);
 }
@@ -2,12 +2,19 @@
 
 #include "Engine/Filesystem/Filepath.hpp"
 
+#include "Utils/DataHelpers.hpp"
+
 class Scene;
+class ThreadPool;
+struct GltfBuffers;
+struct CameraLocation;
+struct CameraProjection;
 
 namespace tinygltf
 {
     class Model;
     class Node;
+    struct Mesh;
 }
 
 class SceneLoader
@@ -20,25 +27,45 @@ public:
 private:
     Scene& scene;
 
+    Filepath scenePath;
     Filepath sceneDirectory;
 
     std::unique_ptr<tinygltf::Model> model;
 
-    void LoadModel(const Filepath& path) const;
+    std::unique_ptr<GltfBuffers> buffers;
+
+    std::unique_ptr<ThreadPool> threadPool;
+
+    void LoadGltfScene();
+
+    // Returns false without touching the scene if the blob is missing or doesn't match the format
+    bool LoadCookedScene() const;
 
     void AddTextureStorageComponent() const;
 
+    void AddTextureStorageComponent(const ByteView& cookedData) const;
+
     void AddMaterialStorageComponent() const;
 
-    void AddGeometryStorageComponent() const;
+    void AddMaterialStorageComponent(const ByteView& cookedData) const;
+
+    // Returns the storage index of every glTF primitive, duplicates share one
+    std::vector<uint32_t> AddGeometryStorageComponent() const;
+
+    void AddGeometryStorageComponent(const ByteView& cookedData) const;
+
+    void AddEntities(const std::vector<uint32_t>& primitiveIndices) const;
 
-    void AddEntities() const;
+    void AddEntities(const ByteView& cookedData) const;
 
-    void AddRenderComponent(entt::entity entity, const tinygltf::Node& node) const;
+    void AddRenderComponent(entt::entity entity,
+            const tinygltf::Mesh& mesh, const DataView<uint32_t>& primitiveIndices) const;
 
-    void AddCameraComponent(entt::entity entity, const tinygltf::Node& node) const;
+    void AddCameraComponent(entt::entity entity,
+            const CameraLocation& location, const CameraProjection& projection) const;
 
-    void AddLightComponent(entt::entity entity, const tinygltf::Node& node) const;
+    void AddEnvironmentComponent(entt::entity entity, const Filepath& panoramaPath) const;
 
-    void AddEnvironmentComponent(entt::entity entity, const tinygltf::Node& node) const;
+    void AddSceneReferences(entt::entity entity, const std::string& scenePrefab,
+            entt::entity sceneInstance, entt::entity sceneSpawn) const;
 };
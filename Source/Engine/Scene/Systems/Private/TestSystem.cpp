@@ -7,20 +7,8 @@
 
 void TestSystem::Process(Scene& scene, float)
 {
-    entt::entity spawn = entt::null;
-    entt::entity helmet = entt::null;
-
-    for (auto&& [entity, nc] : scene.view<NameComponent>().each())
-    {
-        if (nc.name == "damaged_helmet_spawn")
-        {
-            spawn = entity;
-        }
-        if (nc.name == "damaged_helmet")
-        {
-            helmet = entity;
-        }
-    }
+    const entt::entity spawn = scene.FindEntity("damaged_helmet_spawn");
+    const entt::entity helmet = scene.FindEntity("damaged_helmet");
 
     if (spawn != entt::null && helmet != entt::null)
     {
@@ -0,0 +1,21 @@
+#include "Engine/Scene/Systems/TransformSystem.hpp"
+
+#include "Engine/Scene/Scene.hpp"
+#include "Engine/Scene/TransformHierarchy.hpp"
+
+#include "Utils/ThreadPool.hpp"
+
+TransformSystem::TransformSystem()
+    : threadPool(std::make_unique<ThreadPool>())
+{}
+
+TransformSystem::~TransformSystem() = default;
+
+void TransformSystem::Process(Scene& scene, float)
+{
+    EASY_FUNCTION()
+
+    scene.SortHierarchy();
+
+    scene.GetTransformHierarchy().Update(scene, threadPool.get());
+}
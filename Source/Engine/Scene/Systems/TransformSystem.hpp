@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Engine/Scene/Systems/System.hpp"
+
+class Scene;
+class ThreadPool;
+
+// Brings world transforms up to date after the other systems have modified local ones
+// and restores the depth-first layout of the hierarchy after structural changes
+class TransformSystem
+        : public System
+{
+public:
+    TransformSystem();
+    ~TransformSystem() override;
+
+    void Process(Scene& scene, float deltaSeconds) override;
+
+private:
+    std::unique_ptr<ThreadPool> threadPool;
+};
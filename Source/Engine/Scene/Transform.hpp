@@ -4,6 +4,8 @@
 
 class Scene;
 
+// Stores translation, rotation and scale, the matrix is composed on the first access after a change
+// Transforms created from a matrix keep it as is, it's decomposed once on the first access to rotation or scale
 class Transform
 {
 public:
@@ -12,9 +14,9 @@ public:
     Transform() = default;
 
     explicit Transform(const glm::mat4& matrix_);
-    explicit Transform(const glm::vec3& translation);
-    explicit Transform(const glm::vec3& translation,
-            const glm::quat& rotation, const glm::vec3& scale);
+    explicit Transform(const glm::vec3& translation_);
+    explicit Transform(const glm::vec3& translation_,
+            const glm::quat& rotation_, const glm::vec3& scale_);
 
     const glm::mat4& GetMatrix() const;
 
@@ -30,16 +32,27 @@ public:
 
     Transform GetInverse() const;
 
-    void SetTranslation(const glm::vec3& translation);
+    void SetTranslation(const glm::vec3& translation_);
 
-    void SetRotation(const glm::quat& rotation);
+    void SetRotation(const glm::quat& rotation_);
 
-    void SetScale(const glm::vec3& scale);
+    void SetScale(const glm::vec3& scale_);
 
     void operator*=(const Transform& other);
 
 private:
-    glm::mat4 matrix = Matrix4::kIdentity;
+    mutable glm::vec3 translation = Vector3::kZero;
+    mutable glm::quat rotation = Quat::kIdentity;
+    mutable glm::vec3 scale = Vector3::kUnit;
+
+    mutable glm::mat4 matrix = Matrix4::kIdentity;
+
+    mutable bool matrixValid = true;
+    mutable bool trsValid = true;
+
+    void ComposeMatrix() const;
+
+    void DecomposeMatrix() const;
 };
 
 Transform operator*(const Transform& a, const Transform& b);
@@ -0,0 +1,80 @@
+#pragma once
+
+class Scene;
+class ThreadPool;
+class Transform;
+
+// Owns the local transforms of the scene in SoA storage sorted by hierarchy depth and computes world transforms
+// level by level, the storage is extended in place on entity creation and reordered on the next update
+// after removal or reparenting. Only TransformSystem is expected to update it, once per frame
+class TransformHierarchy
+{
+public:
+    // Entities are appended as leaves, their world transform is computed right away from the parent's one
+    glm::mat4 Add(entt::entity entity, entt::entity parent, const Transform& localTransform);
+
+    void Remove(entt::entity entity);
+
+    void Reparent(entt::entity entity, entt::entity parent);
+
+    Transform GetLocalTransform(entt::entity entity) const;
+
+    void SetLocalTransform(entt::entity entity, const Transform& transform);
+
+    void SetLocalTranslation(entt::entity entity, const glm::vec3& translation);
+
+    void SetLocalRotation(entt::entity entity, const glm::quat& rotation);
+
+    void SetLocalScale(entt::entity entity, const glm::vec3& scale);
+
+    // Levels are split between the threads of threadPool when provided, the result doesn't depend on it
+    void Update(const Scene& scene, ThreadPool* threadPool = nullptr);
+
+private:
+    static constexpr uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
+
+    std::vector<entt::entity> entities;
+
+    // Index of the parent in entities, parents always precede their children
+    std::vector<uint32_t> parents;
+
+    std::vector<glm::vec3> translations;
+    std::vector<glm::quat> rotations;
+    std::vector<glm::vec3> scales;
+
+    std::vector<glm::mat4> worldMatrices;
+
+    // Set for modified entities, the update extends it to their descendants and clears it afterwards
+    std::vector<uint8_t> dirty;
+
+    // Offset of every depth level in entities followed by the end of the sorted range
+    // Entities appended since the last sort follow that range and are processed serially
+    std::vector<uint32_t> levels;
+
+    // Position in entities, indexed by the entity index
+    std::vector<uint32_t> indices;
+
+    size_t removedCount = 0;
+
+    bool sorted = true;
+    bool modified = false;
+
+    uint32_t GetIndex(entt::entity entity) const;
+
+    uint32_t GetSortedCount() const { return levels.empty() ? 0 : levels.back(); }
+
+    // Parents have to be in an earlier level, or earlier in the appended range
+    bool IsProcessedBefore(uint32_t index, uint32_t otherIndex) const;
+
+    void MarkModified(uint32_t index);
+
+    // Drops removed entities and restores the depth order, the data of every entity moves along with it
+    void Sort();
+
+    // Single linear pass, an entity is dirty if it was modified or its parent is dirty
+    void PropagateDirty();
+
+    void ComputeWorldMatrices(ThreadPool* threadPool);
+
+    void StoreWorldTransforms(const Scene& scene, ThreadPool* threadPool);
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Utils/AABBox.hpp"
+#include "Utils/DataHelpers.hpp"
+
+// Compact vertex encodings used when Config::kQuantizedVertices is set
+// Decode functions mirror the shaders, so the precision can be checked without a device
+namespace VertexQuantization
+{
+    // Positions are relative to the bbox min and scaled uniformly by the longest edge
+    float GetPositionScale(const AABBox& bbox);
+
+    // 16-bit unorm positions, the fourth component is zero
+    std::vector<uint64_t> QuantizePositions(const DataView<glm::vec3>& positions, const AABBox& bbox);
+
+    // Octahedral mapping of unit vectors packed to 2x16-bit snorm
+    std::vector<uint32_t> QuantizeDirections(const DataView<glm::vec3>& directions);
+
+    // Half precision floats
+    std::vector<uint32_t> QuantizeTexCoords(const DataView<glm::vec2>& texCoords);
+
+    glm::vec3 DecodePosition(uint64_t position, const AABBox& bbox);
+
+    glm::vec3 DecodeDirection(uint32_t direction);
+
+    glm::vec2 DecodeTexCoord(uint32_t texCoord);
+}
@@ -30,6 +30,17 @@ vec3 BaryLerp(vec3 a, vec3 b, vec3 c, vec3 d, vec4 baryCoord)
     return a * baryCoord.x + b * baryCoord.y + c * baryCoord.z + d * baryCoord.w;
 }
 
+vec3 DecodeOctahedral(vec2 e)
+{
+    vec3 v = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+
+    const float t = max(-v.z, 0.0);
+    v.x += v.x >= 0.0 ? -t : t;
+    v.y += v.y >= 0.0 ? -t : t;
+
+    return normalize(v);
+}
+
 mat3 GetTBN(vec3 N, vec3 T)
 {
     T = normalize(T - dot(T, N) * N);
@@ -6,6 +6,11 @@
 #define MAX_TEXTURE_COUNT 1024
 #define MAX_PRIMITIVE_COUNT 2048
 
+// Instance custom index: primitive in bits 0-14, 16-bit indices flag in bit 15, material in bits 16-23
+#define INSTANCE_PRIMITIVE_MASK 0x7FFF
+#define INSTANCE_INDEX16_BIT 0x8000
+#define INSTANCE_MATERIAL_SHIFT 16
+
 #define TET_VERTEX_COUNT 4
 #define SH_COEFFICIENT_COUNT 9
 
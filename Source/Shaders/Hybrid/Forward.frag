@@ -13,6 +13,7 @@
 
 #define RAY_TRACING_ENABLED 1
 #define LIGHT_VOLUME_ENABLED 1
+#define QUANTIZED_VERTICES 0
 
 #include "Common/Common.h"
 #include "Common/Common.glsl"
@@ -8,23 +8,51 @@
 
 #define DEPTH_ONLY 0
 #define NORMAL_MAPPING 0
+#define QUANTIZED_VERTICES 0
 
 #include "Hybrid/Forward.layout"
 
+#include "Common/Common.glsl"
+
+#if !DEPTH_ONLY
+    vec3 GetNormal()
+    {
+        #if QUANTIZED_VERTICES
+            return DecodeOctahedral(inNormal);
+        #else
+            return inNormal;
+        #endif
+    }
+
+    vec3 GetTangent()
+    {
+        #if QUANTIZED_VERTICES
+            return DecodeOctahedral(inTangent);
+        #else
+            return inTangent;
+        #endif
+    }
+#endif
+
 void main() 
 {
-    const vec4 worldPosition = transform * vec4(inPosition, 1.0);
+    const mat4 worldTransform = transform * mat4(transpose(inInstanceTransform));
+
+    // Quantized positions are relative to the primitive bbox, the transform is identity otherwise
+    const vec3 position = inPosition * positionTransform.w + positionTransform.xyz;
+
+    const vec4 worldPosition = worldTransform * vec4(position, 1.0);
 
     #if !DEPTH_ONLY
         // TODO: move to CPU
-        const mat4 normalTransform = transpose(inverse(transform));
+        const mat4 normalTransform = transpose(inverse(worldTransform));
 
         outPosition = worldPosition.xyz;
-        outNormal = normalize(vec3(normalTransform * vec4(inNormal, 0.0)));
+        outNormal = normalize(vec3(normalTransform * vec4(GetNormal(), 0.0)));
         outTexCoord = inTexCoord;
         
         #if NORMAL_MAPPING
-            outTangent = normalize(vec3(normalTransform * vec4(inTangent, 0.0)));
+            outTangent = normalize(vec3(normalTransform * vec4(GetTangent(), 0.0)));
         #endif
     #endif
 
@@ -24,14 +24,40 @@
 #endif
 
 #if RAY_TRACING_ENABLED
-    uvec3 GetIndices(uint instanceId, uint primitiveId)
+    uvec3 GetIndices(uint customIndex, uint primitiveId)
     {
-        return indexBuffers[nonuniformEXT(instanceId)].indices[primitiveId];
+        const uint instanceId = customIndex & INSTANCE_PRIMITIVE_MASK;
+        const uint firstIndex = primitiveId * 3;
+
+        uvec3 indices;
+
+        if ((customIndex & INSTANCE_INDEX16_BIT) != 0)
+        {
+            for (uint i = 0; i < 3; ++i)
+            {
+                const uint word = indexBuffers[nonuniformEXT(instanceId)].indices[(firstIndex + i) / 2];
+
+                indices[i] = bitfieldExtract(word, int((firstIndex + i) % 2) * 16, 16);
+            }
+        }
+        else
+        {
+            for (uint i = 0; i < 3; ++i)
+            {
+                indices[i] = indexBuffers[nonuniformEXT(instanceId)].indices[firstIndex + i];
+            }
+        }
+
+        return indices;
     }
 
     vec2 GetTexCoord(uint instanceId, uint i)
     {
-        return texCoordBuffers[nonuniformEXT(instanceId)].texCoords[i];
+        #if QUANTIZED_VERTICES
+            return unpackHalf2x16(texCoordBuffers[nonuniformEXT(instanceId)].texCoords[i]);
+        #else
+            return texCoordBuffers[nonuniformEXT(instanceId)].texCoords[i];
+        #endif
     }
 
     float TraceRay(Ray ray)
@@ -51,10 +77,10 @@
                 const uint primitiveId = rayQueryGetIntersectionPrimitiveIndexEXT(rayQuery, false);
                 const vec2 hitCoord = rayQueryGetIntersectionBarycentricsEXT(rayQuery, false);
 
-                const uint instanceId = customIndex & 0x0000FFFF;
-                const uint materialId = customIndex >> 16;
+                const uint instanceId = customIndex & INSTANCE_PRIMITIVE_MASK;
+                const uint materialId = customIndex >> INSTANCE_MATERIAL_SHIFT;
 
-                const uvec3 indices = GetIndices(instanceId, primitiveId);
+                const uvec3 indices = GetIndices(customIndex, primitiveId);
 
                 const vec2 texCoord0 = GetTexCoord(instanceId, indices[0]);
                 const vec2 texCoord1 = GetTexCoord(instanceId, indices[1]);
@@ -0,0 +1,406 @@
+PRAGMA_DISABLE_WARNINGS
+#include <tiny_gltf.h>
+#include <gtest/gtest.h>
+PRAGMA_ENABLE_WARNINGS
+
+#include <fstream>
+#include <numeric>
+#include <sstream>
+
+#include "Engine/Filesystem/Filepath.hpp"
+#include "Engine/Scene/GltfHelpers.hpp"
+#include "Engine/Scene/GltfParser.hpp"
+#include "Engine/Scene/MeshData.hpp"
+
+namespace Details
+{
+    static constexpr uint32_t kVertexCount = 64;
+
+    // Every attribute is interleaved with padding so the strided gather is exercised
+    static constexpr size_t kStridePadding = 4;
+
+    static constexpr size_t kBufferViewSize = 16 * 1024 * 1024;
+
+    static constexpr size_t kBufferViewCount = 4;
+
+    static constexpr size_t kIterationCount = 5;
+
+    template <class T>
+    static constexpr int32_t GetComponentType()
+    {
+        if constexpr (std::is_same_v<T, int8_t>)
+        {
+            return TINYGLTF_COMPONENT_TYPE_BYTE;
+        }
+        else if constexpr (std::is_same_v<T, uint8_t>)
+        {
+            return TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE;
+        }
+        else if constexpr (std::is_same_v<T, int16_t>)
+        {
+            return TINYGLTF_COMPONENT_TYPE_SHORT;
+        }
+        else if constexpr (std::is_same_v<T, uint16_t>)
+        {
+            return TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT;
+        }
+        else
+        {
+            static_assert(std::is_same_v<T, float>);
+            return TINYGLTF_COMPONENT_TYPE_FLOAT;
+        }
+    }
+
+    // Spec conversion of KHR_mesh_quantization: c / max for normalized values, clamped to -1 for signed ones
+    template <class T>
+    static float Dequantize(T value, bool normalized)
+    {
+        if constexpr (std::is_integral_v<T>)
+        {
+            if (normalized)
+            {
+                return std::max(static_cast<float>(value) / static_cast<float>(std::numeric_limits<T>::max()), -1.0f);
+            }
+        }
+
+        return static_cast<float>(value);
+    }
+
+    // Covers the whole range of T, the first two vertices hold the extremes
+    template <class T>
+    static T GetComponent(uint32_t vertex, uint32_t component)
+    {
+        if constexpr (std::is_integral_v<T>)
+        {
+            if (vertex < 2)
+            {
+                return vertex == 0 ? std::numeric_limits<T>::lowest() : std::numeric_limits<T>::max();
+            }
+
+            const int64_t lowest = std::numeric_limits<T>::lowest();
+            const int64_t range = static_cast<int64_t>(std::numeric_limits<T>::max()) - lowest + 1;
+
+            return static_cast<T>(lowest + (vertex * 7919 + component * 104729) % range);
+        }
+        else
+        {
+            return static_cast<float>(vertex * 3 + component) * 0.25f - 8.0f;
+        }
+    }
+
+    // Positions stay unique per vertex, so welding keeps every vertex and they can be matched after reordering
+    template <class T>
+    static T GetPositionComponent(uint32_t vertex, uint32_t component)
+    {
+        const int64_t base = std::is_signed_v<T> ? -static_cast<int64_t>(kVertexCount) / 2 : 0;
+
+        return static_cast<T>(base + (vertex * (2 * component + 1)) % kVertexCount);
+    }
+
+    template <class T>
+    using ComponentFunc = T(*)(uint32_t vertex, uint32_t component);
+
+    template <class T>
+    static int32_t AddAccessor(tinygltf::Model& model, int32_t type, bool normalized, ComponentFunc<T> func)
+    {
+        const uint32_t componentCount = static_cast<uint32_t>(tinygltf::GetNumComponentsInType(type));
+
+        const size_t valueSize = componentCount * sizeof(T);
+        const size_t stride = (valueSize + 3) / 4 * 4 + kStridePadding;
+
+        tinygltf::Buffer& buffer = model.buffers.front();
+
+        tinygltf::BufferView bufferView;
+        bufferView.buffer = 0;
+        bufferView.byteOffset = buffer.data.size();
+        bufferView.byteLength = stride * kVertexCount;
+        bufferView.byteStride = stride;
+
+        buffer.data.resize(buffer.data.size() + bufferView.byteLength, 0xCD);
+
+        for (uint32_t i = 0; i < kVertexCount; ++i)
+        {
+            for (uint32_t j = 0; j < componentCount; ++j)
+            {
+                const T value = func(i, j);
+
+                std::memcpy(buffer.data.data() + bufferView.byteOffset + i * stride + j * sizeof(T), &value, sizeof(T));
+            }
+        }
+
+        tinygltf::Accessor accessor;
+        accessor.bufferView = static_cast<int32_t>(model.bufferViews.size());
+        accessor.componentType = GetComponentType<T>();
+        accessor.normalized = normalized;
+        accessor.count = kVertexCount;
+        accessor.type = type;
+
+        model.bufferViews.push_back(bufferView);
+        model.accessors.push_back(accessor);
+
+        return static_cast<int32_t>(model.accessors.size() - 1);
+    }
+
+    // Triangle strip as a list, so every vertex is referenced
+    static int32_t AddIndices(tinygltf::Model& model)
+    {
+        std::vector<uint16_t> indices;
+
+        for (uint16_t i = 0; i + 2 < kVertexCount; ++i)
+        {
+            indices.insert(indices.end(), { i, static_cast<uint16_t>(i + 1), static_cast<uint16_t>(i + 2) });
+        }
+
+        tinygltf::Buffer& buffer = model.buffers.front();
+
+        tinygltf::BufferView bufferView;
+        bufferView.buffer = 0;
+        bufferView.byteOffset = buffer.data.size();
+        bufferView.byteLength = indices.size() * sizeof(uint16_t);
+
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(indices.data());
+        buffer.data.insert(buffer.data.end(), data, data + bufferView.byteLength);
+
+        tinygltf::Accessor accessor;
+        accessor.bufferView = static_cast<int32_t>(model.bufferViews.size());
+        accessor.componentType = TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT;
+        accessor.count = indices.size();
+        accessor.type = TINYGLTF_TYPE_SCALAR;
+
+        model.bufferViews.push_back(bufferView);
+        model.accessors.push_back(accessor);
+
+        return static_cast<int32_t>(model.accessors.size() - 1);
+    }
+
+    template <glm::length_t L, class T>
+    static glm::vec<L, float, glm::defaultp> GetExpected(ComponentFunc<T> func, uint32_t vertex, bool normalized)
+    {
+        glm::vec<L, float, glm::defaultp> result;
+
+        for (glm::length_t i = 0; i < L; ++i)
+        {
+            result[i] = Dequantize(func(vertex, static_cast<uint32_t>(i)), normalized);
+        }
+
+        return result;
+    }
+
+    template <glm::length_t L>
+    static void ExpectNear(const glm::vec<L, float, glm::defaultp>& a, const glm::vec<L, float, glm::defaultp>& b)
+    {
+        for (glm::length_t i = 0; i < L; ++i)
+        {
+            EXPECT_NEAR(a[i], b[i], std::abs(b[i]) * 1e-6f) << "component " << i;
+        }
+    }
+
+    // Gathers a primitive whose attributes all use T and compares every vertex with the spec conversion
+    template <class T>
+    static void TestRoundTrip(bool normalizedPositions)
+    {
+        SCOPED_TRACE(GetComponentType<T>());
+        SCOPED_TRACE(normalizedPositions);
+
+        const bool normalized = std::is_integral_v<T>;
+
+        tinygltf::Model model;
+        model.buffers.emplace_back();
+
+        tinygltf::Primitive primitive;
+        primitive.indices = AddIndices(model);
+        primitive.attributes["POSITION"] = AddAccessor<T>(model, TINYGLTF_TYPE_VEC3,
+                normalizedPositions, &GetPositionComponent<T>);
+        primitive.attributes["NORMAL"] = AddAccessor<T>(model, TINYGLTF_TYPE_VEC3, normalized, &GetComponent<T>);
+        primitive.attributes["TANGENT"] = AddAccessor<T>(model, TINYGLTF_TYPE_VEC4, normalized, &GetComponent<T>);
+        primitive.attributes["TEXCOORD_0"] = AddAccessor<T>(model, TINYGLTF_TYPE_VEC2, normalized, &GetComponent<T>);
+
+        const MeshData meshData = GltfHelpers::RetrieveMeshData(model, GltfHelpers::GetOwnedBuffers(model), primitive);
+
+        ASSERT_EQ(meshData.positions.size(), kVertexCount);
+        ASSERT_EQ(meshData.normals.size(), kVertexCount);
+        ASSERT_EQ(meshData.tangents.size(), kVertexCount);
+        ASSERT_EQ(meshData.texCoords.size(), kVertexCount);
+
+        std::vector<bool> matched(kVertexCount, false);
+
+        for (uint32_t i = 0; i < kVertexCount; ++i)
+        {
+            SCOPED_TRACE(i);
+
+            const glm::vec3 position = GetExpected<3>(&GetPositionComponent<T>, i, normalizedPositions);
+
+            const auto it = std::ranges::find_if(meshData.positions, [&](const glm::vec3& p)
+                {
+                    return glm::distance(p, position) <= glm::length(position) * 1e-6f;
+                });
+
+            ASSERT_NE(it, meshData.positions.end());
+
+            const size_t index = static_cast<size_t>(std::distance(meshData.positions.begin(), it));
+
+            EXPECT_FALSE(matched[index]);
+            matched[index] = true;
+
+            ExpectNear<3>(meshData.normals[index], GetExpected<3>(&GetComponent<T>, i, normalized));
+            ExpectNear<3>(meshData.tangents[index], GetExpected<3>(&GetComponent<T>, i, normalized));
+            ExpectNear<2>(meshData.texCoords[index], GetExpected<2>(&GetComponent<T>, i, normalized));
+        }
+    }
+
+    static std::filesystem::path GetTempPath(const std::string& filename)
+    {
+        return std::filesystem::temp_directory_path() / filename;
+    }
+
+    static std::string GetSceneJson(const std::string& bufferUri)
+    {
+        std::ostringstream stream;
+
+        stream << R"({"asset": {"version": "2.0"}, "scene": 0, "scenes": [{"nodes": [0]}], "nodes": [{}],)";
+        stream << R"("buffers": [{"byteLength": )" << kBufferViewSize * kBufferViewCount;
+
+        if (!bufferUri.empty())
+        {
+            stream << R"(, "uri": ")" << bufferUri << R"(")";
+        }
+
+        stream << R"(}], "bufferViews": [)";
+
+        for (size_t i = 0; i < kBufferViewCount; ++i)
+        {
+            stream << (i > 0 ? ", " : "") << R"({"buffer": 0, "byteOffset": )" << i * kBufferViewSize
+                    << R"(, "byteLength": )" << kBufferViewSize << "}";
+        }
+
+        stream << "]}";
+
+        return stream.str();
+    }
+
+    static Bytes GetBufferData()
+    {
+        Bytes data(kBufferViewSize * kBufferViewCount);
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i * 131 + 7);
+        }
+
+        return data;
+    }
+
+    static void WriteChunk(std::ofstream& file, uint32_t type, const uint8_t* data, size_t size, char padding)
+    {
+        const uint32_t paddedSize = static_cast<uint32_t>((size + 3) / 4 * 4);
+
+        file.write(reinterpret_cast<const char*>(&paddedSize), sizeof(uint32_t));
+        file.write(reinterpret_cast<const char*>(&type), sizeof(uint32_t));
+        file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+
+        for (size_t i = size; i < paddedSize; ++i)
+        {
+            file.put(padding);
+        }
+    }
+
+    static std::filesystem::path WriteTextScene(const Bytes& bufferData)
+    {
+        const std::filesystem::path path = GetTempPath("SteelBuffers.gltf");
+
+        std::ofstream(path, std::ios::binary) << GetSceneJson("SteelBuffers.bin");
+
+        std::ofstream(GetTempPath("SteelBuffers.bin"), std::ios::binary).write(
+                reinterpret_cast<const char*>(bufferData.data()), static_cast<std::streamsize>(bufferData.size()));
+
+        return path;
+    }
+
+    static std::filesystem::path WriteBinaryScene(const Bytes& bufferData)
+    {
+        const std::filesystem::path path = GetTempPath("SteelBuffers.glb");
+
+        const std::string json = GetSceneJson("");
+
+        const uint32_t length = static_cast<uint32_t>(12 + 8 + (json.size() + 3) / 4 * 4 + 8 + bufferData.size());
+        const uint32_t header[] = { 0x46546C67, 2, length };
+
+        std::ofstream file(path, std::ios::binary);
+
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+        WriteChunk(file, 0x4E4F534A, reinterpret_cast<const uint8_t*>(json.data()), json.size(), ' ');
+        WriteChunk(file, 0x004E4942, bufferData.data(), bufferData.size(), 0);
+
+        return path;
+    }
+
+    // Loads the scene and reads every buffer view, so both parsing and paging in of the buffer data are measured
+    static double MeasureLoad(const std::filesystem::path& path, uint64_t expectedChecksum)
+    {
+        double bestSeconds = std::numeric_limits<double>::max();
+
+        for (size_t i = 0; i < kIterationCount; ++i)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+
+            GltfBuffers buffers;
+
+            const std::unique_ptr<tinygltf::Model> model = GltfHelpers::LoadModel(Filepath(path.string()), buffers);
+
+            uint64_t checksum = 0;
+
+            for (size_t j = 0; j < model->bufferViews.size(); ++j)
+            {
+                const ByteView data = GltfHelpers::GetBufferViewData(*model, buffers, static_cast<int32_t>(j));
+
+                checksum = std::accumulate(data.data, data.data + data.size, checksum);
+            }
+
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin;
+
+            EXPECT_EQ(model->bufferViews.size(), kBufferViewCount);
+            EXPECT_EQ(checksum, expectedChecksum);
+
+            bestSeconds = std::min(bestSeconds, duration.count());
+        }
+
+        return static_cast<double>(kBufferViewSize * kBufferViewCount) / bestSeconds / (1024.0 * 1024.0 * 1024.0);
+    }
+}
+
+TEST(GltfHelpers, QuantizedAttributesRoundTrip)
+{
+    Details::TestRoundTrip<float>(false);
+
+    for (const bool normalizedPositions : { false, true })
+    {
+        Details::TestRoundTrip<int8_t>(normalizedPositions);
+        Details::TestRoundTrip<uint8_t>(normalizedPositions);
+        Details::TestRoundTrip<int16_t>(normalizedPositions);
+        Details::TestRoundTrip<uint16_t>(normalizedPositions);
+    }
+}
+
+TEST(GltfHelpers, TextAndBinaryLoadBenchmark)
+{
+    const Bytes bufferData = Details::GetBufferData();
+
+    const uint64_t checksum = std::accumulate(bufferData.begin(), bufferData.end(), uint64_t(0));
+
+    const std::filesystem::path textPath = Details::WriteTextScene(bufferData);
+    const std::filesystem::path binaryPath = Details::WriteBinaryScene(bufferData);
+
+    const double text = Details::MeasureLoad(textPath, checksum);
+    const double binary = Details::MeasureLoad(binaryPath, checksum);
+
+    std::filesystem::remove(textPath);
+    std::filesystem::remove(Details::GetTempPath("SteelBuffers.bin"));
+    std::filesystem::remove(binaryPath);
+
+    std::cout << "GltfHelpers: .gltf with external .bin loaded at " << text << " GB/s, .glb at " << binary
+            << " GB/s\n";
+
+    RecordProperty("TextMegabytesPerSecond", static_cast<int>(text * 1024.0));
+    RecordProperty("BinaryMegabytesPerSecond", static_cast<int>(binary * 1024.0));
+}
@@ -0,0 +1,324 @@
+PRAGMA_DISABLE_WARNINGS
+#include <tiny_gltf.h>
+#include <gtest/gtest.h>
+PRAGMA_ENABLE_WARNINGS
+
+#include "Engine/Filesystem/Filepath.hpp"
+#include "Engine/Filesystem/MappedFile.hpp"
+#include "Engine/Scene/GltfHelpers.hpp"
+#include "Engine/Scene/GltfParser.hpp"
+
+namespace Details
+{
+    static const Filepath kScenesDirectory("~/Assets/Scenes/");
+
+    static ByteView GetStringData(const std::string& string)
+    {
+        return ByteView(reinterpret_cast<const uint8_t*>(string.data()), string.size());
+    }
+
+    static std::vector<Filepath> GetSampleScenes()
+    {
+        std::vector<Filepath> scenes;
+
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(kScenesDirectory.GetAbsolute()))
+        {
+            const std::string extension = entry.path().extension().string();
+
+            if (extension == ".gltf" || extension == ".glb")
+            {
+                scenes.emplace_back(entry.path().string());
+            }
+        }
+
+        std::ranges::sort(scenes);
+
+        return scenes;
+    }
+
+    // Reference model without image decoding, returns false if the scene or its buffers aren't available
+    static bool LoadReferenceModel(const Filepath& path, tinygltf::Model& model)
+    {
+        tinygltf::TinyGLTF loader;
+
+        loader.SetImageLoader([](tinygltf::Image*, const int, std::string*, std::string*,
+                int, int, const unsigned char*, int, void*)
+            {
+                return true;
+            }, nullptr);
+
+        std::string error;
+        std::string warning;
+
+        if (path.GetExtension() == ".glb")
+        {
+            return loader.LoadBinaryFromFile(&model, &error, &warning, path.GetAbsolute());
+        }
+
+        return loader.LoadASCIIFromFile(&model, &error, &warning, path.GetAbsolute());
+    }
+
+    static std::set<std::string> GetKeys(const tinygltf::ExtensionMap& extensions)
+    {
+        std::set<std::string> keys;
+
+        for (const auto& [key, value] : extensions)
+        {
+            keys.insert(key);
+        }
+
+        return keys;
+    }
+
+    static void ExpectEqual(const tinygltf::Node& a, const tinygltf::Node& b)
+    {
+        EXPECT_EQ(a.name, b.name);
+        EXPECT_EQ(a.camera, b.camera);
+        EXPECT_EQ(a.mesh, b.mesh);
+        EXPECT_EQ(a.children, b.children);
+        EXPECT_EQ(a.matrix, b.matrix);
+        EXPECT_EQ(a.rotation, b.rotation);
+        EXPECT_EQ(a.scale, b.scale);
+        EXPECT_EQ(a.translation, b.translation);
+        EXPECT_EQ(GetKeys(a.extensions), GetKeys(b.extensions));
+    }
+
+    static void ExpectEqual(const tinygltf::Mesh& a, const tinygltf::Mesh& b)
+    {
+        EXPECT_EQ(a.name, b.name);
+
+        ASSERT_EQ(a.primitives.size(), b.primitives.size());
+
+        for (size_t i = 0; i < a.primitives.size(); ++i)
+        {
+            EXPECT_EQ(a.primitives[i].attributes, b.primitives[i].attributes);
+            EXPECT_EQ(a.primitives[i].indices, b.primitives[i].indices);
+            EXPECT_EQ(a.primitives[i].material, b.primitives[i].material);
+            EXPECT_EQ(a.primitives[i].mode, b.primitives[i].mode);
+        }
+    }
+
+    static void ExpectEqual(const tinygltf::Accessor& a, const tinygltf::Accessor& b)
+    {
+        EXPECT_EQ(a.name, b.name);
+        EXPECT_EQ(a.bufferView, b.bufferView);
+        EXPECT_EQ(a.byteOffset, b.byteOffset);
+        EXPECT_EQ(a.normalized, b.normalized);
+        EXPECT_EQ(a.componentType, b.componentType);
+        EXPECT_EQ(a.count, b.count);
+        EXPECT_EQ(a.type, b.type);
+    }
+
+    static void ExpectEqual(const tinygltf::BufferView& a, const tinygltf::BufferView& b)
+    {
+        EXPECT_EQ(a.name, b.name);
+        EXPECT_EQ(a.buffer, b.buffer);
+        EXPECT_EQ(a.byteOffset, b.byteOffset);
+        EXPECT_EQ(a.byteLength, b.byteLength);
+        EXPECT_EQ(a.byteStride, b.byteStride);
+        EXPECT_EQ(a.target, b.target);
+    }
+
+    static void ExpectEqual(const tinygltf::TextureInfo& a, const tinygltf::TextureInfo& b)
+    {
+        EXPECT_EQ(a.index, b.index);
+        EXPECT_EQ(a.texCoord, b.texCoord);
+    }
+
+    static void ExpectEqual(const tinygltf::Material& a, const tinygltf::Material& b)
+    {
+        EXPECT_EQ(a.name, b.name);
+        EXPECT_EQ(a.pbrMetallicRoughness.baseColorFactor, b.pbrMetallicRoughness.baseColorFactor);
+        EXPECT_EQ(a.pbrMetallicRoughness.metallicFactor, b.pbrMetallicRoughness.metallicFactor);
+        EXPECT_EQ(a.pbrMetallicRoughness.roughnessFactor, b.pbrMetallicRoughness.roughnessFactor);
+        ExpectEqual(a.pbrMetallicRoughness.baseColorTexture, b.pbrMetallicRoughness.baseColorTexture);
+        ExpectEqual(a.pbrMetallicRoughness.metallicRoughnessTexture, b.pbrMetallicRoughness.metallicRoughnessTexture);
+        EXPECT_EQ(a.normalTexture.index, b.normalTexture.index);
+        EXPECT_EQ(a.normalTexture.scale, b.normalTexture.scale);
+        EXPECT_EQ(a.occlusionTexture.index, b.occlusionTexture.index);
+        EXPECT_EQ(a.occlusionTexture.strength, b.occlusionTexture.strength);
+        ExpectEqual(a.emissiveTexture, b.emissiveTexture);
+        EXPECT_EQ(a.emissiveFactor, b.emissiveFactor);
+        EXPECT_EQ(a.alphaMode, b.alphaMode);
+        EXPECT_EQ(a.alphaCutoff, b.alphaCutoff);
+        EXPECT_EQ(a.doubleSided, b.doubleSided);
+        EXPECT_EQ(GetKeys(a.extensions), GetKeys(b.extensions));
+    }
+
+    static void ExpectEqual(const tinygltf::Texture& a, const tinygltf::Texture& b)
+    {
+        EXPECT_EQ(a.name, b.name);
+        EXPECT_EQ(a.sampler, b.sampler);
+        EXPECT_EQ(a.source, b.source);
+    }
+
+    static void ExpectEqual(const tinygltf::Image& a, const tinygltf::Image& b)
+    {
+        EXPECT_EQ(a.name, b.name);
+        EXPECT_EQ(a.uri, b.uri);
+        EXPECT_EQ(a.mimeType, b.mimeType);
+        EXPECT_EQ(a.bufferView, b.bufferView);
+    }
+
+    static void ExpectEqual(const tinygltf::Sampler& a, const tinygltf::Sampler& b)
+    {
+        EXPECT_EQ(a.name, b.name);
+        EXPECT_EQ(a.magFilter, b.magFilter);
+        EXPECT_EQ(a.minFilter, b.minFilter);
+        EXPECT_EQ(a.wrapS, b.wrapS);
+        EXPECT_EQ(a.wrapT, b.wrapT);
+    }
+
+    static void ExpectEqual(const tinygltf::Camera& a, const tinygltf::Camera& b)
+    {
+        EXPECT_EQ(a.name, b.name);
+        EXPECT_EQ(a.type, b.type);
+
+        if (a.type == "perspective")
+        {
+            EXPECT_EQ(a.perspective.aspectRatio, b.perspective.aspectRatio);
+            EXPECT_EQ(a.perspective.yfov, b.perspective.yfov);
+            EXPECT_EQ(a.perspective.zfar, b.perspective.zfar);
+            EXPECT_EQ(a.perspective.znear, b.perspective.znear);
+        }
+        else
+        {
+            EXPECT_EQ(a.orthographic.xmag, b.orthographic.xmag);
+            EXPECT_EQ(a.orthographic.ymag, b.orthographic.ymag);
+            EXPECT_EQ(a.orthographic.zfar, b.orthographic.zfar);
+            EXPECT_EQ(a.orthographic.znear, b.orthographic.znear);
+        }
+    }
+
+    static void ExpectEqual(const tinygltf::Light& a, const tinygltf::Light& b)
+    {
+        EXPECT_EQ(a.name, b.name);
+        EXPECT_EQ(a.type, b.type);
+        EXPECT_EQ(a.intensity, b.intensity);
+        EXPECT_EQ(a.range, b.range);
+    }
+
+    static void ExpectEqual(const tinygltf::Scene& a, const tinygltf::Scene& b)
+    {
+        EXPECT_EQ(a.name, b.name);
+        EXPECT_EQ(a.nodes, b.nodes);
+    }
+
+    template <class T>
+    static void ExpectEqual(const std::vector<T>& a, const std::vector<T>& b)
+    {
+        ASSERT_EQ(a.size(), b.size());
+
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            SCOPED_TRACE(i);
+
+            ExpectEqual(a[i], b[i]);
+        }
+    }
+}
+
+TEST(GltfParser, MatchesTinyGltfOnSampleScenes)
+{
+    size_t sceneCount = 0;
+
+    for (const Filepath& path : Details::GetSampleScenes())
+    {
+        SCOPED_TRACE(path.GetAbsolute());
+
+        tinygltf::Model reference;
+
+        if (!Details::LoadReferenceModel(path, reference))
+        {
+            continue;
+        }
+
+        const MappedFile file(path);
+
+        ASSERT_TRUE(file.IsValid());
+
+        tinygltf::Model model;
+        GltfBuffers buffers;
+
+        ASSERT_TRUE(GltfParser::ParseModel(file.GetData(), path.GetExtension() == ".glb",
+                Filepath(path.GetDirectory()), model, buffers));
+
+        EXPECT_EQ(model.asset.version, reference.asset.version);
+        EXPECT_EQ(model.extensionsUsed, reference.extensionsUsed);
+        EXPECT_EQ(model.extensionsRequired, reference.extensionsRequired);
+        EXPECT_EQ(model.defaultScene, reference.defaultScene);
+
+        Details::ExpectEqual(model.scenes, reference.scenes);
+        Details::ExpectEqual(model.nodes, reference.nodes);
+        Details::ExpectEqual(model.meshes, reference.meshes);
+        Details::ExpectEqual(model.accessors, reference.accessors);
+        Details::ExpectEqual(model.bufferViews, reference.bufferViews);
+        Details::ExpectEqual(model.materials, reference.materials);
+        Details::ExpectEqual(model.textures, reference.textures);
+        Details::ExpectEqual(model.images, reference.images);
+        Details::ExpectEqual(model.samplers, reference.samplers);
+        Details::ExpectEqual(model.cameras, reference.cameras);
+        Details::ExpectEqual(model.lights, reference.lights);
+
+        ASSERT_EQ(model.buffers.size(), reference.buffers.size());
+        ASSERT_EQ(buffers.views.size(), reference.buffers.size());
+
+        const GltfBuffers referenceBuffers = GltfHelpers::GetOwnedBuffers(reference);
+
+        for (size_t i = 0; i < model.bufferViews.size(); ++i)
+        {
+            const ByteView data = GltfHelpers::GetBufferViewData(model, buffers, static_cast<int32_t>(i));
+            const ByteView referenceData
+                    = GltfHelpers::GetBufferViewData(reference, referenceBuffers, static_cast<int32_t>(i));
+
+            ASSERT_EQ(data.size, referenceData.size);
+            EXPECT_EQ(std::memcmp(data.data, referenceData.data, data.size), 0) << "buffer view " << i;
+        }
+
+        ++sceneCount;
+    }
+
+    if (sceneCount == 0)
+    {
+        GTEST_SKIP() << "No sample scenes with buffers in " << Details::kScenesDirectory.GetAbsolute();
+    }
+}
+
+TEST(GltfParser, RejectsMalformedFiles)
+{
+    const std::vector<std::string> files = {
+        "",
+        "[]",
+        "{\"nodes\": [}",
+        "{\"buffers\": [{\"byteLength\": 4}]}",
+        "{\"buffers\": [{\"byteLength\": 4, \"uri\": \"data:application/octet-stream;base64,AAA\"}]}",
+        "{\"buffers\": [{\"byteLength\": 4, \"uri\": \"data:application/octet-stream;base64,AAAAAA==\"}],"
+                "\"bufferViews\": [{\"buffer\": 0, \"byteOffset\": 2, \"byteLength\": 4}]}",
+        "{\"buffers\": [{\"byteLength\": 4, \"uri\": \"missing.bin\"}]}"
+    };
+
+    for (const std::string& file : files)
+    {
+        tinygltf::Model model;
+        GltfBuffers buffers;
+
+        const bool result = GltfParser::ParseModel(Details::GetStringData(file), false,
+                Details::kScenesDirectory, model, buffers);
+
+        EXPECT_FALSE(result) << file;
+    }
+
+    const std::string valid = "{\"buffers\": [{\"byteLength\": 4,"
+            "\"uri\": \"data:application/octet-stream;base64,AQIDBA==\"}],"
+            "\"bufferViews\": [{\"buffer\": 0, \"byteOffset\": 1, \"byteLength\": 3}]}";
+
+    tinygltf::Model model;
+    GltfBuffers buffers;
+
+    ASSERT_TRUE(GltfParser::ParseModel(Details::GetStringData(valid), false,
+            Details::kScenesDirectory, model, buffers));
+
+    const ByteView data = GltfHelpers::GetBufferViewData(model, buffers, 0);
+
+    EXPECT_EQ(Bytes(data.data, data.data + data.size), Bytes({ 2, 3, 4 }));
+}
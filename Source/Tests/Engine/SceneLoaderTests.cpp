@@ -0,0 +1,174 @@
+PRAGMA_DISABLE_WARNINGS
+#include <gtest/gtest.h>
+PRAGMA_ENABLE_WARNINGS
+
+#include <fstream>
+#include <sstream>
+
+#include "Engine/Scene/Components/Components.hpp"
+#include "Engine/Scene/Scene.hpp"
+
+namespace Details
+{
+    static constexpr uint32_t kBranching = 4;
+
+    // A fifth of the nodes forms a chain deep enough to overflow a recursive traversal
+    static constexpr uint32_t kChainFraction = 5;
+
+    static constexpr uint32_t kReferenceCount = 16;
+
+    static constexpr size_t kIterationCount = 3;
+
+    // Quadratic import would grow 16 times from 25k to 100k nodes, linear one 4 times
+    static constexpr double kMaxGrowth = 8.0;
+
+    static std::filesystem::path GetTempPath(const std::string& filename)
+    {
+        return std::filesystem::temp_directory_path() / filename;
+    }
+
+    static void WriteFile(const std::filesystem::path& path, const std::string& content)
+    {
+        std::ofstream file(path, std::ios::binary);
+
+        file << content;
+    }
+
+    static std::filesystem::path WritePrefab()
+    {
+        const std::filesystem::path path = GetTempPath("SteelPrefab.gltf");
+
+        WriteFile(path, R"({"asset": {"version": "2.0"}, "scene": 0, "scenes": [{"nodes": [0]}],)"
+                R"("nodes": [{"name": "prefab_root", "translation": [0, 1, 0]}]})");
+
+        return path;
+    }
+
+    // Node 0 holds the prefab, node 1 starts a long chain that continues as a wide tree
+    // Every node is named, a few of them instantiate the prefab by name
+    static std::filesystem::path WriteNodeScene(uint32_t nodeCount, const std::filesystem::path& prefabPath)
+    {
+        const uint32_t chainLength = nodeCount / kChainFraction;
+
+        std::vector<std::vector<uint32_t>> children(nodeCount);
+
+        for (uint32_t i = 2; i < nodeCount; ++i)
+        {
+            const uint32_t parent = i <= chainLength ? i - 1 : chainLength + (i - chainLength - 1) / kBranching;
+
+            children[parent].push_back(i);
+        }
+
+        const uint32_t referenceStep = std::max(nodeCount / kReferenceCount, 2u);
+
+        std::ostringstream stream;
+
+        stream << R"({"asset": {"version": "2.0"}, "scene": 0, "scenes": [{"nodes": [0, 1]}], "nodes": [)";
+        stream << R"({"name": "prefab", "extras": {"scene_prefab": ")" << prefabPath.generic_string() << R"("}})";
+
+        for (uint32_t i = 1; i < nodeCount; ++i)
+        {
+            stream << R"(, {"name": "node_)" << i << R"(", "translation": [1, 0, 0])";
+
+            if (!children[i].empty())
+            {
+                stream << R"(, "children": [)";
+
+                for (size_t j = 0; j < children[i].size(); ++j)
+                {
+                    stream << (j > 0 ? ", " : "") << children[i][j];
+                }
+
+                stream << "]";
+            }
+
+            if (i % referenceStep == 0)
+            {
+                const char* key = (i / referenceStep) % 2 == 0 ? "scene_instance" : "scene_spawn";
+
+                stream << R"(, "extras": {")" << key << R"(": "prefab"})";
+            }
+
+            stream << "}";
+        }
+
+        stream << "]}";
+
+        const std::filesystem::path path = GetTempPath("SteelNodes" + std::to_string(nodeCount) + ".gltf");
+
+        WriteFile(path, stream.str());
+
+        return path;
+    }
+
+    static double MeasureImport(uint32_t nodeCount, const std::filesystem::path& prefabPath)
+    {
+        const std::filesystem::path path = WriteNodeScene(nodeCount, prefabPath);
+
+        double bestSeconds = std::numeric_limits<double>::max();
+
+        for (size_t i = 0; i < kIterationCount; ++i)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+
+            const Scene scene(Filepath(path.string()));
+
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin;
+
+            EXPECT_NE(scene.FindEntity("node_" + std::to_string(nodeCount - 1)), entt::null);
+            EXPECT_GE(scene.view<TransformComponent>().size(), nodeCount);
+
+            bestSeconds = std::min(bestSeconds, duration.count());
+        }
+
+        std::filesystem::remove(path);
+
+        std::cout << "SceneLoader: " << nodeCount << " nodes imported in " << bestSeconds * 1000.0 << " ms\n";
+
+        return bestSeconds;
+    }
+}
+
+TEST(SceneLoader, NodeImportScalingBenchmark)
+{
+    const std::filesystem::path prefabPath = Details::WritePrefab();
+
+    const double smallSeconds = Details::MeasureImport(25000, prefabPath);
+    const double largeSeconds = Details::MeasureImport(100000, prefabPath);
+
+    std::filesystem::remove(prefabPath);
+
+    const double growth = largeSeconds / smallSeconds;
+
+    std::cout << "SceneLoader: import time grows " << growth << " times for 4 times the nodes\n";
+
+    RecordProperty("NodesPerSecond", static_cast<int>(100000.0 / largeSeconds));
+
+    EXPECT_LT(growth, Details::kMaxGrowth);
+}
+
+TEST(SceneLoader, InvalidCookedSceneFallsBackToSource)
+{
+    const std::filesystem::path sourcePath = Details::GetTempPath("SteelFallback.gltf");
+    const std::filesystem::path cookedPath = Details::GetTempPath("SteelFallback.steel");
+
+    Details::WriteFile(cookedPath, "STEL but not a cooked scene");
+
+    {
+        const Scene scene(Filepath(cookedPath.string()));
+
+        EXPECT_TRUE(scene.view<TransformComponent>().empty());
+    }
+
+    Details::WriteFile(sourcePath, R"({"asset": {"version": "2.0"}, "scene": 0, "scenes": [{"nodes": [0]}],)"
+            R"("nodes": [{"name": "source_root"}]})");
+
+    {
+        const Scene scene(Filepath(cookedPath.string()));
+
+        EXPECT_NE(scene.FindEntity("source_root"), entt::null);
+    }
+
+    std::filesystem::remove(sourcePath);
+    std::filesystem::remove(cookedPath);
+}
@@ -0,0 +1,400 @@
+PRAGMA_DISABLE_WARNINGS
+#include <gtest/gtest.h>
+PRAGMA_ENABLE_WARNINGS
+
+#include "Engine/Scene/Components/Components.hpp"
+#include "Engine/Scene/Scene.hpp"
+
+namespace Details
+{
+    static constexpr uint32_t kEntityCount = 1000000;
+    static constexpr uint32_t kBranching = 8;
+
+    // Entities past the first eighth of the tree are leaves, the changed ones are taken from there
+    static constexpr uint32_t kChangedCount = 100000;
+
+    static constexpr uint32_t kWideChildCount = 100000;
+
+    // Both prefab sizes are instantiated into the same number of entities
+    static constexpr uint32_t kInstancedEntityCount = 64000;
+
+    // Per-entity cost of a linear copy doesn't depend on the prefab size, a quadratic one would grow 16 times
+    static constexpr double kMaxInstancingGrowth = 4.0;
+
+    // Every entity i is a child of entity (i - 1) / kBranching, so parents always have lower indices
+    static std::vector<entt::entity> CreateTree(Scene& scene, uint32_t size)
+    {
+        std::vector<entt::entity> entities(size);
+
+        for (uint32_t i = 0; i < size; ++i)
+        {
+            const entt::entity parent = i > 0 ? entities[(i - 1) / kBranching] : entt::null;
+
+            entities[i] = scene.CreateEntity(parent, {});
+        }
+
+        return entities;
+    }
+
+    static size_t CountDescendants(const Scene& scene, entt::entity entity)
+    {
+        size_t count = 0;
+
+        scene.EnumerateDescendants(entity, [&](entt::entity)
+            {
+                ++count;
+            });
+
+        return count;
+    }
+
+    static std::vector<entt::entity> GetDescendants(const Scene& scene, entt::entity entity)
+    {
+        std::vector<entt::entity> descendants;
+
+        scene.EnumerateDescendants(entity, [&](entt::entity descendant)
+            {
+                descendants.push_back(descendant);
+            });
+
+        return descendants;
+    }
+
+    template <class TFunc>
+    static double Measure(const TFunc& func)
+    {
+        const auto begin = std::chrono::steady_clock::now();
+
+        func();
+
+        const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin;
+
+        return duration.count();
+    }
+
+    static void AddStorageComponents(Scene& scene)
+    {
+        scene.ctx().emplace<TextureStorageComponent>();
+        scene.ctx().emplace<MaterialStorageComponent>();
+        scene.ctx().emplace<GeometryStorageComponent>();
+    }
+
+    static entt::entity CreateNamedEntity(Scene& scene, entt::entity parent, const std::string& name)
+    {
+        const entt::entity entity = scene.CreateEntity(parent, {});
+
+        scene.emplace<NameComponent>(entity, name);
+
+        return entity;
+    }
+
+    static entt::entity GetFirstChild(const Scene& scene, entt::entity entity)
+    {
+        return scene.get<HierarchyComponent>(entity).GetFirstChild();
+    }
+
+    // Every entity is named and the leaves are rendered, so the components are copied along with the hierarchy
+    static entt::entity CreatePrefab(Scene& scene, uint32_t size)
+    {
+        Scene prefabScene;
+
+        AddStorageComponents(prefabScene);
+
+        const std::vector<entt::entity> entities = CreateTree(prefabScene, size);
+
+        for (uint32_t i = 0; i < size; ++i)
+        {
+            prefabScene.emplace<NameComponent>(entities[i], "prefab_" + std::to_string(i));
+
+            if (i * kBranching + 1 >= size)
+            {
+                prefabScene.emplace<RenderComponent>(entities[i]).renderObjects.emplace_back();
+            }
+        }
+
+        const entt::entity prefab = scene.CreateEntity(entt::null, {});
+
+        scene.EmplaceScenePrefab(std::move(prefabScene), prefab);
+
+        return prefab;
+    }
+
+    static double MeasureInstancing(uint32_t prefabSize)
+    {
+        Scene scene;
+
+        AddStorageComponents(scene);
+
+        const entt::entity prefab = CreatePrefab(scene, prefabSize);
+
+        const uint32_t instanceCount = kInstancedEntityCount / prefabSize;
+
+        const double seconds = Measure([&]()
+            {
+                for (uint32_t i = 0; i < instanceCount; ++i)
+                {
+                    scene.CreateSceneInstance(prefab, {});
+                }
+            });
+
+        EXPECT_EQ(scene.get<ScenePrefabComponent>(prefab).instances.size(), instanceCount);
+
+        size_t namedCount = 0;
+
+        scene.EnumerateNamedEntities("prefab_" + std::to_string(prefabSize - 1), [&](entt::entity)
+            {
+                ++namedCount;
+            });
+
+        EXPECT_EQ(namedCount, instanceCount);
+
+        const double nanosecondsPerEntity = seconds * 1e9 / (instanceCount * prefabSize);
+
+        std::cout << "Scene: " << instanceCount << " instances of " << prefabSize << " entities created in "
+                << seconds * 1000.0 << " ms (" << nanosecondsPerEntity << " ns per entity)\n";
+
+        return nanosecondsPerEntity;
+    }
+
+    // Compares the index with a scan over all names, lookups have to return the first entity in the index
+    static void ExpectIndexConsistent(const Scene& scene)
+    {
+        std::map<std::string, std::set<entt::entity>> names;
+
+        for (auto&& [entity, nc] : scene.view<NameComponent>().each())
+        {
+            names[nc.name].insert(entity);
+        }
+
+        for (const auto& [name, entities] : names)
+        {
+            std::vector<entt::entity> indexedEntities;
+
+            scene.EnumerateNamedEntities(name, [&](entt::entity entity)
+                {
+                    indexedEntities.push_back(entity);
+                });
+
+            EXPECT_EQ(std::set<entt::entity>(indexedEntities.begin(), indexedEntities.end()), entities) << name;
+            EXPECT_EQ(indexedEntities.size(), entities.size()) << name;
+
+            ASSERT_FALSE(indexedEntities.empty()) << name;
+            EXPECT_EQ(scene.FindEntity(name), indexedEntities.front()) << name;
+        }
+    }
+}
+
+TEST(Scene, HierarchyBenchmark)
+{
+    Scene scene;
+
+    const std::vector<entt::entity> entities = Details::CreateTree(scene, Details::kEntityCount);
+
+    const entt::entity root = entities.front();
+
+    size_t count = 0;
+
+    const double linkedTraverseSeconds = Details::Measure([&]()
+        {
+            count = Details::CountDescendants(scene, root);
+        });
+
+    EXPECT_EQ(count, Details::kEntityCount - 1);
+
+    const double sortSeconds = Details::Measure([&]()
+        {
+            scene.SortHierarchy();
+        });
+
+    const double traverseSeconds = Details::Measure([&]()
+        {
+            count = Details::CountDescendants(scene, root);
+        });
+
+    EXPECT_EQ(count, Details::kEntityCount - 1);
+
+    // Moving leaves under an entity with a lower index can't create cycles
+    const double reparentSeconds = Details::Measure([&]()
+        {
+            for (uint32_t i = Details::kEntityCount - Details::kChangedCount; i < Details::kEntityCount; ++i)
+            {
+                scene.get<HierarchyComponent>(entities[i]).SetParent(entities[i * 7919ull % (i / 2)]);
+            }
+        });
+
+    scene.SortHierarchy();
+
+    EXPECT_EQ(Details::CountDescendants(scene, root), Details::kEntityCount - 1);
+
+    const double removeSeconds = Details::Measure([&]()
+        {
+            for (uint32_t i = Details::kEntityCount - Details::kChangedCount; i < Details::kEntityCount; ++i)
+            {
+                scene.RemoveEntity(entities[i]);
+            }
+        });
+
+    EXPECT_EQ(Details::CountDescendants(scene, root), Details::kEntityCount - Details::kChangedCount - 1);
+
+    const entt::entity wideParent = scene.CreateEntity(root, {});
+
+    for (uint32_t i = 0; i < Details::kWideChildCount; ++i)
+    {
+        scene.CreateEntity(wideParent, {});
+    }
+
+    const double removeWideSeconds = Details::Measure([&]()
+        {
+            scene.RemoveEntity(wideParent);
+        });
+
+    EXPECT_EQ(Details::CountDescendants(scene, root), Details::kEntityCount - Details::kChangedCount - 1);
+
+    std::cout << "Scene: " << Details::kEntityCount << " entities traversed in " << traverseSeconds * 1000.0
+            << " ms sorted, " << linkedTraverseSeconds * 1000.0 << " ms following the links, sorted in "
+            << sortSeconds * 1000.0 << " ms, " << Details::kChangedCount << " reparented in "
+            << reparentSeconds * 1000.0 << " ms, " << Details::kChangedCount << " removed in "
+            << removeSeconds * 1000.0 << " ms, entity with " << Details::kWideChildCount
+            << " children removed in " << removeWideSeconds * 1000.0 << " ms\n";
+
+    RecordProperty("TraverseNanosecondsPerEntity", static_cast<int>(traverseSeconds * 1e9 / Details::kEntityCount));
+    RecordProperty("LinkedTraverseNanosecondsPerEntity",
+            static_cast<int>(linkedTraverseSeconds * 1e9 / Details::kEntityCount));
+    RecordProperty("SortNanosecondsPerEntity", static_cast<int>(sortSeconds * 1e9 / Details::kEntityCount));
+    RecordProperty("ReparentNanoseconds", static_cast<int>(reparentSeconds * 1e9 / Details::kChangedCount));
+    RecordProperty("RemoveNanoseconds", static_cast<int>(removeSeconds * 1e9 / Details::kChangedCount));
+    RecordProperty("RemoveWideNanosecondsPerChild",
+            static_cast<int>(removeWideSeconds * 1e9 / Details::kWideChildCount));
+}
+
+TEST(Scene, SortedHierarchyEnumeration)
+{
+    Scene scene;
+
+    const std::vector<entt::entity> entities = Details::CreateTree(scene, 1000);
+
+    // Moves entities under ones with lower indices, which can't create cycles, and drops a few subtrees
+    for (uint32_t i = 100; i < 1000; i += 7)
+    {
+        scene.get<HierarchyComponent>(entities[i]).SetParent(entities[i * 31 % (i / 2)]);
+    }
+
+    scene.RemoveEntity(entities[5]);
+    scene.RemoveEntity(entities[42]);
+
+    std::vector<std::vector<entt::entity>> linkedDescendants;
+
+    for (const entt::entity entity : entities)
+    {
+        if (scene.valid(entity))
+        {
+            linkedDescendants.push_back(Details::GetDescendants(scene, entity));
+        }
+    }
+
+    scene.SortHierarchy();
+
+    size_t index = 0;
+
+    for (const entt::entity entity : entities)
+    {
+        if (scene.valid(entity))
+        {
+            EXPECT_EQ(Details::GetDescendants(scene, entity), linkedDescendants[index++]);
+        }
+    }
+
+    // Every entity is followed by its descendants in the storage
+    entt::entity previous = entt::null;
+
+    for (const entt::entity entity : scene.view<HierarchyComponent>())
+    {
+        const entt::entity parent = scene.get<HierarchyComponent>(entity).GetParent();
+
+        if (parent != entt::null)
+        {
+            EXPECT_TRUE(previous == parent || SceneHelpers::IsChild(scene, previous, parent));
+        }
+
+        previous = entity;
+    }
+}
+
+TEST(Scene, NameIndexConsistency)
+{
+    Scene scene;
+
+    Details::AddStorageComponents(scene);
+
+    const entt::entity node = Details::CreateNamedEntity(scene, entt::null, "node");
+    const entt::entity child = Details::CreateNamedEntity(scene, node, "child");
+
+    const entt::entity clone = scene.CloneEntity(node, {});
+
+    Details::ExpectIndexConsistent(scene);
+
+    EXPECT_EQ(scene.FindEntity("node"), node);
+    EXPECT_EQ(scene.FindEntity("child"), child);
+
+    Scene prefabScene;
+
+    Details::AddStorageComponents(prefabScene);
+
+    const entt::entity prefabRoot = Details::CreateNamedEntity(prefabScene, entt::null, "prefab_root");
+    Details::CreateNamedEntity(prefabScene, prefabRoot, "child");
+
+    const entt::entity prefab = Details::CreateNamedEntity(scene, entt::null, "prefab");
+
+    scene.EmplaceScenePrefab(std::move(prefabScene), prefab);
+
+    const entt::entity instance = scene.CreateSceneInstance(prefab, {});
+    const entt::entity otherInstance = scene.CreateSceneInstance(prefab, {});
+
+    Details::ExpectIndexConsistent(scene);
+
+    EXPECT_EQ(scene.FindEntity("prefab_root"), Details::GetFirstChild(scene, instance));
+
+    scene.RemoveEntity(node);
+
+    Details::ExpectIndexConsistent(scene);
+
+    EXPECT_EQ(scene.FindEntity("node"), clone);
+    EXPECT_EQ(scene.FindEntity("child"), Details::GetFirstChild(scene, clone));
+
+    scene.RemoveEntity(instance);
+
+    Details::ExpectIndexConsistent(scene);
+
+    EXPECT_EQ(scene.FindEntity("prefab_root"), Details::GetFirstChild(scene, otherInstance));
+
+    scene.patch<NameComponent>(clone, [](NameComponent& nc)
+        {
+            nc.name = "renamed";
+        });
+
+    Details::ExpectIndexConsistent(scene);
+
+    EXPECT_EQ(scene.FindEntity("node"), entt::null);
+    EXPECT_EQ(scene.FindEntity("renamed"), clone);
+
+    scene.RemoveEntity(prefab);
+
+    Details::ExpectIndexConsistent(scene);
+
+    EXPECT_EQ(scene.FindEntity("prefab_root"), entt::null);
+    EXPECT_EQ(scene.FindEntity("child"), Details::GetFirstChild(scene, clone));
+}
+
+TEST(Scene, PrefabInstancingBenchmark)
+{
+    const double small = Details::MeasureInstancing(1000);
+    const double large = Details::MeasureInstancing(16000);
+
+    const double growth = large / small;
+
+    std::cout << "Scene: instancing cost per entity grows " << growth << " times for 16 times the prefab size\n";
+
+    RecordProperty("InstancingNanosecondsPerEntity", static_cast<int>(large));
+
+    EXPECT_LT(growth, Details::kMaxInstancingGrowth);
+}
@@ -0,0 +1,186 @@
+PRAGMA_DISABLE_WARNINGS
+#include <gtest/gtest.h>
+PRAGMA_ENABLE_WARNINGS
+
+#include "Engine/Scene/Components/Components.hpp"
+#include "Engine/Scene/Scene.hpp"
+#include "Engine/Scene/Systems/TransformSystem.hpp"
+
+namespace Details
+{
+    static constexpr uint32_t kChainLength = 100000;
+
+    static constexpr uint32_t kTreeSize = 1000000;
+    static constexpr uint32_t kTreeBranching = 32;
+
+    static constexpr size_t kIterationCount = 5;
+
+    static const glm::vec3 kOffset(1.0f, 0.0f, 0.0f);
+
+    struct Hierarchy
+    {
+        std::unique_ptr<Scene> scene;
+        entt::entity root = entt::null;
+        entt::entity leaf = entt::null;
+        uint32_t leafDepth = 0;
+    };
+
+    struct UpdateTimes
+    {
+        double full = std::numeric_limits<double>::max();
+        double leaf = std::numeric_limits<double>::max();
+    };
+
+    static Hierarchy CreateChain(uint32_t length)
+    {
+        Hierarchy hierarchy{ std::make_unique<Scene>() };
+
+        hierarchy.root = hierarchy.scene->CreateEntity(entt::null, Transform(kOffset));
+        hierarchy.leaf = hierarchy.root;
+
+        for (uint32_t i = 1; i < length; ++i)
+        {
+            hierarchy.leaf = hierarchy.scene->CreateEntity(hierarchy.leaf, Transform(kOffset));
+        }
+
+        hierarchy.leafDepth = length - 1;
+
+        return hierarchy;
+    }
+
+    // Every entity i is a child of entity (i - 1) / branching
+    static Hierarchy CreateTree(uint32_t size, uint32_t branching)
+    {
+        Hierarchy hierarchy{ std::make_unique<Scene>() };
+
+        std::vector<entt::entity> entities(size);
+        std::vector<uint32_t> depths(size, 0);
+
+        for (uint32_t i = 0; i < size; ++i)
+        {
+            const entt::entity parent = i > 0 ? entities[(i - 1) / branching] : entt::null;
+
+            entities[i] = hierarchy.scene->CreateEntity(parent, Transform(kOffset));
+            depths[i] = i > 0 ? depths[(i - 1) / branching] + 1 : 0;
+        }
+
+        hierarchy.root = entities.front();
+        hierarchy.leaf = entities.back();
+        hierarchy.leafDepth = depths.back();
+
+        return hierarchy;
+    }
+
+    static float GetWorldX(const Scene& scene, entt::entity entity)
+    {
+        return scene.get<TransformComponent>(entity).GetWorldTransform().GetTranslation().x;
+    }
+
+    // Moving the root updates the whole hierarchy, moving a leaf only has to find it
+    static UpdateTimes MeasureUpdate(const Hierarchy& hierarchy, const std::string& name, uint32_t size)
+    {
+        Scene& scene = *hierarchy.scene;
+
+        TransformSystem transformSystem;
+
+        transformSystem.Process(scene, 0.0f);
+
+        EXPECT_FLOAT_EQ(GetWorldX(scene, hierarchy.leaf), static_cast<float>(hierarchy.leafDepth + 1));
+
+        UpdateTimes times;
+
+        for (size_t i = 0; i < kIterationCount; ++i)
+        {
+            const float rootX = static_cast<float>(i + 2);
+
+            scene.get<TransformComponent>(hierarchy.root).SetLocalTranslation(kOffset * rootX);
+
+            const auto begin = std::chrono::steady_clock::now();
+
+            transformSystem.Process(scene, 0.0f);
+
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin;
+
+            times.full = std::min(times.full, duration.count());
+
+            EXPECT_FLOAT_EQ(GetWorldX(scene, hierarchy.leaf), rootX + static_cast<float>(hierarchy.leafDepth));
+        }
+
+        const float parentX = GetWorldX(scene, hierarchy.leaf) - kOffset.x;
+
+        for (size_t i = 0; i < kIterationCount; ++i)
+        {
+            const float leafX = static_cast<float>(i + 2);
+
+            scene.get<TransformComponent>(hierarchy.leaf).SetLocalTranslation(kOffset * leafX);
+
+            const auto begin = std::chrono::steady_clock::now();
+
+            transformSystem.Process(scene, 0.0f);
+
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin;
+
+            times.leaf = std::min(times.leaf, duration.count());
+
+            EXPECT_FLOAT_EQ(GetWorldX(scene, hierarchy.leaf), parentX + leafX);
+        }
+
+        std::cout << "TransformHierarchy: " << name << " of " << size << " entities, root moved in "
+                << times.full * 1000.0 << " ms (" << times.full * 1e9 / size << " ns per entity), leaf moved in "
+                << times.leaf * 1000.0 << " ms\n";
+
+        return times;
+    }
+}
+
+TEST(TransformHierarchy, DeepAndWideUpdateBenchmark)
+{
+    const Details::UpdateTimes deep = Details::MeasureUpdate(
+            Details::CreateChain(Details::kChainLength), "chain", Details::kChainLength);
+
+    const Details::UpdateTimes wide = Details::MeasureUpdate(
+            Details::CreateTree(Details::kTreeSize, Details::kTreeBranching), "tree", Details::kTreeSize);
+
+    RecordProperty("DeepNanosecondsPerEntity", static_cast<int>(deep.full * 1e9 / Details::kChainLength));
+    RecordProperty("WideNanosecondsPerEntity", static_cast<int>(wide.full * 1e9 / Details::kTreeSize));
+    RecordProperty("WideLeafUpdateMicroseconds", static_cast<int>(wide.leaf * 1e6));
+}
+
+TEST(TransformHierarchy, MirroredLocalTransform)
+{
+    Scene scene;
+
+    // glTF node matrices may have a negative determinant
+    const glm::mat4 mirror = glm::translate(Details::kOffset) * glm::scale(glm::vec3(-1.0f, 1.0f, 1.0f));
+    const glm::mat4 child = glm::translate(Details::kOffset) * glm::rotate(0.5f, Vector3::kY);
+
+    const entt::entity parentEntity = scene.CreateEntity(entt::null, Transform(mirror));
+    const entt::entity childEntity = scene.CreateEntity(parentEntity, Transform(child));
+
+    const glm::mat4 expected = mirror * child;
+
+    // Checked on creation and after the hierarchy recomputes it from the stored local transforms
+    const auto expectWorldMatrix = [&]()
+        {
+            const glm::mat4& world = scene.get<TransformComponent>(childEntity).GetWorldTransform().GetMatrix();
+
+            for (glm::length_t i = 0; i < 4; ++i)
+            {
+                EXPECT_LT(glm::distance(world[i], expected[i]), 1e-5f) << i;
+            }
+        };
+
+    expectWorldMatrix();
+
+    scene.get<TransformComponent>(parentEntity).SetLocalTransform(Transform(mirror));
+
+    TransformSystem transformSystem;
+
+    transformSystem.Process(scene, 0.0f);
+
+    expectWorldMatrix();
+
+    const Transform localTransform = scene.get<TransformComponent>(parentEntity).GetLocalTransform();
+
+    EXPECT_LT(glm::determinant(glm::mat3(localTransform.GetMatrix())), 0.0f);
+}
@@ -0,0 +1,216 @@
+#include "Utils/FreeListAllocator.hpp"
+
+namespace Details
+{
+    // Allocations by offset, checks that the allocator never hands out overlapping ranges
+    class AllocationTracker
+    {
+    public:
+        explicit AllocationTracker(FreeListAllocator& allocator_)
+            : allocator(allocator_)
+        {}
+
+        bool Allocate(uint32_t size, uint32_t alignment = 1)
+        {
+            const uint32_t offset = allocator.Allocate(size, alignment);
+
+            if (offset == FreeListAllocator::kInvalidOffset)
+            {
+                return false;
+            }
+
+            EXPECT_EQ(offset % alignment, 0u);
+            EXPECT_LE(offset + size, allocator.GetCapacity());
+
+            const auto next = allocations.lower_bound(offset);
+
+            if (next != allocations.end())
+            {
+                EXPECT_LE(offset + size, next->first);
+            }
+            if (next != allocations.begin())
+            {
+                EXPECT_LE(std::prev(next)->first + std::prev(next)->second, offset);
+            }
+
+            allocations.emplace(offset, size);
+            allocatedSize += size;
+
+            return true;
+        }
+
+        void Free(std::map<uint32_t, uint32_t>::iterator it)
+        {
+            allocator.Free(it->first, it->second);
+
+            allocatedSize -= it->second;
+            allocations.erase(it);
+        }
+
+        std::map<uint32_t, uint32_t>& GetAllocations() { return allocations; }
+
+        uint32_t GetAllocatedSize() const { return allocatedSize; }
+
+    private:
+        FreeListAllocator& allocator;
+
+        std::map<uint32_t, uint32_t> allocations;
+
+        uint32_t allocatedSize = 0;
+    };
+
+    static uint32_t Random(uint32_t& seed)
+    {
+        seed = seed * 1664525u + 1013904223u;
+
+        return seed >> 8;
+    }
+}
+
+TEST(FreeListAllocator, BestFit)
+{
+    FreeListAllocator allocator(100);
+
+    EXPECT_EQ(allocator.Allocate(10), 0u);
+    EXPECT_EQ(allocator.Allocate(20), 10u);
+    EXPECT_EQ(allocator.Allocate(30), 30u);
+    EXPECT_EQ(allocator.Allocate(40), 60u);
+
+    EXPECT_EQ(allocator.GetFreeSize(), 0u);
+    EXPECT_EQ(allocator.Allocate(1), FreeListAllocator::kInvalidOffset);
+
+    allocator.Free(60, 40);
+    allocator.Free(10, 20);
+
+    // The smallest range that fits wins over the first one by offset
+    EXPECT_EQ(allocator.Allocate(15), 10u);
+    EXPECT_EQ(allocator.Allocate(25), 60u);
+    EXPECT_EQ(allocator.Allocate(10), 85u);
+
+    EXPECT_EQ(allocator.GetFreeSize(), 10u);
+    EXPECT_EQ(allocator.GetFreeRangeCount(), 2u);
+}
+
+TEST(FreeListAllocator, Alignment)
+{
+    FreeListAllocator allocator(64);
+
+    EXPECT_EQ(allocator.Allocate(3), 0u);
+    EXPECT_EQ(allocator.Allocate(8, 16), 16u);
+
+    // The alignment gap stays available
+    EXPECT_EQ(allocator.GetFreeRangeCount(), 2u);
+    EXPECT_EQ(allocator.Allocate(13), 3u);
+
+    EXPECT_EQ(allocator.Allocate(48, 16), FreeListAllocator::kInvalidOffset);
+    EXPECT_EQ(allocator.Allocate(40, 8), 24u);
+    EXPECT_EQ(allocator.GetFreeSize(), 0u);
+}
+
+TEST(FreeListAllocator, Coalescing)
+{
+    FreeListAllocator allocator(40);
+
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(allocator.Allocate(10), i * 10);
+    }
+
+    allocator.Free(10, 10);
+    allocator.Free(30, 10);
+
+    EXPECT_EQ(allocator.GetFreeRangeCount(), 2u);
+    EXPECT_EQ(allocator.GetLargestFreeRange(), 10u);
+
+    // Merges with both neighbors
+    allocator.Free(20, 10);
+
+    EXPECT_EQ(allocator.GetFreeRangeCount(), 1u);
+    EXPECT_EQ(allocator.GetLargestFreeRange(), 30u);
+
+    allocator.Free(0, 10);
+
+    EXPECT_TRUE(allocator.IsEmpty());
+    EXPECT_EQ(allocator.GetFreeRangeCount(), 1u);
+    EXPECT_EQ(allocator.GetLargestFreeRange(), 40u);
+}
+
+TEST(FreeListAllocator, Fragmentation)
+{
+    const uint32_t blockSize = 16;
+    const uint32_t blockCount = 64;
+
+    FreeListAllocator allocator(blockSize * blockCount);
+
+    for (uint32_t i = 0; i < blockCount; ++i)
+    {
+        ASSERT_EQ(allocator.Allocate(blockSize), i * blockSize);
+    }
+
+    for (uint32_t i = 0; i < blockCount; i += 2)
+    {
+        allocator.Free(i * blockSize, blockSize);
+    }
+
+    // Half of the capacity is free, but only in holes of a single block
+    EXPECT_EQ(allocator.GetFreeSize(), blockSize * blockCount / 2);
+    EXPECT_EQ(allocator.GetFreeRangeCount(), blockCount / 2);
+    EXPECT_EQ(allocator.GetLargestFreeRange(), blockSize);
+    EXPECT_EQ(allocator.Allocate(blockSize + 1), FreeListAllocator::kInvalidOffset);
+
+    for (uint32_t i = 1; i < blockCount; i += 2)
+    {
+        allocator.Free(i * blockSize, blockSize);
+    }
+
+    EXPECT_TRUE(allocator.IsEmpty());
+    EXPECT_EQ(allocator.GetFreeRangeCount(), 1u);
+    EXPECT_EQ(allocator.Allocate(blockSize * blockCount), 0u);
+}
+
+TEST(FreeListAllocator, RandomChurn)
+{
+    const uint32_t capacity = 1 << 20;
+
+    FreeListAllocator allocator(capacity);
+
+    Details::AllocationTracker tracker(allocator);
+
+    uint32_t seed = 1;
+
+    for (uint32_t i = 0; i < 20000; ++i)
+    {
+        auto& allocations = tracker.GetAllocations();
+
+        if (allocations.empty() || Details::Random(seed) % 3 != 0)
+        {
+            const uint32_t size = 1 + Details::Random(seed) % 4096;
+            const uint32_t alignment = 1u << (Details::Random(seed) % 5);
+
+            if (!tracker.Allocate(size, alignment))
+            {
+                // A failed allocation means no single free range is large enough
+                EXPECT_LT(allocator.GetLargestFreeRange(), size + alignment - 1);
+            }
+        }
+        else
+        {
+            auto it = allocations.lower_bound(Details::Random(seed) % capacity);
+
+            tracker.Free(it != allocations.end() ? it : allocations.begin());
+        }
+
+        ASSERT_EQ(allocator.GetFreeSize(), capacity - tracker.GetAllocatedSize());
+    }
+
+    // Coalescing leaves at most one free range between two allocations
+    EXPECT_LE(allocator.GetFreeRangeCount(), tracker.GetAllocations().size() + 1);
+
+    while (!tracker.GetAllocations().empty())
+    {
+        tracker.Free(tracker.GetAllocations().begin());
+    }
+
+    EXPECT_TRUE(allocator.IsEmpty());
+    EXPECT_EQ(allocator.GetFreeRangeCount(), 1u);
+}
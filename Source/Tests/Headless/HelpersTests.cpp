@@ -0,0 +1,104 @@
+#include <chrono>
+
+#include "Utils/Helpers.hpp"
+
+namespace Details
+{
+    static constexpr uint8_t kCanary = 0xCD;
+
+    static constexpr size_t kCanarySize = 32;
+
+    static Bytes GetPattern(size_t size)
+    {
+        Bytes bytes(size);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            bytes[i] = static_cast<uint8_t>(i * 131 + 7);
+        }
+
+        return bytes;
+    }
+
+    // Source is cut right after the last element, so any over-read past it lands outside of the allocation
+    static void TestCopyStrided(size_t elementSize, size_t stride, size_t count)
+    {
+        SCOPED_TRACE(testing::Message() << "element " << elementSize << ", stride " << stride << ", count " << count);
+
+        const size_t srcSize = count > 0 ? (count - 1) * stride + elementSize : 0;
+
+        const Bytes src = GetPattern(srcSize);
+
+        Bytes dst(count * elementSize + kCanarySize, kCanary);
+
+        CopyStrided(src.data(), stride, elementSize, count, dst.data());
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            ASSERT_EQ(std::memcmp(dst.data() + i * elementSize, src.data() + i * stride, elementSize), 0) << i;
+        }
+
+        for (size_t i = count * elementSize; i < dst.size(); ++i)
+        {
+            ASSERT_EQ(dst[i], kCanary) << "written past the packed range at " << i;
+        }
+    }
+
+    static double MeasureCopyStrided(size_t elementSize, size_t stride, size_t count)
+    {
+        const Bytes src = GetPattern((count - 1) * stride + elementSize);
+
+        // Destination pages are touched before timing, so only the copy itself is measured
+        Bytes dst(count * elementSize, 0);
+
+        const size_t iterationCount = 10;
+
+        double bestSeconds = std::numeric_limits<double>::max();
+
+        for (size_t i = 0; i < iterationCount; ++i)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+
+            CopyStrided(src.data(), stride, elementSize, count, dst.data());
+
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin;
+
+            bestSeconds = std::min(bestSeconds, duration.count());
+        }
+
+        EXPECT_EQ(std::memcmp(dst.data() + (count - 1) * elementSize, src.data() + (count - 1) * stride, elementSize), 0);
+
+        return static_cast<double>(dst.size()) / bestSeconds / (1024.0 * 1024.0 * 1024.0);
+    }
+}
+
+TEST(Helpers, CopyStrided)
+{
+    for (size_t elementSize = 1; elementSize <= 20; ++elementSize)
+    {
+        for (size_t stride = elementSize; stride <= elementSize + 20; ++stride)
+        {
+            for (const size_t count : { 0, 1, 2, 3, 4, 5, 7, 8, 9, 17, 1000 })
+            {
+                Details::TestCopyStrided(elementSize, stride, count);
+            }
+        }
+    }
+}
+
+TEST(Helpers, CopyStridedBenchmark)
+{
+    // Positions of 32-byte vertices against a tightly packed position stream
+    const size_t count = 4 * 1024 * 1024;
+
+    const double interleaved = Details::MeasureCopyStrided(sizeof(float) * 3, 32, count);
+    const double packed = Details::MeasureCopyStrided(sizeof(float) * 3, sizeof(float) * 3, count);
+
+    const double texCoords = Details::MeasureCopyStrided(sizeof(float) * 2, 32, count);
+
+    std::cout << "CopyStrided: vec3 interleaved " << interleaved << " GB/s, vec3 packed " << packed
+            << " GB/s, vec2 interleaved " << texCoords << " GB/s\n";
+
+    RecordProperty("InterleavedMegabytesPerSecond", static_cast<int>(interleaved * 1024.0));
+    RecordProperty("PackedMegabytesPerSecond", static_cast<int>(packed * 1024.0));
+}
@@ -0,0 +1,258 @@
+#include "Utils/Json.hpp"
+
+namespace Details
+{
+    // Array of glTF-like node objects, about 100 bytes per node
+    static std::string GenerateNodes(size_t nodeCount)
+    {
+        std::string json = "{\"nodes\":[";
+
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            json += i > 0 ? ",\n" : "\n";
+            json += "{\"name\":\"Node\\u0041_" + std::to_string(i) + "\",\"mesh\":" + std::to_string(i % 97);
+            json += ",\"translation\":[" + std::to_string(i) + ".5,-1e-3,0.25],\"children\":[]}";
+        }
+
+        json += "\n]}";
+
+        return json;
+    }
+}
+
+TEST(Json, Values)
+{
+    const std::string json = R"( { "null": null, "true": true, "false": false, "int": -42, "big": 12345678901234,
+            "double": 2.5e-1, "string": "abc", "array": [1, [2, 3], {}], "object": { "a": "b" } } )";
+
+    const JsonDocument document(json);
+
+    ASSERT_TRUE(document.IsValid());
+
+    const JsonValue root = document.GetRoot();
+
+    ASSERT_TRUE(root.IsObject());
+    EXPECT_EQ(root.GetSize(), 9u);
+
+    EXPECT_TRUE(root["null"].IsNull());
+    EXPECT_TRUE(root["true"].GetBool());
+    EXPECT_FALSE(root["false"].GetBool());
+
+    EXPECT_TRUE(root["int"].IsInteger());
+    EXPECT_EQ(root["int"].GetInt(), -42);
+    EXPECT_EQ(root["big"].GetInt(), 12345678901234);
+
+    EXPECT_FALSE(root["double"].IsInteger());
+    EXPECT_EQ(root["double"].GetDouble(), 0.25);
+
+    EXPECT_EQ(root["string"].GetString(), "abc");
+
+    const JsonValue array = root["array"];
+
+    ASSERT_TRUE(array.IsArray());
+    EXPECT_EQ(array.GetSize(), 3u);
+
+    std::vector<JsonType> types;
+
+    array.ForEachElement([&](const JsonValue& element)
+        {
+            types.push_back(element.GetType());
+        });
+
+    EXPECT_EQ(types, std::vector<JsonType>({ JsonType::eNumber, JsonType::eArray, JsonType::eObject }));
+
+    EXPECT_EQ(root["object"]["a"].GetString(), "b");
+
+    // Missing members chain into invalid values
+    EXPECT_FALSE(root["missing"].IsValid());
+    EXPECT_FALSE(root["missing"]["a"].IsValid());
+    EXPECT_FALSE(root["string"]["a"].IsValid());
+}
+
+TEST(Json, Escapes)
+{
+    const std::string json = R"({ "a\"b": "\\\"\/\b\f\n\r\t", "\u0041": "\u00e9\u20ac\ud83d\ude00",
+            "bad": "\ud800x" })";
+
+    const JsonDocument document(json);
+
+    ASSERT_TRUE(document.IsValid());
+
+    const JsonValue root = document.GetRoot();
+
+    EXPECT_EQ(root["a\"b"].GetString(), "\\\"/\b\f\n\r\t");
+    EXPECT_EQ(root["a\"b"].GetRawString(), R"(\\\"\/\b\f\n\r\t)");
+
+    EXPECT_EQ(root["A"].GetString(), "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80");
+
+    // Unpaired surrogates are replaced
+    EXPECT_EQ(root["bad"].GetString(), "\xEF\xBF\xBDx");
+
+    std::vector<std::string> keys;
+
+    root.ForEachMember([&](std::string_view key, const JsonValue&)
+        {
+            keys.emplace_back(key);
+        });
+
+    EXPECT_EQ(keys, std::vector<std::string>({ "a\"b", "A", "bad" }));
+}
+
+TEST(Json, EscapesAcrossBlocks)
+{
+    // Backslash sequences of every length end at every position around the 64 byte block boundary
+    for (size_t length = 1; length < 6; ++length)
+    {
+        for (size_t padding = 50; padding < 70; ++padding)
+        {
+            std::string value(padding, 'x');
+
+            for (size_t i = 0; i < length; ++i)
+            {
+                value += "\\\\";
+            }
+
+            value += "\\\"";
+
+            const std::string json = "[\"" + value + "\", 1]";
+
+            const JsonDocument document(json);
+
+            ASSERT_TRUE(document.IsValid()) << json;
+
+            const JsonValue root = document.GetRoot();
+
+            ASSERT_EQ(root.GetSize(), 2u);
+
+            root.ForEachElement([&](const JsonValue& element)
+                {
+                    if (element.IsString())
+                    {
+                        EXPECT_EQ(element.GetString(), std::string(padding, 'x') + std::string(length, '\\') + "\"");
+                    }
+                });
+        }
+    }
+}
+
+TEST(Json, Errors)
+{
+    const std::vector<std::pair<std::string, size_t>> cases = {
+        { "", 0 },
+        { "[1, 2", 5 },
+        { "[1, 2,]", 6 },
+        { "{\"a\" 1}", 5 },
+        { "{\"a\": 1,}", 8 },
+        { "{1: 2}", 1 },
+        { "[01]", 1 },
+        { "[1.]", 1 },
+        { "[-]", 1 },
+        { "[tru]", 1 },
+        { "[\"\\x\"]", 1 },
+        { "[\"\\u12G4\"]", 1 },
+        { "[\"abc]", 6 },
+        { "[1] 2", 4 },
+        { "]", 0 }
+    };
+
+    for (const auto& [json, errorOffset] : cases)
+    {
+        const JsonDocument document(json);
+
+        EXPECT_FALSE(document.IsValid()) << json;
+        EXPECT_EQ(document.GetErrorOffset(), errorOffset) << json;
+    }
+}
+
+TEST(Json, ControlCharacters)
+{
+    // Whitespace control characters are fine between tokens
+    EXPECT_TRUE(JsonDocument("[\t1,\r\n2]").IsValid());
+
+    EXPECT_TRUE(JsonDocument("[\"a\\tb\"]").IsValid());
+
+    for (const char c : { '\t', '\n', '\x01', '\x1F' })
+    {
+        const std::string json = std::string("[\"ab") + c + "\"]";
+
+        const JsonDocument document(json);
+
+        EXPECT_FALSE(document.IsValid());
+        EXPECT_EQ(document.GetErrorOffset(), 4u);
+    }
+
+    // The string starts in the previous block
+    const std::string json = "[\"" + std::string(100, 'x') + "\x7F\x80\x1F\"]";
+
+    const JsonDocument document(json);
+
+    EXPECT_FALSE(document.IsValid());
+    EXPECT_EQ(document.GetErrorOffset(), 104u);
+}
+
+TEST(Json, DepthLimit)
+{
+    EXPECT_TRUE(JsonDocument(std::string(1000, '[') + std::string(1000, ']')).IsValid());
+
+    const JsonDocument document(std::string(2000, '[') + std::string(2000, ']'));
+
+    EXPECT_FALSE(document.IsValid());
+}
+
+TEST(Json, LargeDocument)
+{
+    const size_t nodeCount = 10000;
+
+    const std::string json = Details::GenerateNodes(nodeCount);
+
+    const JsonDocument document(json);
+
+    ASSERT_TRUE(document.IsValid());
+
+    const JsonValue nodes = document.GetRoot()["nodes"];
+
+    ASSERT_EQ(nodes.GetSize(), nodeCount);
+
+    size_t index = 0;
+
+    nodes.ForEachElement([&](const JsonValue& node)
+        {
+            EXPECT_EQ(node["name"].GetString(), "NodeA_" + std::to_string(index));
+            EXPECT_EQ(node["mesh"].GetInt(), static_cast<int64_t>(index % 97));
+            EXPECT_EQ(node["translation"].GetSize(), 3u);
+            EXPECT_EQ(node["children"].GetSize(), 0u);
+
+            ++index;
+        });
+
+    EXPECT_EQ(index, nodeCount);
+}
+
+TEST(Json, ParseThroughputBenchmark)
+{
+    const std::string json = Details::GenerateNodes(500000);
+
+    const size_t iterationCount = 5;
+
+    double bestSeconds = std::numeric_limits<double>::max();
+
+    for (size_t i = 0; i < iterationCount; ++i)
+    {
+        const auto begin = std::chrono::steady_clock::now();
+
+        const JsonDocument document(json);
+
+        const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin;
+
+        ASSERT_TRUE(document.IsValid());
+
+        bestSeconds = std::min(bestSeconds, duration.count());
+    }
+
+    const double megabytes = static_cast<double>(json.size()) / (1024.0 * 1024.0);
+
+    std::cout << "JsonDocument: " << megabytes << " MB parsed in " << bestSeconds * 1000.0 << " ms, "
+            << megabytes / bestSeconds << " MB/s\n";
+
+    RecordProperty("MegabytesPerSecond", static_cast<int>(megabytes / bestSeconds));
+}
@@ -0,0 +1,168 @@
+#include "Tests/Headless/TestMeshes.hpp"
+
+#include "Engine/Scene/Lod.hpp"
+
+namespace Details
+{
+    static constexpr uint32_t kGridSize = 64;
+
+    static constexpr float kAmplitude = 0.05f;
+
+    static constexpr uint32_t kSampleSteps = 8;
+
+    // Quadrics bound the distance of the remaining vertices to the planes they replaced,
+    // points inside of the simplified triangles may be a bit further away
+    static constexpr float kErrorTolerance = 3.0f;
+
+    static constexpr float kEpsilon = 1e-5f;
+
+    using Edge = std::pair<uint32_t, uint32_t>;
+
+    // Directed edges without a twin in the opposite direction
+    static std::set<Edge> GetBoundaryEdges(const uint32_t* indices, size_t indexCount)
+    {
+        std::set<Edge> edges;
+
+        for (size_t i = 0; i < indexCount; i += 3)
+        {
+            for (size_t j = 0; j < 3; ++j)
+            {
+                edges.emplace(indices[i + j], indices[i + (j + 1) % 3]);
+            }
+        }
+
+        std::set<Edge> boundaryEdges;
+
+        for (const auto& [a, b] : edges)
+        {
+            if (!edges.contains(Edge(b, a)))
+            {
+                boundaryEdges.emplace(a, b);
+            }
+        }
+
+        return boundaryEdges;
+    }
+
+    // Height of the full detail grid surface at xy, interpolated within the triangle that contains it
+    static float GetSurfaceHeight(const MeshData& grid, const glm::vec2& point)
+    {
+        const uint32_t rowSize = kGridSize + 1;
+
+        const glm::vec2 cellPosition = glm::clamp(point * static_cast<float>(kGridSize),
+                Vector2::kZero, glm::vec2(static_cast<float>(kGridSize) - kEpsilon));
+
+        const glm::uvec2 cell = glm::uvec2(cellPosition);
+        const glm::vec2 fraction = cellPosition - glm::vec2(cell);
+
+        const float z0 = grid.positions[cell.y * rowSize + cell.x].z;
+        const float z1 = grid.positions[cell.y * rowSize + cell.x + 1].z;
+        const float z2 = grid.positions[(cell.y + 1) * rowSize + cell.x].z;
+        const float z3 = grid.positions[(cell.y + 1) * rowSize + cell.x + 1].z;
+
+        // Cells are split along the diagonal from the first to the last corner
+        if (fraction.x >= fraction.y)
+        {
+            return z0 + (z1 - z0) * fraction.x + (z3 - z1) * fraction.y;
+        }
+
+        return z0 + (z3 - z2) * fraction.x + (z2 - z0) * fraction.y;
+    }
+
+    // Vertical distance is never smaller than the distance to the surface
+    static float GetMaxDeviation(const MeshData& grid, const uint32_t* indices, size_t indexCount)
+    {
+        float maxDeviation = 0.0f;
+
+        for (size_t i = 0; i < indexCount; i += 3)
+        {
+            const glm::vec3& position0 = grid.positions[indices[i]];
+            const glm::vec3& position1 = grid.positions[indices[i + 1]];
+            const glm::vec3& position2 = grid.positions[indices[i + 2]];
+
+            for (uint32_t a = 0; a <= kSampleSteps; ++a)
+            {
+                for (uint32_t b = 0; a + b <= kSampleSteps; ++b)
+                {
+                    const float u = static_cast<float>(a) / kSampleSteps;
+                    const float v = static_cast<float>(b) / kSampleSteps;
+
+                    const glm::vec3 point = position0 * (1.0f - u - v) + position1 * u + position2 * v;
+
+                    const float deviation = std::abs(point.z - GetSurfaceHeight(grid, glm::vec2(point)));
+
+                    maxDeviation = std::max(maxDeviation, deviation);
+                }
+            }
+        }
+
+        return maxDeviation;
+    }
+}
+
+TEST(Lod, LevelLayout)
+{
+    const MeshData grid = TestMeshes::CreateHeightField(Details::kGridSize, Details::kAmplitude);
+
+    std::vector<uint32_t> indices = grid.indices;
+
+    const std::vector<Lod> lods = LodHelpers::BuildLods(indices, grid.positions);
+
+    ASSERT_GT(lods.size(), 2u);
+    EXPECT_LE(lods.size(), LodHelpers::kMaxLodCount);
+
+    EXPECT_EQ(lods.front().firstIndex, 0u);
+    EXPECT_EQ(lods.front().indexCount, static_cast<uint32_t>(grid.indices.size()));
+    EXPECT_EQ(lods.front().error, 0.0f);
+
+    EXPECT_TRUE(std::equal(grid.indices.begin(), grid.indices.end(), indices.begin()));
+
+    for (size_t i = 1; i < lods.size(); ++i)
+    {
+        EXPECT_EQ(lods[i].firstIndex, lods[i - 1].firstIndex + lods[i - 1].indexCount);
+        EXPECT_LT(lods[i].indexCount, lods[i - 1].indexCount);
+        EXPECT_GE(lods[i].error, lods[i - 1].error);
+        EXPECT_LE(lods[i].error, LodHelpers::kMaxError);
+    }
+
+    EXPECT_EQ(lods.back().firstIndex + lods.back().indexCount, static_cast<uint32_t>(indices.size()));
+
+    EXPECT_EQ(LodHelpers::SelectLod(lods, 0.0f), 0u);
+    EXPECT_EQ(LodHelpers::SelectLod(lods, LodHelpers::kMaxError), static_cast<uint32_t>(lods.size() - 1));
+}
+
+TEST(Lod, BoundaryIsPreserved)
+{
+    const MeshData grid = TestMeshes::CreateHeightField(Details::kGridSize, Details::kAmplitude);
+
+    std::vector<uint32_t> indices = grid.indices;
+
+    const std::vector<Lod> lods = LodHelpers::BuildLods(indices, grid.positions);
+
+    const std::set<Details::Edge> boundaryEdges = Details::GetBoundaryEdges(grid.indices.data(), grid.indices.size());
+
+    ASSERT_EQ(boundaryEdges.size(), Details::kGridSize * 4);
+
+    for (const Lod& lod : lods)
+    {
+        EXPECT_EQ(Details::GetBoundaryEdges(indices.data() + lod.firstIndex, lod.indexCount), boundaryEdges);
+    }
+}
+
+TEST(Lod, ErrorBound)
+{
+    const MeshData grid = TestMeshes::CreateHeightField(Details::kGridSize, Details::kAmplitude);
+
+    std::vector<uint32_t> indices = grid.indices;
+
+    const std::vector<Lod> lods = LodHelpers::BuildLods(indices, grid.positions);
+
+    for (size_t i = 1; i < lods.size(); ++i)
+    {
+        SCOPED_TRACE(i);
+
+        const float deviation = Details::GetMaxDeviation(grid, indices.data() + lods[i].firstIndex, lods[i].indexCount);
+
+        EXPECT_LE(deviation, lods[i].error * Details::kErrorTolerance + Details::kEpsilon);
+    }
+}
@@ -0,0 +1,182 @@
+#include <chrono>
+
+#include "Tests/Headless/TestMeshes.hpp"
+
+#include "Engine/Scene/MeshData.hpp"
+
+#include "Utils/Helpers.hpp"
+#include "Utils/ThreadPool.hpp"
+
+namespace Details
+{
+    // Large enough for the parallel path, which starts above one block of triangles
+    static constexpr uint32_t kLargeGridSize = 256;
+
+    static constexpr float kEpsilon = 1e-5f;
+
+    // About two million triangles, enough to keep every thread of the pool busy
+    static constexpr uint32_t kBenchmarkGridSize = 1024;
+
+    static constexpr size_t kIterationCount = 5;
+
+    template <class T>
+    static bool IsBitIdentical(const std::vector<T>& a, const std::vector<T>& b)
+    {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+    }
+
+    // Returns millions of triangles per second of the best iteration
+    template <class TFunc>
+    static double MeasureTriangleRate(size_t triangleCount, const TFunc& func)
+    {
+        double bestSeconds = std::numeric_limits<double>::max();
+
+        for (size_t i = 0; i < kIterationCount; ++i)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+
+            func();
+
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin;
+
+            bestSeconds = std::min(bestSeconds, duration.count());
+        }
+
+        return static_cast<double>(triangleCount) / bestSeconds / 1e6;
+    }
+}
+
+TEST(MeshDataHelpers, ComputeNormalsOfPlane)
+{
+    const MeshData grid = TestMeshes::CreateGrid(8);
+
+    const std::vector<glm::vec3> normals = MeshDataHelpers::ComputeNormals(grid.indices, grid.positions);
+
+    ASSERT_EQ(normals.size(), grid.positions.size());
+
+    for (const glm::vec3& normal : normals)
+    {
+        EXPECT_NEAR(glm::distance(normal, Vector3::kZ), 0.0f, Details::kEpsilon);
+    }
+}
+
+TEST(MeshDataHelpers, ComputeTangentsFollowTexCoords)
+{
+    const MeshData grid = TestMeshes::CreateGrid(8);
+
+    const std::vector<glm::vec3> normals = Repeat(Vector3::kZ, grid.positions.size());
+
+    const std::vector<glm::vec3> tangents = MeshDataHelpers::ComputeTangents(
+            grid.indices, grid.positions, normals, grid.texCoords);
+
+    ASSERT_EQ(tangents.size(), grid.positions.size());
+
+    for (const glm::vec3& tangent : tangents)
+    {
+        EXPECT_NEAR(glm::distance(tangent, Vector3::kX), 0.0f, Details::kEpsilon);
+    }
+}
+
+TEST(MeshDataHelpers, ParallelResultMatchesSerial)
+{
+    const MeshData mesh = TestMeshes::CreateHeightField(Details::kLargeGridSize, 0.2f);
+
+    ThreadPool threadPool(4);
+
+    const std::vector<glm::vec3> serialNormals = MeshDataHelpers::ComputeNormals(mesh.indices, mesh.positions);
+    const std::vector<glm::vec3> parallelNormals = MeshDataHelpers::ComputeNormals(
+            mesh.indices, mesh.positions, &threadPool);
+
+    EXPECT_TRUE(Details::IsBitIdentical(serialNormals, parallelNormals));
+
+    const std::vector<glm::vec3> serialTangents = MeshDataHelpers::ComputeTangents(
+            mesh.indices, mesh.positions, serialNormals, mesh.texCoords);
+    const std::vector<glm::vec3> parallelTangents = MeshDataHelpers::ComputeTangents(
+            mesh.indices, mesh.positions, serialNormals, mesh.texCoords, &threadPool);
+
+    EXPECT_TRUE(Details::IsBitIdentical(serialTangents, parallelTangents));
+}
+
+TEST(MeshDataHelpers, CreateMeshDataFillsMissingStreams)
+{
+    const MeshData grid = TestMeshes::CreateGrid(16);
+
+    const MeshData mesh = MeshDataHelpers::CreateMeshData(grid.indices, grid.positions);
+
+    EXPECT_EQ(mesh.normals.size(), mesh.positions.size());
+    EXPECT_EQ(mesh.tangents.size(), mesh.positions.size());
+    EXPECT_EQ(mesh.texCoords.size(), mesh.positions.size());
+
+    EXPECT_EQ(mesh.bbox.GetMin(), Vector3::kZero);
+    EXPECT_EQ(mesh.bbox.GetMax(), glm::vec3(1.0f, 1.0f, 0.0f));
+
+    EXPECT_FALSE(mesh.meshlets.empty());
+
+    ASSERT_FALSE(mesh.lods.empty());
+    EXPECT_EQ(mesh.lods.front().firstIndex, 0u);
+    EXPECT_EQ(mesh.lods.front().indexCount, static_cast<uint32_t>(grid.indices.size()));
+}
+
+TEST(MeshDataHelpers, RemoveDuplicates)
+{
+    const MeshData grid = TestMeshes::CreateGrid(4);
+
+    MeshData shifted = grid;
+    shifted.positions.front().z = 1.0f;
+
+    std::vector<MeshData> meshes = { grid, shifted, grid, shifted, TestMeshes::CreateGrid(2) };
+
+    const std::vector<uint32_t> meshIndices = MeshDataHelpers::RemoveDuplicates(meshes);
+
+    EXPECT_EQ(meshIndices, std::vector<uint32_t>({ 0, 1, 0, 1, 2 }));
+
+    ASSERT_EQ(meshes.size(), 3u);
+    EXPECT_TRUE(Details::IsBitIdentical(meshes[0].positions, grid.positions));
+    EXPECT_TRUE(Details::IsBitIdentical(meshes[1].positions, shifted.positions));
+}
+
+TEST(MeshDataHelpers, ComputeNormalsAndTangentsBenchmark)
+{
+    const MeshData mesh = TestMeshes::CreateHeightField(Details::kBenchmarkGridSize, 0.2f);
+
+    const size_t triangleCount = mesh.indices.size() / 3;
+
+    ThreadPool threadPool;
+
+    std::vector<glm::vec3> normals;
+    std::vector<glm::vec3> tangents;
+
+    const double serialNormals = Details::MeasureTriangleRate(triangleCount, [&]()
+        {
+            normals = MeshDataHelpers::ComputeNormals(mesh.indices, mesh.positions);
+        });
+
+    const double parallelNormals = Details::MeasureTriangleRate(triangleCount, [&]()
+        {
+            normals = MeshDataHelpers::ComputeNormals(mesh.indices, mesh.positions, &threadPool);
+        });
+
+    const double serialTangents = Details::MeasureTriangleRate(triangleCount, [&]()
+        {
+            tangents = MeshDataHelpers::ComputeTangents(mesh.indices, mesh.positions, normals, mesh.texCoords);
+        });
+
+    const double parallelTangents = Details::MeasureTriangleRate(triangleCount, [&]()
+        {
+            tangents = MeshDataHelpers::ComputeTangents(
+                    mesh.indices, mesh.positions, normals, mesh.texCoords, &threadPool);
+        });
+
+    EXPECT_EQ(normals.size(), mesh.positions.size());
+    EXPECT_EQ(tangents.size(), mesh.positions.size());
+
+    std::cout << "MeshDataHelpers: " << triangleCount << " triangles, normals " << serialNormals
+            << " Mtri/s serial, " << parallelNormals << " Mtri/s with " << threadPool.GetThreadCount()
+            << " threads, tangents " << serialTangents << " Mtri/s serial, " << parallelTangents
+            << " Mtri/s with " << threadPool.GetThreadCount() << " threads\n";
+
+    RecordProperty("SerialNormalsKilotrianglesPerSecond", static_cast<int>(serialNormals * 1000.0));
+    RecordProperty("ParallelNormalsKilotrianglesPerSecond", static_cast<int>(parallelNormals * 1000.0));
+    RecordProperty("SerialTangentsKilotrianglesPerSecond", static_cast<int>(serialTangents * 1000.0));
+    RecordProperty("ParallelTangentsKilotrianglesPerSecond", static_cast<int>(parallelTangents * 1000.0));
+}
@@ -0,0 +1,159 @@
+#include "Tests/Headless/TestMeshes.hpp"
+
+#include "Engine/Scene/MeshOptimizer.hpp"
+
+namespace Details
+{
+    static constexpr float kEpsilon = 1e-5f;
+
+    // Deterministic triangle shuffle that destroys the vertex locality of the grid
+    static std::vector<uint32_t> ShuffleTriangles(const std::vector<uint32_t>& indices)
+    {
+        const size_t triangleCount = indices.size() / 3;
+
+        std::vector<uint32_t> result;
+        result.reserve(indices.size());
+
+        for (size_t i = 0; i < triangleCount; ++i)
+        {
+            const size_t triangle = (i * 7919) % triangleCount;
+
+            result.insert(result.end(), indices.begin() + triangle * 3, indices.begin() + triangle * 3 + 3);
+        }
+
+        return result;
+    }
+
+    static float ComputeArea(const std::vector<uint32_t>& indices, const std::vector<glm::vec3>& positions)
+    {
+        float area = 0.0f;
+
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            const glm::vec3& position0 = positions[indices[i]];
+            const glm::vec3& position1 = positions[indices[i + 1]];
+            const glm::vec3& position2 = positions[indices[i + 2]];
+
+            area += 0.5f * glm::length(glm::cross(position1 - position0, position2 - position0));
+        }
+
+        return area;
+    }
+}
+
+TEST(MeshOptimizer, OptimizeVertexCache)
+{
+    const MeshData grid = TestMeshes::CreateGrid(64);
+
+    const uint32_t vertexCount = grid.GetVertexCount();
+
+    const std::vector<uint32_t> shuffledIndices = Details::ShuffleTriangles(grid.indices);
+
+    const std::vector<uint32_t> optimizedIndices = MeshOptimizer::OptimizeVertexCache(shuffledIndices, vertexCount);
+
+    EXPECT_TRUE(TestMeshes::HasSameTriangles(shuffledIndices, optimizedIndices));
+
+    const MeshOptimizer::VertexCacheStatistics before
+            = MeshOptimizer::AnalyzeVertexCache(shuffledIndices, vertexCount);
+    const MeshOptimizer::VertexCacheStatistics after
+            = MeshOptimizer::AnalyzeVertexCache(optimizedIndices, vertexCount);
+
+    EXPECT_LT(after.acmr, before.acmr);
+
+    // A regular grid is close to the ideal 0.5 vertices per triangle with a 16 entry cache
+    EXPECT_LT(after.acmr, 0.8f);
+}
+
+TEST(MeshOptimizer, OptimizeOverdrawKeepsTriangles)
+{
+    const MeshData mesh = TestMeshes::CreateHeightField(32, 0.3f);
+
+    const std::vector<uint32_t> cacheIndices = MeshOptimizer::OptimizeVertexCache(mesh.indices, mesh.GetVertexCount());
+
+    const std::vector<uint32_t> overdrawIndices = MeshOptimizer::OptimizeOverdraw(cacheIndices, mesh.positions);
+
+    EXPECT_TRUE(TestMeshes::HasSameTriangles(cacheIndices, overdrawIndices));
+
+    const float acmr = MeshOptimizer::AnalyzeVertexCache(cacheIndices, mesh.GetVertexCount()).acmr;
+    const float overdrawAcmr = MeshOptimizer::AnalyzeVertexCache(overdrawIndices, mesh.GetVertexCount()).acmr;
+
+    // Cluster boundaries cost a few extra misses on top of the threshold
+    EXPECT_LE(overdrawAcmr, acmr * MeshOptimizer::kOverdrawThreshold + 0.05f);
+}
+
+TEST(MeshOptimizer, OptimizeVertexFetch)
+{
+    std::vector<uint32_t> indices = { 4, 2, 0, 0, 2, 5 };
+
+    const std::vector<uint32_t> remap = MeshOptimizer::OptimizeVertexFetch(indices, 6);
+
+    const uint32_t unused = MeshOptimizer::kUnusedVertex;
+
+    EXPECT_EQ(indices, std::vector<uint32_t>({ 0, 1, 2, 2, 1, 3 }));
+    EXPECT_EQ(remap, std::vector<uint32_t>({ 2, unused, 1, unused, 0, 3 }));
+
+    const std::vector<int> vertices = { 10, 11, 12, 13, 14, 15 };
+
+    EXPECT_EQ(MeshOptimizer::RemapVertices(vertices, remap), std::vector<int>({ 14, 12, 10, 15 }));
+}
+
+TEST(MeshOptimizer, WeldVertices)
+{
+    const MeshData grid = TestMeshes::CreateGrid(8);
+
+    // Every triangle gets its own vertices, as after a flat shaded export
+    std::vector<uint32_t> indices(grid.indices.size());
+    std::vector<glm::vec3> positions(grid.indices.size());
+    std::vector<glm::vec2> texCoords(grid.indices.size());
+
+    for (size_t i = 0; i < grid.indices.size(); ++i)
+    {
+        indices[i] = static_cast<uint32_t>(i);
+        positions[i] = grid.positions[grid.indices[i]];
+        texCoords[i] = grid.texCoords[grid.indices[i]];
+    }
+
+    // Offsets below the tolerance mustn't prevent welding
+    positions[0].x += MeshOptimizer::kWeldPositionEpsilon * 0.1f;
+
+    const std::vector<uint32_t> remap = MeshOptimizer::WeldVertices(indices, positions, {}, {}, texCoords);
+
+    const std::vector<glm::vec3> weldedPositions = MeshOptimizer::RemapVertices(positions, remap);
+
+    EXPECT_EQ(weldedPositions.size(), grid.positions.size());
+    EXPECT_EQ(indices.size(), grid.indices.size());
+
+    EXPECT_NEAR(Details::ComputeArea(indices, weldedPositions), 1.0f, Details::kEpsilon);
+}
+
+TEST(MeshOptimizer, SimplifyFlatGrid)
+{
+    const MeshData grid = TestMeshes::CreateGrid(32);
+
+    float error = -1.0f;
+
+    const std::vector<uint32_t> indices = MeshOptimizer::SimplifyMesh(
+            grid.indices, grid.positions, grid.indices.size() / 4, 0.01f, &error);
+
+    EXPECT_LE(indices.size(), grid.indices.size() / 4);
+    EXPECT_FALSE(indices.empty());
+
+    // Collapses within a plane are free and the locked border keeps the outline
+    EXPECT_NEAR(error, 0.0f, Details::kEpsilon);
+    EXPECT_NEAR(Details::ComputeArea(indices, grid.positions), 1.0f, Details::kEpsilon);
+}
+
+TEST(MeshOptimizer, SimplifyStopsAtTargetError)
+{
+    const MeshData mesh = TestMeshes::CreateHeightField(32, 0.2f);
+
+    const float targetError = 0.001f;
+
+    float error = -1.0f;
+
+    const std::vector<uint32_t> indices = MeshOptimizer::SimplifyMesh(
+            mesh.indices, mesh.positions, 0, targetError, &error);
+
+    EXPECT_FALSE(indices.empty());
+    EXPECT_LE(error, targetError);
+}
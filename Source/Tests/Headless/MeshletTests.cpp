@@ -0,0 +1,135 @@
+#include "Tests/Headless/TestMeshes.hpp"
+
+#include "Engine/Scene/Meshlet.hpp"
+
+namespace Details
+{
+    static constexpr float kEpsilon = 1e-4f;
+
+    static std::vector<Meshlet> BuildMeshlets(const MeshData& mesh, std::vector<uint32_t>& indices)
+    {
+        indices = mesh.indices;
+
+        return MeshletHelpers::BuildMeshlets(indices, mesh.positions);
+    }
+}
+
+TEST(Meshlet, EveryTriangleInOneMeshlet)
+{
+    const MeshData mesh = TestMeshes::CreateHeightField(48, 0.3f);
+
+    std::vector<uint32_t> indices;
+
+    const std::vector<Meshlet> meshlets = Details::BuildMeshlets(mesh, indices);
+
+    // Triangles are only reordered
+    EXPECT_TRUE(TestMeshes::HasSameTriangles(indices, mesh.indices));
+
+    // Meshlets partition the triangles into consecutive ranges
+    uint32_t firstTriangle = 0;
+
+    for (const Meshlet& meshlet : meshlets)
+    {
+        EXPECT_EQ(meshlet.firstTriangle, firstTriangle);
+        EXPECT_GT(meshlet.triangleCount, 0u);
+        EXPECT_LE(meshlet.triangleCount, MeshletHelpers::kMaxTriangleCount);
+
+        firstTriangle += meshlet.triangleCount;
+    }
+
+    EXPECT_EQ(firstTriangle, static_cast<uint32_t>(indices.size() / 3));
+}
+
+TEST(Meshlet, LimitsAndBounds)
+{
+    const MeshData mesh = TestMeshes::CreateHeightField(48, 0.3f);
+
+    std::vector<uint32_t> indices;
+
+    const std::vector<Meshlet> meshlets = Details::BuildMeshlets(mesh, indices);
+
+    for (const Meshlet& meshlet : meshlets)
+    {
+        const auto begin = indices.begin() + meshlet.firstTriangle * 3;
+        const auto end = begin + meshlet.triangleCount * 3;
+
+        const std::set<uint32_t> vertices(begin, end);
+
+        EXPECT_EQ(meshlet.vertexCount, static_cast<uint32_t>(vertices.size()));
+        EXPECT_LE(meshlet.vertexCount, MeshletHelpers::kMaxVertexCount);
+
+        for (const uint32_t vertex : vertices)
+        {
+            const glm::vec3& position = mesh.positions[vertex];
+
+            EXPECT_TRUE(glm::all(glm::greaterThanEqual(position, meshlet.bbox.GetMin())));
+            EXPECT_TRUE(glm::all(glm::lessThanEqual(position, meshlet.bbox.GetMax())));
+
+            EXPECT_LE(glm::distance(position, meshlet.sphereCenter), meshlet.sphereRadius + Details::kEpsilon);
+        }
+    }
+}
+
+TEST(Meshlet, BackfacingPlane)
+{
+    const MeshData grid = TestMeshes::CreateGrid(32);
+
+    std::vector<uint32_t> indices;
+
+    const std::vector<Meshlet> meshlets = Details::BuildMeshlets(grid, indices);
+
+    ASSERT_GT(meshlets.size(), 1u);
+
+    for (const Meshlet& meshlet : meshlets)
+    {
+        EXPECT_TRUE(MeshletHelpers::IsBackfacing(meshlet, glm::vec3(0.5f, 0.5f, -10.0f)));
+        EXPECT_FALSE(MeshletHelpers::IsBackfacing(meshlet, glm::vec3(0.5f, 0.5f, 10.0f)));
+    }
+}
+
+TEST(Meshlet, BackfacingIsConservative)
+{
+    const MeshData mesh = TestMeshes::CreateHeightField(48, 0.05f);
+
+    std::vector<uint32_t> indices;
+
+    const std::vector<Meshlet> meshlets = Details::BuildMeshlets(mesh, indices);
+
+    uint32_t culledCount = 0;
+
+    for (int32_t x = -2; x <= 2; ++x)
+    {
+        for (int32_t z = -2; z <= 2; ++z)
+        {
+            const glm::vec3 eye(static_cast<float>(x), 0.3f, static_cast<float>(z) * 0.5f);
+
+            for (const Meshlet& meshlet : meshlets)
+            {
+                if (!MeshletHelpers::IsBackfacing(meshlet, eye))
+                {
+                    continue;
+                }
+
+                ++culledCount;
+
+                const uint32_t firstIndex = meshlet.firstTriangle * 3;
+                const uint32_t indexCount = meshlet.triangleCount * 3;
+
+                // A culled meshlet can't have a single triangle that faces the eye
+                for (uint32_t i = firstIndex; i < firstIndex + indexCount; i += 3)
+                {
+                    const glm::vec3& position0 = mesh.positions[indices[i]];
+                    const glm::vec3& position1 = mesh.positions[indices[i + 1]];
+                    const glm::vec3& position2 = mesh.positions[indices[i + 2]];
+
+                    const glm::vec3 normal = glm::normalize(glm::cross(position1 - position0, position2 - position0));
+
+                    EXPECT_LE(glm::dot(normal, glm::normalize(eye - position0)), Details::kEpsilon);
+                }
+            }
+        }
+    }
+
+    // Eyes below the surface must cull something, otherwise the test proves nothing
+    EXPECT_GT(culledCount, 0u);
+}
@@ -0,0 +1,435 @@
+#include <bit>
+#include <chrono>
+#include <random>
+
+#include "Engine/Scene/MeshoptDecoder.hpp"
+
+#include "Utils/Helpers.hpp"
+
+// The encoders below only produce the simplest valid form of every bitstream: 8-bit byte groups
+// for vertices and explicitly encoded indices for triangles, which is enough to check the decoder against
+namespace Details
+{
+    static uint32_t Zigzag32(int32_t value)
+    {
+        return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+    }
+
+    static uint8_t Zigzag8(uint8_t delta)
+    {
+        return static_cast<uint8_t>((delta << 1) ^ (static_cast<int8_t>(delta) >> 7));
+    }
+
+    static void EncodeVByte(Bytes& data, uint32_t value)
+    {
+        while (value >= 128)
+        {
+            data.push_back(static_cast<uint8_t>((value & 127) | 128));
+            value >>= 7;
+        }
+
+        data.push_back(static_cast<uint8_t>(value));
+    }
+
+    static Bytes GenerateBytes(size_t size, uint32_t seed)
+    {
+        Bytes bytes(size);
+
+        for (uint8_t& byte : bytes)
+        {
+            seed = seed * 1664525u + 1013904223u;
+
+            // Small steps keep neighbor vertices similar like real attributes
+            byte = static_cast<uint8_t>(seed >> 28);
+        }
+
+        return bytes;
+    }
+
+    static Bytes EncodeVertexBuffer(const Bytes& vertices, size_t count, size_t stride)
+    {
+        constexpr size_t groupSize = 16;
+
+        Bytes data = { 0xA0 };
+
+        std::vector<uint8_t> lastVertex(vertices.begin(), vertices.begin() + stride);
+
+        const size_t blockSize = std::min<size_t>((8192 / stride) & ~(groupSize - 1), 256);
+
+        for (size_t offset = 0; offset < count; offset += blockSize)
+        {
+            const size_t blockCount = std::min(blockSize, count - offset);
+            const size_t alignedCount = (blockCount + groupSize - 1) & ~(groupSize - 1);
+
+            for (size_t k = 0; k < stride; ++k)
+            {
+                const size_t groupCount = alignedCount / groupSize;
+
+                data.insert(data.end(), (groupCount + 3) / 4, 0xFF);
+
+                for (size_t i = 0; i < alignedCount; ++i)
+                {
+                    const uint8_t value = i < blockCount ? vertices[(offset + i) * stride + k] : lastVertex[k];
+
+                    data.push_back(Zigzag8(static_cast<uint8_t>(value - lastVertex[k])));
+
+                    lastVertex[k] = value;
+                }
+            }
+        }
+
+        const size_t tailSize = std::max<size_t>(stride, 32);
+
+        data.insert(data.end(), tailSize - stride, 0);
+        data.insert(data.end(), vertices.begin(), vertices.begin() + stride);
+
+        return data;
+    }
+
+    static Bytes EncodeIndexBuffer(const std::vector<uint32_t>& indices)
+    {
+        Bytes data = { 0xE1 };
+
+        data.insert(data.end(), indices.size() / 3, 0xFF);
+
+        uint32_t last = 0;
+
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            data.push_back(0xFF);
+
+            for (size_t j = 0; j < 3; ++j)
+            {
+                EncodeVByte(data, Zigzag32(static_cast<int32_t>(indices[i + j] - last)));
+
+                last = indices[i + j];
+            }
+        }
+
+        data.insert(data.end(), 16, 0);
+
+        return data;
+    }
+
+    static Bytes EncodeIndexSequence(const std::vector<uint32_t>& indices)
+    {
+        Bytes data = { 0xD1 };
+
+        uint32_t last = 0;
+
+        for (const uint32_t index : indices)
+        {
+            EncodeVByte(data, Zigzag32(static_cast<int32_t>(index - last)) << 1);
+
+            last = index;
+        }
+
+        data.insert(data.end(), 4, 0);
+
+        return data;
+    }
+
+    template <class T>
+    static std::vector<T> DecodeIndices(size_t count, MeshoptDecoder::Mode mode, const Bytes& data, bool& success)
+    {
+        std::vector<T> result(count);
+
+        success = MeshoptDecoder::Decode(GetByteAccess(result), count, sizeof(T),
+                mode, MeshoptDecoder::Filter::eNone, ByteView(data));
+
+        return result;
+    }
+
+    static const std::vector<uint32_t> kIndices = { 0, 1, 2, 2, 1, 3, 4, 5, 6, 70000, 3, 0, 6, 5, 4 };
+
+    static constexpr uint32_t kMutationCount = 20000;
+
+    // Guard bytes around the output catch writes past the requested range
+    static constexpr size_t kGuardSize = 64;
+    static constexpr uint8_t kGuard = 0xCD;
+
+    struct EncodedStream
+    {
+        Bytes data;
+        size_t count = 0;
+        size_t stride = 0;
+        MeshoptDecoder::Mode mode = MeshoptDecoder::Mode::eAttributes;
+    };
+
+    static std::vector<EncodedStream> GetEncodedStreams()
+    {
+        std::vector<uint32_t> indices;
+
+        for (uint32_t i = 0; i < 300; ++i)
+        {
+            indices.insert(indices.end(), { i, i + 1, i * 7 % 1000 });
+        }
+
+        return {
+            { EncodeVertexBuffer(GenerateBytes(300 * 16, 1), 300, 16), 300, 16, MeshoptDecoder::Mode::eAttributes },
+            { EncodeVertexBuffer(GenerateBytes(40 * 12, 2), 40, 12), 40, 12, MeshoptDecoder::Mode::eAttributes },
+            { EncodeIndexBuffer(indices), indices.size(), 4, MeshoptDecoder::Mode::eTriangles },
+            { EncodeIndexBuffer(indices), indices.size(), 2, MeshoptDecoder::Mode::eTriangles },
+            { EncodeIndexSequence(indices), indices.size(), 4, MeshoptDecoder::Mode::eIndices }
+        };
+    }
+
+    // Flips, overwrites, inserts or drops random bytes, or cuts the stream short
+    static Bytes Mutate(const Bytes& data, std::mt19937& random)
+    {
+        Bytes mutated = data;
+
+        const uint32_t editCount = random() % 4 + 1;
+
+        for (uint32_t i = 0; i < editCount && !mutated.empty(); ++i)
+        {
+            const size_t position = random() % mutated.size();
+
+            switch (random() % 5)
+            {
+            case 0:
+                mutated[position] ^= static_cast<uint8_t>(1 << (random() % 8));
+                break;
+            case 1:
+                mutated[position] = static_cast<uint8_t>(random());
+                break;
+            case 2:
+                mutated.insert(mutated.begin() + static_cast<ptrdiff_t>(position), static_cast<uint8_t>(random()));
+                break;
+            case 3:
+                mutated.erase(mutated.begin() + static_cast<ptrdiff_t>(position));
+                break;
+            default:
+                mutated.resize(position);
+                break;
+            }
+        }
+
+        return mutated;
+    }
+
+    // The input is copied into an allocation of its exact size, so sanitizers catch any read past it
+    static void DecodeMutated(const EncodedStream& stream, const Bytes& data, bool scalar)
+    {
+        const std::unique_ptr<uint8_t[]> src = std::make_unique<uint8_t[]>(data.size());
+        std::copy(data.begin(), data.end(), src.get());
+
+        const size_t size = stream.count * stream.stride;
+
+        Bytes dst(size + kGuardSize, kGuard);
+
+        const ByteAccess dstAccess(dst.data(), size);
+        const ByteView srcView(src.get(), data.size());
+
+        if (scalar)
+        {
+            MeshoptDecoder::DecodeVertexBufferScalar(dstAccess, stream.count, stream.stride, srcView);
+        }
+        else
+        {
+            MeshoptDecoder::Decode(dstAccess, stream.count, stream.stride,
+                    stream.mode, MeshoptDecoder::Filter::eNone, srcView);
+        }
+
+        for (size_t i = size; i < dst.size(); ++i)
+        {
+            ASSERT_EQ(dst[i], kGuard) << "written past the output at " << i;
+        }
+    }
+
+    // Returns megabytes of decoded vertex data per second of the best iteration
+    template <class TFunc>
+    static double MeasureDecode(size_t decodedSize, const TFunc& func)
+    {
+        const size_t iterationCount = 10;
+
+        double bestSeconds = std::numeric_limits<double>::max();
+
+        for (size_t i = 0; i < iterationCount; ++i)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+
+            const bool success = func();
+
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin;
+
+            EXPECT_TRUE(success);
+
+            bestSeconds = std::min(bestSeconds, duration.count());
+        }
+
+        return static_cast<double>(decodedSize) / bestSeconds / (1024.0 * 1024.0);
+    }
+}
+
+TEST(MeshoptDecoder, DecodeVertexBuffer)
+{
+    // More vertices than a block holds, so the state is carried across blocks
+    const size_t count = 300;
+    const size_t stride = 16;
+
+    const Bytes vertices = Details::GenerateBytes(count * stride, 42);
+    const Bytes data = Details::EncodeVertexBuffer(vertices, count, stride);
+
+    Bytes result(count * stride);
+
+    ASSERT_TRUE(MeshoptDecoder::DecodeVertexBuffer(GetByteAccess(result), count, stride, ByteView(data)));
+
+    EXPECT_EQ(result, vertices);
+}
+
+TEST(MeshoptDecoder, RejectMalformedVertexBuffer)
+{
+    const size_t count = 40;
+    const size_t stride = 8;
+
+    const Bytes vertices = Details::GenerateBytes(count * stride, 7);
+    const Bytes data = Details::EncodeVertexBuffer(vertices, count, stride);
+
+    Bytes result(count * stride);
+
+    const ByteAccess dst = GetByteAccess(result);
+
+    EXPECT_FALSE(MeshoptDecoder::DecodeVertexBuffer(dst, count, stride, ByteView(data.data(), data.size() - 1)));
+    EXPECT_FALSE(MeshoptDecoder::DecodeVertexBuffer(dst, count, stride, ByteView(data.data(), data.size() / 2)));
+    EXPECT_FALSE(MeshoptDecoder::DecodeVertexBuffer(dst, count, 6, ByteView(data)));
+    EXPECT_FALSE(MeshoptDecoder::DecodeVertexBuffer(dst, count + 1, stride, ByteView(data)));
+
+    Bytes corrupted = data;
+    corrupted[0] = 0xB0;
+
+    EXPECT_FALSE(MeshoptDecoder::DecodeVertexBuffer(dst, count, stride, ByteView(corrupted)));
+}
+
+TEST(MeshoptDecoder, DecodeIndexBuffer)
+{
+    const Bytes data = Details::EncodeIndexBuffer(Details::kIndices);
+
+    bool success = false;
+
+    const std::vector<uint32_t> indices32 = Details::DecodeIndices<uint32_t>(
+            Details::kIndices.size(), MeshoptDecoder::Mode::eTriangles, data, success);
+
+    ASSERT_TRUE(success);
+    EXPECT_EQ(indices32, Details::kIndices);
+
+    const std::vector<uint16_t> indices16 = Details::DecodeIndices<uint16_t>(
+            Details::kIndices.size(), MeshoptDecoder::Mode::eTriangles, data, success);
+
+    ASSERT_TRUE(success);
+    EXPECT_EQ(indices16, std::vector<uint16_t>(Details::kIndices.begin(), Details::kIndices.end()));
+
+    Details::DecodeIndices<uint32_t>(Details::kIndices.size(), MeshoptDecoder::Mode::eTriangles,
+            Bytes(data.begin(), data.end() - 1), success);
+
+    EXPECT_FALSE(success);
+}
+
+TEST(MeshoptDecoder, DecodeIndexSequence)
+{
+    const Bytes data = Details::EncodeIndexSequence(Details::kIndices);
+
+    bool success = false;
+
+    const std::vector<uint32_t> indices = Details::DecodeIndices<uint32_t>(
+            Details::kIndices.size(), MeshoptDecoder::Mode::eIndices, data, success);
+
+    ASSERT_TRUE(success);
+    EXPECT_EQ(indices, Details::kIndices);
+
+    Details::DecodeIndices<uint32_t>(Details::kIndices.size() + 1, MeshoptDecoder::Mode::eIndices, data, success);
+
+    EXPECT_FALSE(success);
+}
+
+TEST(MeshoptDecoder, ApplyFilter)
+{
+    // Mantissa 3 with exponent -1
+    std::vector<uint32_t> exponential = { 0xFF000003u };
+
+    ASSERT_TRUE(MeshoptDecoder::ApplyFilter(GetByteAccess(exponential), 1, 4, MeshoptDecoder::Filter::eExponential));
+    EXPECT_EQ(std::bit_cast<float>(exponential[0]), 1.5f);
+
+    // Octahedral (1, 0) maps to the +X axis, w is untouched
+    std::vector<int8_t> octahedral = { 127, 0, 127, 55 };
+
+    ASSERT_TRUE(MeshoptDecoder::ApplyFilter(GetByteAccess(octahedral), 1, 4, MeshoptDecoder::Filter::eOctahedral));
+    EXPECT_EQ(octahedral, std::vector<int8_t>({ 127, 0, 0, 55 }));
+
+    std::vector<uint32_t> data(4);
+
+    EXPECT_FALSE(MeshoptDecoder::ApplyFilter(GetByteAccess(data), 1, 12, MeshoptDecoder::Filter::eQuaternion));
+    EXPECT_FALSE(MeshoptDecoder::ApplyFilter(GetByteAccess(data), 5, 4, MeshoptDecoder::Filter::eExponential));
+}
+
+TEST(MeshoptDecoder, MutatedStreams)
+{
+    std::mt19937 random(1234);
+
+    for (const Details::EncodedStream& stream : Details::GetEncodedStreams())
+    {
+        const bool isVertexStream = stream.mode == MeshoptDecoder::Mode::eAttributes;
+
+        for (uint32_t i = 0; i < Details::kMutationCount; ++i)
+        {
+            const Bytes data = Details::Mutate(stream.data, random);
+
+            Details::DecodeMutated(stream, data, false);
+
+            if (isVertexStream)
+            {
+                Details::DecodeMutated(stream, data, true);
+            }
+
+            if (HasFatalFailure())
+            {
+                return;
+            }
+        }
+
+        // Every prefix of the stream, the decoder must not accept any of them
+        for (size_t size = 0; size < stream.data.size(); ++size)
+        {
+            const Bytes data(stream.data.begin(), stream.data.begin() + static_cast<ptrdiff_t>(size));
+
+            Details::DecodeMutated(stream, data, false);
+
+            Bytes result(stream.count * stream.stride);
+
+            EXPECT_FALSE(MeshoptDecoder::Decode(GetByteAccess(result), stream.count, stream.stride,
+                    stream.mode, MeshoptDecoder::Filter::eNone, ByteView(data))) << size;
+        }
+    }
+}
+
+TEST(MeshoptDecoder, DecodeThroughputBenchmark)
+{
+    // Position, normal and texture coordinates of a typical vertex
+    const size_t count = 1024 * 1024;
+    const size_t stride = 32;
+
+    const Bytes vertices = Details::GenerateBytes(count * stride, 42);
+    const Bytes data = Details::EncodeVertexBuffer(vertices, count, stride);
+
+    Bytes result(count * stride);
+
+    const double simd = Details::MeasureDecode(result.size(), [&]()
+        {
+            return MeshoptDecoder::DecodeVertexBuffer(GetByteAccess(result), count, stride, ByteView(data));
+        });
+
+    EXPECT_EQ(result, vertices);
+
+    const double scalar = Details::MeasureDecode(result.size(), [&]()
+        {
+            return MeshoptDecoder::DecodeVertexBufferScalar(GetByteAccess(result), count, stride, ByteView(data));
+        });
+
+    EXPECT_EQ(result, vertices);
+
+    std::cout << "MeshoptDecoder: " << result.size() / (1024 * 1024) << " MB of vertices decoded, "
+            << simd << " MB/s with SSE2 when available, " << scalar << " MB/s scalar\n";
+
+    RecordProperty("MegabytesPerSecond", static_cast<int>(simd));
+    RecordProperty("ScalarMegabytesPerSecond", static_cast<int>(scalar));
+}
@@ -0,0 +1,83 @@
+#include "Tests/Headless/TestMeshes.hpp"
+
+#include "Utils/Helpers.hpp"
+
+namespace Details
+{
+    // Rotates the triangle so that the smallest index goes first, the winding is preserved
+    static std::array<uint32_t, 3> GetCanonicalTriangle(const uint32_t* triangle)
+    {
+        const size_t first = std::min_element(triangle, triangle + 3) - triangle;
+
+        return { triangle[first], triangle[(first + 1) % 3], triangle[(first + 2) % 3] };
+    }
+
+    static std::vector<std::array<uint32_t, 3>> GetSortedTriangles(const std::vector<uint32_t>& indices)
+    {
+        std::vector<std::array<uint32_t, 3>> triangles(indices.size() / 3);
+
+        for (size_t i = 0; i < triangles.size(); ++i)
+        {
+            triangles[i] = GetCanonicalTriangle(indices.data() + i * 3);
+        }
+
+        std::ranges::sort(triangles);
+
+        return triangles;
+    }
+}
+
+MeshData TestMeshes::CreateGrid(uint32_t size)
+{
+    MeshData mesh;
+
+    const uint32_t rowSize = size + 1;
+
+    mesh.positions.reserve(rowSize * rowSize);
+    mesh.texCoords.reserve(rowSize * rowSize);
+
+    for (uint32_t y = 0; y < rowSize; ++y)
+    {
+        for (uint32_t x = 0; x < rowSize; ++x)
+        {
+            const glm::vec2 uv = glm::vec2(x, y) / static_cast<float>(size);
+
+            mesh.positions.emplace_back(uv, 0.0f);
+            mesh.texCoords.push_back(uv);
+        }
+    }
+
+    mesh.indices.reserve(size * size * 6);
+
+    for (uint32_t y = 0; y < size; ++y)
+    {
+        for (uint32_t x = 0; x < size; ++x)
+        {
+            const uint32_t i0 = y * rowSize + x;
+            const uint32_t i1 = i0 + 1;
+            const uint32_t i2 = i0 + rowSize;
+            const uint32_t i3 = i2 + 1;
+
+            mesh.indices.insert(mesh.indices.end(), { i0, i1, i3, i0, i3, i2 });
+        }
+    }
+
+    return mesh;
+}
+
+MeshData TestMeshes::CreateHeightField(uint32_t size, float amplitude)
+{
+    MeshData mesh = CreateGrid(size);
+
+    for (glm::vec3& position : mesh.positions)
+    {
+        position.z = amplitude * std::sin(position.x * Numbers::kTwoPi) * std::cos(position.y * Numbers::kPi * 3.0f);
+    }
+
+    return mesh;
+}
+
+bool TestMeshes::HasSameTriangles(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b)
+{
+    return a.size() == b.size() && Details::GetSortedTriangles(a) == Details::GetSortedTriangles(b);
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Engine/Scene/MeshData.hpp"
+
+// Procedural geometry shared by the tests, only indices, positions and texture coordinates are filled in
+namespace TestMeshes
+{
+    // Unit square in the XY plane split into size x size quads, faces +Z, texture coordinates follow XY
+    MeshData CreateGrid(uint32_t size);
+
+    // Grid displaced along Z by a few sine waves of the given amplitude
+    MeshData CreateHeightField(uint32_t size, float amplitude);
+
+    // True when both index lists hold the same triangles in any order, the winding of every triangle is kept
+    bool HasSameTriangles(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+}
@@ -0,0 +1,158 @@
+#include "Engine/Scene/Transform.hpp"
+
+namespace Details
+{
+    static constexpr float kEpsilon = 1e-5f;
+
+    // Accumulated float error over thousands of steps stays far below this
+    static constexpr float kDriftTolerance = 1e-3f;
+
+    static constexpr uint32_t kStepCount = 10000;
+
+    static constexpr float kStepAngle = 0.01f;
+
+    // Roughly half of the angle between the rotations for small differences, q and -q are the same rotation
+    static float GetDistance(const glm::quat& a, const glm::quat& b)
+    {
+        return std::min(glm::length(a - b), glm::length(a + b));
+    }
+
+    static float GetOrthonormalityError(const glm::mat4& matrix)
+    {
+        const glm::mat3 rotationMatrix(matrix);
+
+        const glm::mat3 product = glm::transpose(rotationMatrix) * rotationMatrix;
+
+        float error = 0.0f;
+
+        for (int32_t i = 0; i < 3; ++i)
+        {
+            for (int32_t j = 0; j < 3; ++j)
+            {
+                error = std::max(error, std::abs(product[i][j] - (i == j ? 1.0f : 0.0f)));
+            }
+        }
+
+        return error;
+    }
+}
+
+TEST(Transform, DecomposeMatrix)
+{
+    const glm::vec3 translation(1.0f, -2.0f, 3.0f);
+    const glm::quat rotation = glm::angleAxis(0.7f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f)));
+    const glm::vec3 scale(2.0f, 0.5f, 3.0f);
+
+    const Transform trs(translation, rotation, scale);
+    const Transform transform(trs.GetMatrix());
+
+    EXPECT_LT(glm::distance(transform.GetTranslation(), translation), Details::kEpsilon);
+    EXPECT_LT(Details::GetDistance(transform.GetRotation(), rotation), Details::kEpsilon);
+    EXPECT_LT(glm::distance(transform.GetScale(), scale), Details::kEpsilon);
+
+    // The matrix a transform was created from is kept as is
+    EXPECT_EQ(transform.GetMatrix(), trs.GetMatrix());
+}
+
+TEST(Transform, DecomposeMirroredMatrix)
+{
+    const glm::mat4 matrix = glm::translate(glm::vec3(1.0f, -2.0f, 3.0f))
+            * glm::rotate(0.7f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f))) * glm::scale(glm::vec3(2.0f, -0.5f, 3.0f));
+
+    const Transform transform(matrix);
+
+    EXPECT_NEAR(glm::length(transform.GetRotation()), 1.0f, Details::kEpsilon);
+    EXPECT_LT(transform.GetScale().x * transform.GetScale().y * transform.GetScale().z, 0.0f);
+
+    // The reflection survives recomposing the matrix from translation, rotation and scale
+    const Transform trs(transform.GetTranslation(), transform.GetRotation(), transform.GetScale());
+
+    for (glm::length_t i = 0; i < 4; ++i)
+    {
+        EXPECT_LT(glm::distance(trs.GetMatrix()[i], matrix[i]), Details::kEpsilon) << i;
+    }
+}
+
+TEST(Transform, SetTranslationKeepsMatrix)
+{
+    const glm::mat4 matrix = glm::rotate(0.3f, Vector3::kY) * glm::scale(glm::vec3(2.0f));
+
+    Transform transform(matrix);
+
+    transform.SetTranslation(Vector3::kX);
+
+    glm::mat4 expected = matrix;
+    expected[3] = glm::vec4(Vector3::kX, 1.0f);
+
+    EXPECT_EQ(transform.GetMatrix(), expected);
+    EXPECT_EQ(transform.GetTranslation(), Vector3::kX);
+}
+
+TEST(Transform, Composition)
+{
+    const Transform a(Vector3::kX, glm::angleAxis(Numbers::kPi * 0.5f, Vector3::kZ), Vector3::kUnit);
+    const Transform b(Vector3::kY);
+
+    // a is applied first
+    const glm::vec3 point = (a * b) * glm::vec4(Vector3::kX, 1.0f);
+
+    EXPECT_LT(glm::distance(point, glm::vec3(1.0f, 2.0f, 0.0f)), Details::kEpsilon);
+
+    const Transform identity = a * a.GetInverse();
+
+    EXPECT_LT(Details::GetOrthonormalityError(identity.GetMatrix()), Details::kEpsilon);
+    EXPECT_LT(glm::length(identity.GetTranslation()), Details::kEpsilon);
+}
+
+TEST(Transform, IncrementalRotationDrift)
+{
+    const glm::vec3 axis = glm::normalize(glm::vec3(1.0f, 1.0f, 0.5f));
+    const glm::quat step = glm::angleAxis(Details::kStepAngle, axis);
+
+    const glm::vec3 scale(1.0f, 2.0f, 3.0f);
+
+    Transform transform(Vector3::kZero, Quat::kIdentity, scale);
+
+    for (uint32_t i = 0; i < Details::kStepCount; ++i)
+    {
+        transform.SetRotation(step * transform.GetRotation());
+
+        // Interleaved matrix reads mustn't feed back into the rotation
+        transform.GetMatrix();
+    }
+
+    const float angle = std::fmod(Details::kStepAngle * static_cast<float>(Details::kStepCount), Numbers::kTwoPi);
+    const glm::quat expected = glm::angleAxis(angle, axis);
+
+    EXPECT_NEAR(glm::length(transform.GetRotation()), 1.0f, Details::kEpsilon);
+    EXPECT_LT(Details::GetDistance(transform.GetRotation(), expected), Details::kDriftTolerance);
+
+    EXPECT_EQ(transform.GetScale(), scale);
+
+    const glm::mat4 unscaled = transform.GetMatrix() * glm::scale(1.0f / scale);
+
+    EXPECT_LT(Details::GetOrthonormalityError(unscaled), Details::kEpsilon);
+}
+
+TEST(Transform, IncrementalMatrixRotationDrift)
+{
+    const glm::vec3 axis = glm::normalize(glm::vec3(0.2f, 1.0f, -0.4f));
+
+    const Transform step(Vector3::kZero, glm::angleAxis(Details::kStepAngle, axis), Vector3::kUnit);
+
+    Transform transform(Vector3::kX);
+
+    for (uint32_t i = 0; i < Details::kStepCount; ++i)
+    {
+        transform *= step;
+    }
+
+    const float angle = std::fmod(Details::kStepAngle * static_cast<float>(Details::kStepCount), Numbers::kTwoPi);
+    const glm::quat expected = glm::angleAxis(angle, axis);
+
+    // Matrix products accumulate scale and shear error, the decomposition has to absorb it
+    EXPECT_NEAR(glm::length(transform.GetRotation()), 1.0f, Details::kEpsilon);
+    EXPECT_LT(Details::GetDistance(transform.GetRotation(), expected), Details::kDriftTolerance);
+    EXPECT_LT(glm::distance(transform.GetScale(), Vector3::kUnit), Details::kDriftTolerance);
+    EXPECT_LT(glm::distance(transform.GetTranslation(), expected * Vector3::kX), Details::kDriftTolerance);
+}
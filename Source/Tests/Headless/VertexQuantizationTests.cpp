@@ -0,0 +1,148 @@
+#include <random>
+
+#include "Engine/Scene/VertexQuantization.hpp"
+
+namespace Details
+{
+    static constexpr uint32_t kSampleCount = 4096;
+
+    // Half a step of 16-bit unorm, scaled by the longest bbox edge
+    static constexpr float kPositionTolerance = 0.5f / 65535.0f;
+
+    // A snorm step of the octahedral square stretches up to about twice as much on the sphere
+    static constexpr float kDirectionTolerance = 2.0f / 32767.0f;
+
+    // Half precision keeps 11 significant bits
+    static constexpr float kTexCoordTolerance = 1.0f / 2048.0f;
+
+    static constexpr float kEpsilon = 1e-6f;
+
+    static std::vector<glm::vec3> GetSphereDirections()
+    {
+        std::vector<glm::vec3> directions = {
+            glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f),
+            glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f),
+            glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f),
+        };
+
+        // Fibonacci sphere covers both hemispheres and the seams of the octahedron evenly
+        const float goldenAngle = glm::pi<float>() * (3.0f - std::sqrt(5.0f));
+
+        for (uint32_t i = 0; i < kSampleCount; ++i)
+        {
+            const float z = 1.0f - 2.0f * (static_cast<float>(i) + 0.5f) / static_cast<float>(kSampleCount);
+            const float r = std::sqrt(1.0f - z * z);
+            const float phi = goldenAngle * static_cast<float>(i);
+
+            directions.emplace_back(r * std::cos(phi), r * std::sin(phi), z);
+        }
+
+        return directions;
+    }
+}
+
+TEST(VertexQuantization, Positions)
+{
+    const AABBox bbox(glm::vec3(-3.0f, 10.0f, 0.5f), glm::vec3(5.0f, 12.0f, 0.75f));
+    const float scale = VertexQuantization::GetPositionScale(bbox);
+
+    ASSERT_FLOAT_EQ(scale, 8.0f);
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+    std::vector<glm::vec3> positions = { bbox.GetMin(), bbox.GetMax() };
+
+    for (uint32_t i = 0; i < Details::kSampleCount; ++i)
+    {
+        const glm::vec3 t(distribution(generator), distribution(generator), distribution(generator));
+
+        positions.push_back(glm::mix(bbox.GetMin(), bbox.GetMax(), t));
+    }
+
+    const std::vector<uint64_t> quantized
+            = VertexQuantization::QuantizePositions(DataView<glm::vec3>(positions), bbox);
+
+    ASSERT_EQ(quantized.size(), positions.size());
+
+    const float tolerance = Details::kPositionTolerance * scale + Details::kEpsilon * 16.0f;
+
+    for (size_t i = 0; i < positions.size(); ++i)
+    {
+        const glm::vec3 decoded = VertexQuantization::DecodePosition(quantized[i], bbox);
+
+        for (glm::length_t j = 0; j < 3; ++j)
+        {
+            EXPECT_NEAR(decoded[j], positions[i][j], tolerance) << "position " << i;
+        }
+    }
+}
+
+TEST(VertexQuantization, DegenerateBBox)
+{
+    const glm::vec3 point(1.0f, 2.0f, 3.0f);
+    const AABBox bbox(point, point);
+
+    const std::vector<uint64_t> quantized
+            = VertexQuantization::QuantizePositions(DataView<glm::vec3>(&point, 1), bbox);
+
+    const glm::vec3 decoded = VertexQuantization::DecodePosition(quantized.front(), bbox);
+
+    EXPECT_TRUE(std::isfinite(decoded.x) && std::isfinite(decoded.y) && std::isfinite(decoded.z));
+    EXPECT_NEAR(glm::distance(decoded, point), 0.0f, Details::kEpsilon);
+}
+
+TEST(VertexQuantization, Directions)
+{
+    const std::vector<glm::vec3> directions = Details::GetSphereDirections();
+
+    const std::vector<uint32_t> quantized = VertexQuantization::QuantizeDirections(DataView<glm::vec3>(directions));
+
+    ASSERT_EQ(quantized.size(), directions.size());
+
+    float maxError = 0.0f;
+
+    for (size_t i = 0; i < directions.size(); ++i)
+    {
+        const glm::vec3 decoded = VertexQuantization::DecodeDirection(quantized[i]);
+
+        EXPECT_NEAR(glm::length(decoded), 1.0f, Details::kEpsilon);
+
+        const float error = glm::distance(decoded, directions[i]);
+
+        EXPECT_LE(error, Details::kDirectionTolerance) << "direction " << i;
+
+        maxError = std::max(maxError, error);
+    }
+
+    RecordProperty("MaxError", std::to_string(maxError));
+}
+
+TEST(VertexQuantization, TexCoords)
+{
+    std::vector<glm::vec2> texCoords = { glm::vec2(0.0f), glm::vec2(1.0f), glm::vec2(-1.0f, 0.5f) };
+
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<float> distribution(-4.0f, 4.0f);
+
+    for (uint32_t i = 0; i < Details::kSampleCount; ++i)
+    {
+        texCoords.emplace_back(distribution(generator), distribution(generator));
+    }
+
+    const std::vector<uint32_t> quantized = VertexQuantization::QuantizeTexCoords(DataView<glm::vec2>(texCoords));
+
+    ASSERT_EQ(quantized.size(), texCoords.size());
+
+    for (size_t i = 0; i < texCoords.size(); ++i)
+    {
+        const glm::vec2 decoded = VertexQuantization::DecodeTexCoord(quantized[i]);
+
+        for (glm::length_t j = 0; j < 2; ++j)
+        {
+            const float tolerance = std::abs(texCoords[i][j]) * Details::kTexCoordTolerance + Details::kEpsilon;
+
+            EXPECT_NEAR(decoded[j], texCoords[i][j], tolerance) << "texCoord " << i;
+        }
+    }
+}
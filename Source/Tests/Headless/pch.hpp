@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <list>
+#include <set>
+#include <map>
+#include <any>
+#include <array>
+#include <memory>
+#include <optional>
+#include <variant>
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <functional>
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+#include "Utils/Defines.hpp"
+
+PRAGMA_DISABLE_WARNINGS
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_XYZW_ONLY
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+#include <glm/gtx/transform.hpp>
+#include <glm/gtx/quaternion.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include <easy/profiler.h>
+
+#include <gtest/gtest.h>
+
+PRAGMA_ENABLE_WARNINGS
@@ -0,0 +1,27 @@
+#include "Engine/Filesystem/Filepath.hpp"
+#include "Engine/Scene/CookedScene.hpp"
+#include "Engine/Scene/SceneCooker.hpp"
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        LogE << "Usage: SteelCook <scene.gltf|scene.glb> [output" << CookedScene::kExtension << "]\n";
+
+        return 1;
+    }
+
+    const Filepath scenePath(argv[1]);
+
+    if (!scenePath.Exists())
+    {
+        LogE << "Scene not found: " << scenePath.GetAbsolute() << "\n";
+
+        return 1;
+    }
+
+    const Filepath cookedPath(argc == 3 ? std::string(argv[2])
+            : scenePath.GetDirectory() + scenePath.GetBaseName() + std::string(CookedScene::kExtension));
+
+    return SceneCooker::Cook(scenePath, cookedPath) ? 0 : 1;
+}
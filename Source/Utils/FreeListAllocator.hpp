@@ -0,0 +1,38 @@
+#pragma once
+
+// Allocates ranges of abstract units from [0, capacity), the user keeps the size of every allocation
+// Placement is best fit, freed ranges are coalesced with their free neighbors
+class FreeListAllocator
+{
+public:
+    static constexpr uint32_t kInvalidOffset = std::numeric_limits<uint32_t>::max();
+
+    explicit FreeListAllocator(uint32_t capacity_);
+
+    // Returns kInvalidOffset if no free range can hold the allocation
+    uint32_t Allocate(uint32_t size, uint32_t alignment = 1);
+
+    void Free(uint32_t offset, uint32_t size);
+
+    uint32_t GetCapacity() const { return capacity; }
+
+    uint32_t GetFreeSize() const { return freeSize; }
+
+    uint32_t GetLargestFreeRange() const;
+
+    uint32_t GetFreeRangeCount() const { return static_cast<uint32_t>(freeRanges.size()); }
+
+    bool IsEmpty() const { return freeSize == capacity; }
+
+private:
+    uint32_t capacity = 0;
+    uint32_t freeSize = 0;
+
+    // Free ranges by offset and by size, the second one drives best fit search
+    std::map<uint32_t, uint32_t> freeRanges;
+    std::set<std::pair<uint32_t, uint32_t>> freeSizes;
+
+    void AddFreeRange(uint32_t offset, uint32_t size);
+
+    void RemoveFreeRange(std::map<uint32_t, uint32_t>::iterator it);
+};
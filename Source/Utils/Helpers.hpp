@@ -112,6 +112,9 @@ auto MakeFunction(TInst* instance, TFunc&& function)
 
 Bytes GetBytes(const std::vector<ByteView>& byteViews);
 
+// Packs count elements of elementSize bytes that start every stride bytes of src, e.g. one attribute of interleaved data
+void CopyStrided(const uint8_t* src, size_t stride, size_t elementSize, size_t count, uint8_t* dst);
+
 template <class... Types>
 Bytes GetBytes(Types ... values)
 {
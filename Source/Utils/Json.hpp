@@ -0,0 +1,158 @@
+#pragma once
+
+#include "Utils/Assert.hpp"
+
+class JsonDocument;
+
+enum class JsonType : uint8_t
+{
+    eNull,
+    eBool,
+    eNumber,
+    eString,
+    eArray,
+    eObject
+};
+
+// Lightweight reference to a value of the document, invalid when a lookup doesn't find the member
+class JsonValue
+{
+public:
+    JsonValue() = default;
+
+    bool IsValid() const { return document != nullptr; }
+
+    JsonType GetType() const;
+
+    bool IsNull() const { return IsValid() && GetType() == JsonType::eNull; }
+    bool IsBool() const { return IsValid() && GetType() == JsonType::eBool; }
+    bool IsNumber() const { return IsValid() && GetType() == JsonType::eNumber; }
+    bool IsString() const { return IsValid() && GetType() == JsonType::eString; }
+    bool IsArray() const { return IsValid() && GetType() == JsonType::eArray; }
+    bool IsObject() const { return IsValid() && GetType() == JsonType::eObject; }
+
+    // Number without fraction and exponent
+    bool IsInteger() const;
+
+    bool GetBool() const;
+
+    double GetDouble() const;
+
+    int64_t GetInt() const;
+
+    // Escape sequences are decoded only in the strings that have them
+    std::string GetString() const;
+
+    // Contents between the quotes as they are in the input
+    std::string_view GetRawString() const;
+
+    // Element count of arrays, member count of objects
+    uint32_t GetSize() const;
+
+    // Linear search over the members, invalid value if this isn't an object or doesn't have the member,
+    // so lookups can be chained through optional objects
+    JsonValue operator[](std::string_view key) const;
+
+    template <class F>
+    void ForEachElement(F&& func) const;
+
+    // Keys are passed decoded, func takes (std::string_view key, const JsonValue& value)
+    template <class F>
+    void ForEachMember(F&& func) const;
+
+private:
+    friend class JsonDocument;
+
+    const JsonDocument* document = nullptr;
+    uint32_t index = 0;
+
+    JsonValue(const JsonDocument* document_, uint32_t index_);
+};
+
+// Read-only JSON document parsed in two passes
+// The first pass classifies the input in 64-byte blocks with bit masks and indexes the structural characters
+// outside of strings, the second one validates the grammar over the index and writes a tape of fixed-size nodes
+// Strings and numbers stay views of the input until they are read, so the input has to outlive the document
+// Unescaped control characters in strings are rejected as the standard requires
+class JsonDocument
+{
+public:
+    explicit JsonDocument(std::string_view json_);
+
+    JsonDocument(const JsonDocument&) = delete;
+
+    JsonDocument& operator=(const JsonDocument&) = delete;
+
+    bool IsValid() const { return errorOffset == kNoError; }
+
+    // Offset of the input character where parsing failed
+    size_t GetErrorOffset() const { return errorOffset; }
+
+    JsonValue GetRoot() const;
+
+private:
+    friend class JsonValue;
+
+    static constexpr size_t kNoError = std::string_view::npos;
+
+    // Containers store the index of the node following their last descendant in data and the child count in size,
+    // strings and numbers store the offset and the length of their input characters, flag is set for escaped
+    // strings, integer numbers and true
+    struct Node
+    {
+        JsonType type = JsonType::eNull;
+        bool flag = false;
+        uint32_t data = 0;
+        uint32_t size = 0;
+    };
+
+    std::string_view json;
+
+    std::vector<Node> nodes;
+
+    size_t errorOffset = kNoError;
+
+    // Returns the error offset or kNoError
+    size_t BuildTape(const std::vector<uint32_t>& index);
+
+    const Node& GetNode(uint32_t index) const { return nodes[index]; }
+
+    uint32_t GetNextIndex(uint32_t index) const;
+
+    std::string_view GetNodeText(uint32_t index) const;
+};
+
+template <class F>
+void JsonValue::ForEachElement(F&& func) const
+{
+    Assert(IsArray());
+
+    const uint32_t end = document->GetNode(index).data;
+
+    for (uint32_t i = index + 1; i < end; i = document->GetNextIndex(i))
+    {
+        func(JsonValue(document, i));
+    }
+}
+
+template <class F>
+void JsonValue::ForEachMember(F&& func) const
+{
+    Assert(IsObject());
+
+    const uint32_t end = document->GetNode(index).data;
+
+    for (uint32_t i = index + 1; i < end; i = document->GetNextIndex(i + 1))
+    {
+        const JsonValue key(document, i);
+
+        if (document->GetNode(i).flag)
+        {
+            func(std::string_view(key.GetString()), JsonValue(document, i + 1));
+        }
+        else
+        {
+            func(key.GetRawString(), JsonValue(document, i + 1));
+        }
+    }
+}
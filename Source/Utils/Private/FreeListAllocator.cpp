@@ -0,0 +1,117 @@
+#include "Utils/FreeListAllocator.hpp"
+
+#include "Utils/Assert.hpp"
+
+namespace Details
+{
+    static uint32_t AlignUp(uint32_t offset, uint32_t alignment)
+    {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+}
+
+FreeListAllocator::FreeListAllocator(uint32_t capacity_)
+    : capacity(capacity_)
+{
+    Assert(capacity > 0);
+
+    AddFreeRange(0, capacity);
+}
+
+uint32_t FreeListAllocator::Allocate(uint32_t size, uint32_t alignment)
+{
+    Assert(size > 0 && alignment > 0);
+
+    for (auto it = freeSizes.lower_bound({ size, 0 }); it != freeSizes.end(); ++it)
+    {
+        const auto [rangeSize, rangeOffset] = *it;
+
+        const uint32_t offset = Details::AlignUp(rangeOffset, alignment);
+
+        if (offset - rangeOffset + size > rangeSize)
+        {
+            continue;
+        }
+
+        RemoveFreeRange(freeRanges.find(rangeOffset));
+
+        if (offset > rangeOffset)
+        {
+            AddFreeRange(rangeOffset, offset - rangeOffset);
+        }
+
+        if (offset + size < rangeOffset + rangeSize)
+        {
+            AddFreeRange(offset + size, rangeOffset + rangeSize - offset - size);
+        }
+
+        return offset;
+    }
+
+    return kInvalidOffset;
+}
+
+void FreeListAllocator::Free(uint32_t offset, uint32_t size)
+{
+    Assert(size > 0 && offset + size <= capacity);
+
+    uint32_t begin = offset;
+    uint32_t end = offset + size;
+
+    const auto next = freeRanges.lower_bound(offset);
+
+    if (next != freeRanges.begin())
+    {
+        const auto prev = std::prev(next);
+
+        Assert(prev->first + prev->second <= begin);
+
+        if (prev->first + prev->second == begin)
+        {
+            begin = prev->first;
+
+            RemoveFreeRange(prev);
+        }
+    }
+
+    if (next != freeRanges.end())
+    {
+        Assert(end <= next->first);
+
+        if (end == next->first)
+        {
+            end = next->first + next->second;
+
+            RemoveFreeRange(next);
+        }
+    }
+
+    AddFreeRange(begin, end - begin);
+}
+
+uint32_t FreeListAllocator::GetLargestFreeRange() const
+{
+    if (freeSizes.empty())
+    {
+        return 0;
+    }
+
+    return freeSizes.rbegin()->first;
+}
+
+void FreeListAllocator::AddFreeRange(uint32_t offset, uint32_t size)
+{
+    freeRanges.emplace(offset, size);
+    freeSizes.emplace(size, offset);
+
+    freeSize += size;
+}
+
+void FreeListAllocator::RemoveFreeRange(std::map<uint32_t, uint32_t>::iterator it)
+{
+    freeSizes.erase({ it->second, it->first });
+
+    freeSize -= it->second;
+
+    freeRanges.erase(it);
+}
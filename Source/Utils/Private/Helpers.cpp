@@ -1,5 +1,10 @@
 #include <cstdarg>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define HELPERS_SSE2 1
+#endif
+
 #include "Utils/Helpers.hpp"
 
 namespace Details
@@ -33,6 +38,60 @@ namespace Details
 
         return true;
     }
+
+    template <size_t BlockSize>
+    static void CopyBlock(const uint8_t* src, uint8_t* dst)
+    {
+#if HELPERS_SSE2
+        if constexpr (BlockSize == 16)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+        }
+        else
+        {
+            static_assert(BlockSize == 8);
+
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+        }
+#else
+        std::memcpy(dst, src, BlockSize);
+#endif
+    }
+
+    // Moves a whole block per element with one load and one store, the bytes written past an element
+    // are overwritten by the next one, returns the number of elements copied this way
+    template <size_t BlockSize>
+    static size_t CopyStridedBlocks(const uint8_t* src, size_t stride, size_t elementSize, size_t count, uint8_t* dst)
+    {
+        // Blocks must not read past the last element or write past the packed range
+        const size_t srcSize = (count - 1) * stride + elementSize;
+        const size_t dstSize = count * elementSize;
+
+        if (srcSize < BlockSize || dstSize < BlockSize)
+        {
+            return 0;
+        }
+
+        const size_t blockCount = std::min({ count, (srcSize - BlockSize) / stride + 1,
+                (dstSize - BlockSize) / elementSize + 1 });
+
+        size_t i = 0;
+
+        for (; i + 4 <= blockCount; i += 4)
+        {
+            CopyBlock<BlockSize>(src + i * stride, dst + i * elementSize);
+            CopyBlock<BlockSize>(src + (i + 1) * stride, dst + (i + 1) * elementSize);
+            CopyBlock<BlockSize>(src + (i + 2) * stride, dst + (i + 2) * elementSize);
+            CopyBlock<BlockSize>(src + (i + 3) * stride, dst + (i + 3) * elementSize);
+        }
+
+        for (; i < blockCount; ++i)
+        {
+            CopyBlock<BlockSize>(src + i * stride, dst + i * elementSize);
+        }
+
+        return blockCount;
+    }
 }
 
 bool Matrix4::IsValid(const glm::mat4& matrix)
@@ -110,3 +169,36 @@ Bytes GetBytes(const std::vector<ByteView>& byteViews)
 
     return bytes;
 }
+
+void CopyStrided(const uint8_t* src, size_t stride, size_t elementSize, size_t count, uint8_t* dst)
+{
+    Assert(elementSize <= stride);
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    if (stride == elementSize)
+    {
+        std::memcpy(dst, src, count * elementSize);
+
+        return;
+    }
+
+    size_t i = 0;
+
+    if (elementSize <= 8)
+    {
+        i = Details::CopyStridedBlocks<8>(src, stride, elementSize, count, dst);
+    }
+    else if (elementSize <= 16)
+    {
+        i = Details::CopyStridedBlocks<16>(src, stride, elementSize, count, dst);
+    }
+
+    for (; i < count; ++i)
+    {
+        std::memcpy(dst + i * elementSize, src + i * stride, elementSize);
+    }
+}
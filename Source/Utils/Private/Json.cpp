@@ -0,0 +1,876 @@
+#include <bit>
+#include <charconv>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define JSON_SSE2 1
+#endif
+
+#include "Utils/Json.hpp"
+
+namespace Details
+{
+    static constexpr size_t kBlockSize = 64;
+
+    static constexpr uint32_t kMaxDepth = 1024;
+
+    enum CharClass : uint8_t
+    {
+        eQuote = 1 << 0,
+        eBackslash = 1 << 1,
+        eOperator = 1 << 2,
+        eWhitespace = 1 << 3,
+        eControl = 1 << 4
+    };
+
+    // Bit i of every mask is set if the character i of the block has the class
+    struct BlockMasks
+    {
+        uint64_t quote = 0;
+        uint64_t backslash = 0;
+        uint64_t op = 0;
+        uint64_t whitespace = 0;
+        uint64_t control = 0;
+    };
+
+    // State carried between blocks by the first pass
+    struct ScanState
+    {
+        uint64_t prevEscaped = 0;
+        uint64_t prevInString = 0;
+        uint64_t prevScalar = 0;
+
+        // Control characters inside of strings in the current block
+        uint64_t invalid = 0;
+    };
+
+    static bool IsWhitespace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    static bool IsDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+#if JSON_SSE2
+    static uint64_t GetMask(__m128i chars, char c)
+    {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8(c))));
+    }
+
+    static BlockMasks ClassifyBlock(const char* block)
+    {
+        BlockMasks masks;
+
+        for (size_t i = 0; i < kBlockSize; i += 16)
+        {
+            const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+
+            // Brackets and braces differ only in the 0x20 bit
+            const __m128i folded = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+
+            masks.quote |= GetMask(chars, '"') << i;
+            masks.backslash |= GetMask(chars, '\\') << i;
+            masks.op |= (GetMask(folded, '{') | GetMask(folded, '}') | GetMask(chars, ':') | GetMask(chars, ',')) << i;
+            masks.whitespace |= (GetMask(chars, ' ') | GetMask(chars, '\t')
+                    | GetMask(chars, '\n') | GetMask(chars, '\r')) << i;
+
+            // Unsigned chars below 0x20 are the ones that max doesn't change
+            const __m128i controlMax = _mm_set1_epi8(0x1F);
+
+            masks.control |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(
+                    _mm_cmpeq_epi8(_mm_max_epu8(chars, controlMax), controlMax)))) << i;
+        }
+
+        return masks;
+    }
+#else
+    static constexpr std::array<uint8_t, 256> CreateCharClasses()
+    {
+        std::array<uint8_t, 256> classes{};
+
+        classes['"'] = eQuote;
+        classes['\\'] = eBackslash;
+
+        for (const char c : { '{', '}', '[', ']', ':', ',' })
+        {
+            classes[static_cast<uint8_t>(c)] = eOperator;
+        }
+
+        for (size_t c = 0; c < 0x20; ++c)
+        {
+            classes[c] = eControl;
+        }
+
+        for (const char c : { ' ', '\t', '\n', '\r' })
+        {
+            classes[static_cast<uint8_t>(c)] |= eWhitespace;
+        }
+
+        return classes;
+    }
+
+    static constexpr std::array<uint8_t, 256> kCharClasses = CreateCharClasses();
+
+    static BlockMasks ClassifyBlock(const char* block)
+    {
+        BlockMasks masks;
+
+        for (size_t i = 0; i < kBlockSize; ++i)
+        {
+            const uint64_t charClass = kCharClasses[static_cast<uint8_t>(block[i])];
+
+            masks.quote |= (charClass & eQuote) << i;
+            masks.backslash |= ((charClass & eBackslash) >> 1) << i;
+            masks.op |= ((charClass & eOperator) >> 2) << i;
+            masks.whitespace |= ((charClass & eWhitespace) >> 3) << i;
+            masks.control |= ((charClass & eControl) >> 4) << i;
+        }
+
+        return masks;
+    }
+#endif
+
+    // Bit i of the result is the parity of the set bits up to i inclusive
+    static uint64_t PrefixXor(uint64_t mask)
+    {
+        mask ^= mask << 1;
+        mask ^= mask << 2;
+        mask ^= mask << 4;
+        mask ^= mask << 8;
+        mask ^= mask << 16;
+        mask ^= mask << 32;
+
+        return mask;
+    }
+
+    // Characters that follow an odd sequence of backslashes, the sequence may start in the previous block
+    // Adding the sequence starts on odd bits to the backslashes carries through every sequence,
+    // so the parity of the bit where the carry stops tells the parity of the sequence length
+    static uint64_t GetEscaped(uint64_t backslash, uint64_t& prevEscaped)
+    {
+        constexpr uint64_t kEvenBits = 0x5555555555555555;
+
+        backslash &= ~prevEscaped;
+
+        const uint64_t followsEscape = backslash << 1 | prevEscaped;
+        const uint64_t oddSequenceStarts = backslash & ~kEvenBits & ~followsEscape;
+
+        const uint64_t sequencesStartingOnEvenBits = oddSequenceStarts + backslash;
+
+        prevEscaped = sequencesStartingOnEvenBits < backslash ? 1 : 0;
+
+        const uint64_t invertMask = sequencesStartingOnEvenBits << 1;
+
+        return (kEvenBits ^ invertMask) & followsEscape;
+    }
+
+    // Operators outside of strings, all unescaped quotes and the first character of every other scalar
+    static uint64_t GetStructurals(const BlockMasks& masks, ScanState& state)
+    {
+        const uint64_t escaped = GetEscaped(masks.backslash, state.prevEscaped);
+        const uint64_t quote = masks.quote & ~escaped;
+
+        // Includes the opening quotes, excludes the closing ones
+        const uint64_t inString = PrefixXor(quote) ^ state.prevInString;
+
+        state.prevInString = static_cast<uint64_t>(static_cast<int64_t>(inString) >> 63);
+
+        // JSON requires control characters in strings to be escaped
+        state.invalid = masks.control & inString;
+
+        const uint64_t scalar = ~(masks.op | masks.whitespace);
+        const uint64_t nonQuoteScalar = scalar & ~quote;
+        const uint64_t followsNonQuoteScalar = nonQuoteScalar << 1 | state.prevScalar;
+
+        state.prevScalar = nonQuoteScalar >> 63;
+
+        const uint64_t scalarStart = scalar & ~followsNonQuoteScalar;
+
+        return ((masks.op | scalarStart) & ~(inString ^ quote)) | quote;
+    }
+
+    // Returns the offset of the first unescaped control character inside of a string, the input size
+    // if the input ends inside of a string or npos if the input is fine
+    static size_t IndexStructurals(std::string_view json, std::vector<uint32_t>& index)
+    {
+        EASY_FUNCTION()
+
+        ScanState state;
+
+        index.resize(json.size() / 4 + kBlockSize);
+
+        size_t count = 0;
+
+        for (size_t offset = 0; offset < json.size(); offset += kBlockSize)
+        {
+            if (index.size() - count < kBlockSize)
+            {
+                index.resize(index.size() * 2);
+            }
+
+            BlockMasks masks;
+
+            if (json.size() - offset >= kBlockSize)
+            {
+                masks = ClassifyBlock(json.data() + offset);
+            }
+            else
+            {
+                std::array<char, kBlockSize> block;
+                block.fill(' ');
+
+                std::memcpy(block.data(), json.data() + offset, json.size() - offset);
+
+                masks = ClassifyBlock(block.data());
+            }
+
+            uint64_t structurals = GetStructurals(masks, state);
+
+            if (state.invalid != 0)
+            {
+                return offset + std::countr_zero(state.invalid);
+            }
+
+            uint32_t* dst = index.data() + count;
+
+            while (structurals != 0)
+            {
+                *dst++ = static_cast<uint32_t>(offset) + static_cast<uint32_t>(std::countr_zero(structurals));
+
+                structurals &= structurals - 1;
+            }
+
+            count = dst - index.data();
+        }
+
+        index.resize(count);
+
+        return state.prevInString == 0 ? std::string_view::npos : json.size();
+    }
+
+    static bool IsNumber(std::string_view token, bool& integer)
+    {
+        size_t i = 0;
+
+        if (i < token.size() && token[i] == '-')
+        {
+            ++i;
+        }
+
+        if (i < token.size() && token[i] == '0')
+        {
+            ++i;
+        }
+        else if (i < token.size() && IsDigit(token[i]))
+        {
+            while (i < token.size() && IsDigit(token[i]))
+            {
+                ++i;
+            }
+        }
+        else
+        {
+            return false;
+        }
+
+        integer = true;
+
+        if (i < token.size() && token[i] == '.')
+        {
+            integer = false;
+
+            const size_t start = ++i;
+
+            while (i < token.size() && IsDigit(token[i]))
+            {
+                ++i;
+            }
+
+            if (i == start)
+            {
+                return false;
+            }
+        }
+
+        if (i < token.size() && (token[i] == 'e' || token[i] == 'E'))
+        {
+            integer = false;
+
+            if (++i < token.size() && (token[i] == '+' || token[i] == '-'))
+            {
+                ++i;
+            }
+
+            const size_t start = i;
+
+            while (i < token.size() && IsDigit(token[i]))
+            {
+                ++i;
+            }
+
+            if (i == start)
+            {
+                return false;
+            }
+        }
+
+        return i == token.size();
+    }
+
+    static int32_t GetHexDigit(char c)
+    {
+        if (IsDigit(c))
+        {
+            return c - '0';
+        }
+        if (c >= 'a' && c <= 'f')
+        {
+            return c - 'a' + 10;
+        }
+        if (c >= 'A' && c <= 'F')
+        {
+            return c - 'A' + 10;
+        }
+
+        return -1;
+    }
+
+    // Returns -1 if the characters are not 4 hex digits
+    static int32_t GetCodeUnit(std::string_view string, size_t offset)
+    {
+        if (offset + 4 > string.size())
+        {
+            return -1;
+        }
+
+        int32_t codeUnit = 0;
+
+        for (size_t i = offset; i < offset + 4; ++i)
+        {
+            const int32_t digit = GetHexDigit(string[i]);
+
+            if (digit < 0)
+            {
+                return -1;
+            }
+
+            codeUnit = codeUnit << 4 | digit;
+        }
+
+        return codeUnit;
+    }
+
+    static bool IsValidString(std::string_view string)
+    {
+        for (size_t i = string.find('\\'); i != std::string_view::npos; i = string.find('\\', i))
+        {
+            if (++i == string.size())
+            {
+                return false;
+            }
+
+            switch (string[i])
+            {
+            case '"':
+            case '\\':
+            case '/':
+            case 'b':
+            case 'f':
+            case 'n':
+            case 'r':
+            case 't':
+                ++i;
+                break;
+            case 'u':
+                if (GetCodeUnit(string, i + 1) < 0)
+                {
+                    return false;
+                }
+                i += 5;
+                break;
+            default:
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static void AppendUtf8(std::string& result, uint32_t codePoint)
+    {
+        if (codePoint < 0x80)
+        {
+            result += static_cast<char>(codePoint);
+        }
+        else if (codePoint < 0x800)
+        {
+            result += static_cast<char>(0xC0 | codePoint >> 6);
+            result += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+        else if (codePoint < 0x10000)
+        {
+            result += static_cast<char>(0xE0 | codePoint >> 12);
+            result += static_cast<char>(0x80 | (codePoint >> 6 & 0x3F));
+            result += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+        else
+        {
+            result += static_cast<char>(0xF0 | codePoint >> 18);
+            result += static_cast<char>(0x80 | (codePoint >> 12 & 0x3F));
+            result += static_cast<char>(0x80 | (codePoint >> 6 & 0x3F));
+            result += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    // Escapes are validated by the second pass, unpaired surrogates are replaced by U+FFFD
+    static std::string DecodeString(std::string_view string)
+    {
+        constexpr uint32_t kReplacementCharacter = 0xFFFD;
+
+        std::string result;
+        result.reserve(string.size());
+
+        size_t i = 0;
+
+        while (i < string.size())
+        {
+            const size_t escape = string.find('\\', i);
+
+            result.append(string.substr(i, escape - i));
+
+            if (escape == std::string_view::npos)
+            {
+                break;
+            }
+
+            const char c = string[escape + 1];
+
+            i = escape + 2;
+
+            switch (c)
+            {
+            case 'b':
+                result += '\b';
+                break;
+            case 'f':
+                result += '\f';
+                break;
+            case 'n':
+                result += '\n';
+                break;
+            case 'r':
+                result += '\r';
+                break;
+            case 't':
+                result += '\t';
+                break;
+            case 'u':
+            {
+                uint32_t codePoint = static_cast<uint32_t>(GetCodeUnit(string, i));
+
+                i += 4;
+
+                if (codePoint >= 0xD800 && codePoint < 0xDC00)
+                {
+                    const bool paired = i + 1 < string.size() && string[i] == '\\' && string[i + 1] == 'u';
+
+                    const int32_t low = paired ? GetCodeUnit(string, i + 2) : -1;
+
+                    if (low >= 0xDC00 && low < 0xE000)
+                    {
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (static_cast<uint32_t>(low) - 0xDC00);
+
+                        i += 6;
+                    }
+                    else
+                    {
+                        codePoint = kReplacementCharacter;
+                    }
+                }
+                else if (codePoint >= 0xDC00 && codePoint < 0xE000)
+                {
+                    codePoint = kReplacementCharacter;
+                }
+
+                AppendUtf8(result, codePoint);
+                break;
+            }
+            default:
+                result += c;
+                break;
+            }
+        }
+
+        return result;
+    }
+}
+
+JsonValue::JsonValue(const JsonDocument* document_, uint32_t index_)
+    : document(document_)
+    , index(index_)
+{}
+
+JsonType JsonValue::GetType() const
+{
+    Assert(IsValid());
+
+    return document->GetNode(index).type;
+}
+
+bool JsonValue::IsInteger() const
+{
+    return IsNumber() && document->GetNode(index).flag;
+}
+
+bool JsonValue::GetBool() const
+{
+    Assert(IsBool());
+
+    return document->GetNode(index).flag;
+}
+
+double JsonValue::GetDouble() const
+{
+    Assert(IsNumber());
+
+    const std::string_view text = document->GetNodeText(index);
+
+    double value = 0.0;
+
+    const auto [ptr, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+
+    if (error == std::errc::result_out_of_range)
+    {
+        return std::strtod(std::string(text).c_str(), nullptr);
+    }
+
+    return value;
+}
+
+int64_t JsonValue::GetInt() const
+{
+    Assert(IsNumber());
+
+    if (document->GetNode(index).flag)
+    {
+        const std::string_view text = document->GetNodeText(index);
+
+        int64_t value = 0;
+
+        const auto [ptr, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+
+        if (error == std::errc())
+        {
+            return value;
+        }
+    }
+
+    // Saturates instead of overflowing the conversion
+    const double value = GetDouble();
+
+    if (value >= static_cast<double>(std::numeric_limits<int64_t>::max()))
+    {
+        return std::numeric_limits<int64_t>::max();
+    }
+
+    return static_cast<int64_t>(std::max(value, static_cast<double>(std::numeric_limits<int64_t>::min())));
+}
+
+std::string JsonValue::GetString() const
+{
+    Assert(IsString());
+
+    const std::string_view text = document->GetNodeText(index);
+
+    if (document->GetNode(index).flag)
+    {
+        return Details::DecodeString(text);
+    }
+
+    return std::string(text);
+}
+
+std::string_view JsonValue::GetRawString() const
+{
+    Assert(IsString());
+
+    return document->GetNodeText(index);
+}
+
+uint32_t JsonValue::GetSize() const
+{
+    Assert(IsArray() || IsObject());
+
+    return document->GetNode(index).size;
+}
+
+JsonValue JsonValue::operator[](std::string_view key) const
+{
+    if (!IsObject())
+    {
+        return JsonValue();
+    }
+
+    const uint32_t end = document->GetNode(index).data;
+
+    for (uint32_t i = index + 1; i < end; i = document->GetNextIndex(i + 1))
+    {
+        const JsonValue member(document, i);
+
+        const bool found = document->GetNode(i).flag ? member.GetString() == key : member.GetRawString() == key;
+
+        if (found)
+        {
+            return JsonValue(document, i + 1);
+        }
+    }
+
+    return JsonValue();
+}
+
+JsonDocument::JsonDocument(std::string_view json_)
+    : json(json_)
+{
+    EASY_FUNCTION()
+
+    if (json.size() >= std::numeric_limits<uint32_t>::max())
+    {
+        errorOffset = 0;
+
+        return;
+    }
+
+    std::vector<uint32_t> index;
+
+    errorOffset = Details::IndexStructurals(json, index);
+
+    if (errorOffset != kNoError)
+    {
+        return;
+    }
+
+    errorOffset = BuildTape(index);
+}
+
+JsonValue JsonDocument::GetRoot() const
+{
+    Assert(IsValid());
+
+    return JsonValue(this, 0);
+}
+
+size_t JsonDocument::BuildTape(const std::vector<uint32_t>& index)
+{
+    EASY_FUNCTION()
+
+    enum class State
+    {
+        eValue,
+        eKey,
+        eNext
+    };
+
+    const uint32_t count = static_cast<uint32_t>(index.size());
+
+    // Every node consumes at least one index entry
+    nodes.reserve(count);
+
+    std::vector<uint32_t> containers;
+
+    State state = State::eValue;
+
+    uint32_t i = 0;
+
+    while (i < count)
+    {
+        const uint32_t offset = index[i];
+        const char c = json[offset];
+
+        if (state == State::eNext)
+        {
+            if (containers.empty())
+            {
+                return offset;
+            }
+
+            Node& container = nodes[containers.back()];
+
+            const bool object = container.type == JsonType::eObject;
+
+            if (c == ',')
+            {
+                state = object ? State::eKey : State::eValue;
+            }
+            else if (c == (object ? '}' : ']'))
+            {
+                container.data = static_cast<uint32_t>(nodes.size());
+
+                containers.pop_back();
+            }
+            else
+            {
+                return offset;
+            }
+
+            ++i;
+
+            continue;
+        }
+
+        if (c == '"')
+        {
+            // Closing quotes are indexed as well, the first pass guarantees that every string is closed
+            if (i + 1 == count)
+            {
+                return offset;
+            }
+
+            const std::string_view text = json.substr(offset + 1, index[i + 1] - offset - 1);
+
+            const bool escaped = text.find('\\') != std::string_view::npos;
+
+            if (escaped && !Details::IsValidString(text))
+            {
+                return offset;
+            }
+
+            if (state == State::eValue && !containers.empty())
+            {
+                ++nodes[containers.back()].size;
+            }
+
+            nodes.push_back(Node{ JsonType::eString, escaped, offset + 1, static_cast<uint32_t>(text.size()) });
+
+            i += 2;
+
+            if (state == State::eKey)
+            {
+                if (i == count || json[index[i]] != ':')
+                {
+                    return i < count ? index[i] : json.size();
+                }
+
+                ++i;
+
+                state = State::eValue;
+            }
+            else
+            {
+                state = State::eNext;
+            }
+
+            continue;
+        }
+
+        if (state == State::eKey)
+        {
+            return offset;
+        }
+
+        if (!containers.empty())
+        {
+            ++nodes[containers.back()].size;
+        }
+
+        if (c == '{' || c == '[')
+        {
+            if (containers.size() == Details::kMaxDepth)
+            {
+                return offset;
+            }
+
+            const bool object = c == '{';
+
+            containers.push_back(static_cast<uint32_t>(nodes.size()));
+
+            nodes.push_back(Node{ object ? JsonType::eObject : JsonType::eArray, false, 0, 0 });
+
+            ++i;
+
+            if (i < count && json[index[i]] == (object ? '}' : ']'))
+            {
+                nodes.back().data = static_cast<uint32_t>(nodes.size());
+
+                containers.pop_back();
+
+                ++i;
+
+                state = State::eNext;
+            }
+            else
+            {
+                state = object ? State::eKey : State::eValue;
+            }
+
+            continue;
+        }
+
+        if (c == '}' || c == ']' || c == ',' || c == ':')
+        {
+            return offset;
+        }
+
+        // Scalars end at the next indexed character, only whitespace can precede it
+        const uint32_t end = i + 1 < count ? index[i + 1] : static_cast<uint32_t>(json.size());
+
+        std::string_view token = json.substr(offset, end - offset);
+
+        while (Details::IsWhitespace(token.back()))
+        {
+            token.remove_suffix(1);
+        }
+
+        if (token == "true" || token == "false")
+        {
+            nodes.push_back(Node{ JsonType::eBool, token == "true", offset, 0 });
+        }
+        else if (token == "null")
+        {
+            nodes.push_back(Node{ JsonType::eNull, false, offset, 0 });
+        }
+        else
+        {
+            bool integer = false;
+
+            if (!Details::IsNumber(token, integer))
+            {
+                return offset;
+            }
+
+            nodes.push_back(Node{ JsonType::eNumber, integer, offset, static_cast<uint32_t>(token.size()) });
+        }
+
+        ++i;
+
+        state = State::eNext;
+    }
+
+    if (state != State::eNext || !containers.empty())
+    {
+        return json.size();
+    }
+
+    return kNoError;
+}
+
+uint32_t JsonDocument::GetNextIndex(uint32_t index) const
+{
+    const Node& node = nodes[index];
+
+    if (node.type == JsonType::eArray || node.type == JsonType::eObject)
+    {
+        return node.data;
+    }
+
+    return index + 1;
+}
+
+std::string_view JsonDocument::GetNodeText(uint32_t index) const
+{
+    const Node& node = nodes[index];
+
+    return json.substr(node.data, node.size);
+}
@@ -0,0 +1,154 @@
+#include <atomic>
+
+#include "Utils/ThreadPool.hpp"
+
+#include "Utils/Assert.hpp"
+
+namespace Details
+{
+    static constexpr size_t kTasksPerThread = 4;
+}
+
+ThreadPool::ThreadPool(uint32_t threadCount)
+{
+    Assert(threadCount > 0);
+
+    threads.reserve(threadCount);
+
+    for (uint32_t i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back(&ThreadPool::Run, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        const std::lock_guard lock(mutex);
+
+        stopped = true;
+    }
+
+    condition.notify_all();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+uint32_t ThreadPool::GetDefaultThreadCount()
+{
+    return std::max(std::thread::hardware_concurrency(), 2u) - 1;
+}
+
+void ThreadPool::ExecuteParallel(size_t count, const IndexedTask& func)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    const size_t taskCount = std::min(count, threads.size() * Details::kTasksPerThread);
+
+    if (taskCount <= 1)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            func(i);
+        }
+
+        return;
+    }
+
+    std::atomic<size_t> nextIndex = 0;
+    std::atomic<size_t> pendingCount = taskCount;
+
+    const auto executeRange = [&]()
+        {
+            for (size_t i = nextIndex++; i < count; i = nextIndex++)
+            {
+                func(i);
+            }
+
+            --pendingCount;
+        };
+
+    for (size_t i = 1; i < taskCount; ++i)
+    {
+        Enqueue(executeRange);
+    }
+
+    executeRange();
+
+    while (pendingCount > 0)
+    {
+        if (!TryExecuteTask())
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void ThreadPool::Enqueue(Task&& task)
+{
+    {
+        const std::lock_guard lock(mutex);
+
+        tasks.push_back(std::move(task));
+    }
+
+    condition.notify_one();
+}
+
+bool ThreadPool::TryExecuteTask()
+{
+    Task task;
+
+    {
+        const std::lock_guard lock(mutex);
+
+        if (tasks.empty())
+        {
+            return false;
+        }
+
+        task = std::move(tasks.front());
+
+        tasks.pop_front();
+    }
+
+    task();
+
+    return true;
+}
+
+void ThreadPool::Run()
+{
+    EASY_THREAD_SCOPE("ThreadPool")
+
+    while (true)
+    {
+        Task task;
+
+        {
+            std::unique_lock lock(mutex);
+
+            condition.wait(lock, [this]()
+                {
+                    return stopped || !tasks.empty();
+                });
+
+            if (stopped && tasks.empty())
+            {
+                return;
+            }
+
+            task = std::move(tasks.front());
+
+            tasks.pop_front();
+        }
+
+        task();
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+
+class ThreadPool
+{
+public:
+    using Task = std::function<void()>;
+    using IndexedTask = std::function<void(size_t)>;
+
+    explicit ThreadPool(uint32_t threadCount = GetDefaultThreadCount());
+
+    ~ThreadPool();
+
+    static uint32_t GetDefaultThreadCount();
+
+    uint32_t GetThreadCount() const { return static_cast<uint32_t>(threads.size()); }
+
+    template <class TFunc>
+    auto Execute(TFunc&& func) -> std::future<std::invoke_result_t<TFunc>>;
+
+    // Blocks until func has been called for each index in [0, count), the calling thread takes part in the work
+    void ExecuteParallel(size_t count, const IndexedTask& func);
+
+    // Calls func(begin, end) for consecutive blocks of [0, count), in parallel when threadPool is provided
+    template <class TFunc>
+    static void ForEachBlock(ThreadPool* threadPool, size_t count, size_t blockSize, const TFunc& func);
+
+    // Waits for the future while executing pending tasks, so it's safe to call from a worker thread
+    template <class T>
+    T Wait(std::future<T>& future);
+
+private:
+    std::vector<std::thread> threads;
+
+    std::deque<Task> tasks;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    bool stopped = false;
+
+    void Enqueue(Task&& task);
+
+    bool TryExecuteTask();
+
+    void Run();
+};
+
+template <class TFunc>
+auto ThreadPool::Execute(TFunc&& func) -> std::future<std::invoke_result_t<TFunc>>
+{
+    using TResult = std::invoke_result_t<TFunc>;
+
+    const auto task = std::make_shared<std::packaged_task<TResult()>>(std::forward<TFunc>(func));
+
+    std::future<TResult> future = task->get_future();
+
+    Enqueue([task]()
+        {
+            (*task)();
+        });
+
+    return future;
+}
+
+template <class TFunc>
+void ThreadPool::ForEachBlock(ThreadPool* threadPool, size_t count, size_t blockSize, const TFunc& func)
+{
+    const size_t blockCount = (count + blockSize - 1) / blockSize;
+
+    const auto processBlock = [&](size_t block)
+        {
+            func(block * blockSize, std::min(count, (block + 1) * blockSize));
+        };
+
+    if (threadPool && blockCount > 1)
+    {
+        threadPool->ExecuteParallel(blockCount, processBlock);
+    }
+    else
+    {
+        for (size_t i = 0; i < blockCount; ++i)
+        {
+            processBlock(i);
+        }
+    }
+}
+
+template <class T>
+T ThreadPool::Wait(std::future<T>& future)
+{
+    while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        if (!TryExecuteTask())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    return future.get();
+}